@@ -1,6 +1,8 @@
 #include "BackgroundManager.h"
 #include "Engine.h"
 #include "SpriteManager.h"
+#include "FrameBudgetGovernor.h"
+#include "TileCache.h"
 #include <algorithm>
 #include <cmath>
 #include <iostream>
@@ -71,9 +73,10 @@ void BackgroundManager::render(Engine* engine) {
     
     const auto& cameraState = engine->getCameraState();
     
-    // Render each layer from back to front
-    for (const auto& layer : layers) {
-        renderLayer(layer, engine);
+    // Render each layer from back to front; over-budget frames keep only the back-most one
+    const size_t layerCount = FrameBudgetGovernor::getInstance().skipBackgroundLayers() ? 1 : layers.size();
+    for (size_t i = 0; i < layerCount; ++i) {
+        renderLayer(layers[i], engine);
     }
 }
 
@@ -146,95 +149,17 @@ void BackgroundManager::renderLayer(const BackgroundLayer& layer, Engine* engine
     float screenHeight = layerHeight * cameraScale;
     
     if (layer.tiled) {
-        // Render tiled background
-        float worldTileWidth = actualTileWidth;
-        float worldTileHeight = actualTileHeight;
-        float screenTileWidth = worldTileWidth * cameraScale;
-        float screenTileHeight = worldTileHeight * cameraScale;
-        
-        // For tiled backgrounds with parallax, calculate which tiles are visible
-        // The parallax effect: when camera is at C, layer appears at offset + C*P in world space
-        // Tiles are positioned in world space relative to the layer's parallax position
-        
-        // Calculate what world space area we need to cover
-        // For a layer with parallax P, we need to render tiles that cover the camera view
-        // but positioned according to the parallax offset
-        
-        // The camera sees world coordinates [viewMinX, viewMinX + viewWidth]
-        // The layer's world position is: offset + (cameraCenter * parallax)
-        // So we need tiles that cover this area, but accounting for parallax
-        
-        // Calculate the world space bounds we need to cover
-        // For parallax layers, we need more tiles because the layer moves slower
-        float worldViewMinX, worldViewMaxX, worldViewMinY, worldViewMaxY;
-        
-        // Calculate which world space area we need to cover
-        // The camera sees [viewMinX, viewMinX + viewWidth] in world space
-        // For parallax layers, we need to ensure tiles cover this area
-        // Tiles are positioned at: layerWorldCenter + (tileOffset)
-        // So we need tiles where (layerWorldCenter + tileOffset) covers [viewMinX, viewMinX + viewWidth]
-        
-        // Simply use the camera view bounds - tiles positioned with parallax will naturally cover it
-        worldViewMinX = cameraState.viewMinX;
-        worldViewMaxX = cameraState.viewMinX + cameraState.viewWidth;
-        worldViewMinY = cameraState.viewMinY;
-        worldViewMaxY = cameraState.viewMinY + cameraState.viewHeight;
-        
-        // Calculate tile range in world space
-        // Tiles are positioned at: layerWorldCenter + (tileIndex * tileSize)
-        // So we need tiles where: layerWorldCenter + (tileIndex * tileSize) is in [worldViewMin, worldViewMax]
-        // tileIndex = (worldPos - layerWorldCenter) / tileSize
-        
-        float tileStartWorldX = std::floor((worldViewMinX - layerWorldCenterX) / worldTileWidth) * worldTileWidth + layerWorldCenterX;
-        float tileStartWorldY = std::floor((worldViewMinY - layerWorldCenterY) / worldTileHeight) * worldTileHeight + layerWorldCenterY;
-        float tileEndWorldX = std::ceil((worldViewMaxX - layerWorldCenterX) / worldTileWidth) * worldTileWidth + layerWorldCenterX;
-        float tileEndWorldY = std::ceil((worldViewMaxY - layerWorldCenterY) / worldTileHeight) * worldTileHeight + layerWorldCenterY;
-        
-        // Calculate how many tiles to render
-        int tilesX = static_cast<int>(std::ceil((tileEndWorldX - tileStartWorldX) / worldTileWidth));
-        int tilesY = static_cast<int>(std::ceil((tileEndWorldY - tileStartWorldY) / worldTileHeight));
-        
-        // Clamp to reasonable limits to prevent performance issues
-        tilesX = std::min(tilesX, 100);
-        tilesY = std::min(tilesY, 100);
-        
-        // Render each tile
+        // Tiles sit on a grid through the layer's parallax position; TileCache covers the
+        // screen with a few pre-tiled chunks of it
         SDL_Texture* texture = SpriteManager::getInstance().getTexture(spriteData->textureName);
         if (!texture) {
             return;
         }
         
         SDL_Rect srcRect = { frameData.x, frameData.y, frameData.w, frameData.h };
-        SDL_SetTextureAlphaMod(texture, layer.alpha);
-        
-        for (int tileY = 0; tileY < tilesY; ++tileY) {
-            for (int tileX = 0; tileX < tilesX; ++tileX) {
-                // Calculate tile position directly in world space
-                // Tiles are positioned relative to the layer's world center
-                float tileWorldX = tileStartWorldX + (static_cast<float>(tileX) * worldTileWidth);
-                float tileWorldY = tileStartWorldY + (static_cast<float>(tileY) * worldTileHeight);
-                
-                // Convert tile top-left corner to screen space
-                SDL_FPoint tileScreenPos = engine->worldToScreen(tileWorldX, tileWorldY);
-                
-                // Only render if tile is visible on screen
-                if (tileScreenPos.x + screenTileWidth >= 0 && 
-                    tileScreenPos.x <= static_cast<float>(Engine::screenWidth) &&
-                    tileScreenPos.y + screenTileHeight >= 0 && 
-                    tileScreenPos.y <= static_cast<float>(Engine::screenHeight)) {
-                    
-                    // Render tile with top-left corner at screen position
-                    SDL_FRect dstRect = {
-                        tileScreenPos.x,
-                        tileScreenPos.y,
-                        screenTileWidth,
-                        screenTileHeight
-                    };
-                    
-                    SDL_RenderCopyExF(renderer, texture, &srcRect, &dstRect, 0.0f, nullptr, SDL_FLIP_NONE);
-                }
-            }
-        }
+        TileCache::getInstance().drawTiledPlane(renderer, texture, srcRect, screenPos.x, screenPos.y,
+                                                actualTileWidth * cameraScale, actualTileHeight * cameraScale,
+                                                layer.alpha);
     } else {
         // Render single sprite (stretched or at natural size)
         SDL_Texture* texture = SpriteManager::getInstance().getTexture(spriteData->textureName);
@@ -253,6 +178,8 @@ void BackgroundManager::renderLayer(const BackgroundLayer& layer, Engine* engine
         };
         
         SDL_RenderCopyExF(renderer, texture, &srcRect, &dstRect, 0.0f, nullptr, SDL_FLIP_NONE);
+        // The texture may be an atlas page shared with other sprites
+        SDL_SetTextureAlphaMod(texture, 255);
     }
 }
 
@@ -0,0 +1,91 @@
+#include "BodyMotionTracker.h"
+#include "Object.h"
+
+void BodyMotionTracker::collect(b2WorldId worldId) {
+    ++stamp;
+    moved.clear();
+
+    // Marks already carry this step's stamp (see markMoved) and are unique
+    moved.insert(moved.end(), marked.begin(), marked.end());
+    marked.clear();
+
+    if (B2_IS_NULL(worldId)) {
+        return;
+    }
+    const b2BodyEvents events = b2World_GetBodyEvents(worldId);
+    for (int i = 0; i < events.moveCount; ++i) {
+        const b2BodyMoveEvent& event = events.moveEvents[i];
+        const Object* object = static_cast<const Object*>(event.userData);
+        if (!object || object->getHandle().isNull()) {
+            continue;
+        }
+        const ObjectHandle handle = object->getHandle();
+        Slot& slot = slotFor(handle);
+        slot.asleep = event.fellAsleep;
+        slot.transform = event.transform;
+        slot.hasTransform = true;
+        if (slot.movedStamp != stamp) {
+            slot.movedStamp = stamp;
+            moved.push_back(handle);
+        }
+    }
+}
+
+void BodyMotionTracker::markMoved(ObjectHandle handle) {
+    if (handle.isNull()) {
+        return;
+    }
+    Slot& slot = slotFor(handle);
+    slot.asleep = false;
+    slot.hasTransform = false;
+    if (slot.movedStamp != stamp + 1) {
+        slot.movedStamp = stamp + 1;
+        marked.push_back(handle);
+    }
+}
+
+void BodyMotionTracker::clear() {
+    // The stamp keeps counting so consumers holding an older one see everything as moved
+    slots.clear();
+    moved.clear();
+    marked.clear();
+    ++stamp;
+}
+
+bool BodyMotionTracker::movedSince(ObjectHandle handle, uint32_t since) const {
+    const Slot* slot = find(handle);
+    return !slot || slot->movedStamp > since;
+}
+
+bool BodyMotionTracker::isAsleep(ObjectHandle handle) const {
+    const Slot* slot = find(handle);
+    return slot && slot->asleep;
+}
+
+bool BodyMotionTracker::getTransform(ObjectHandle handle, b2Transform& transform) const {
+    const Slot* slot = find(handle);
+    if (!slot || !slot->hasTransform) {
+        return false;
+    }
+    transform = slot->transform;
+    return true;
+}
+
+const BodyMotionTracker::Slot* BodyMotionTracker::find(ObjectHandle handle) const {
+    if (handle.isNull() || handle.index >= slots.size() || slots[handle.index].generation != handle.generation) {
+        return nullptr;
+    }
+    return &slots[handle.index];
+}
+
+BodyMotionTracker::Slot& BodyMotionTracker::slotFor(ObjectHandle handle) {
+    if (handle.index >= slots.size()) {
+        slots.resize(handle.index + 1);
+    }
+    Slot& slot = slots[handle.index];
+    if (slot.generation != handle.generation) {
+        slot = Slot{};
+        slot.generation = handle.generation;
+    }
+    return slot;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ObjectHandle.h"
+
+#include <box2d/box2d.h>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Per-step set of objects whose bodies moved, built from b2World_GetBodyEvents. Box2D
+ * reports every awake body after a step (flagging the ones that just fell asleep), so a
+ * body missing from the events kept its transform. SpatialIndex, HostManager, fixed-step
+ * interpolation and BodyComponent::getPosition use it to revisit only what moved.
+ *
+ * Changes that don't come out of the solver are marked by hand and folded into the next
+ * step's set: objects entering or leaving the world (Object::setInWorld), teleports
+ * (BodyComponent::setPosition) and bodies being created or destroyed.
+ */
+class BodyMotionTracker {
+public:
+    // Start a new step: fold in the marks made since the last one and read the move events
+    void collect(b2WorldId worldId);
+    void markMoved(ObjectHandle handle);
+    void clear();
+
+    // Bumped by collect; consumers remember the stamp they last looked at
+    uint32_t getStamp() const { return stamp; }
+
+    // Moved in a step after since, or marked since the last step. Unknown objects count
+    // as moved
+    bool movedSince(ObjectHandle handle, uint32_t since) const;
+
+    // Fell asleep and hasn't moved since
+    bool isAsleep(ObjectHandle handle) const;
+
+    // Transform from the object's last move event, while it's still current
+    bool getTransform(ObjectHandle handle, b2Transform& transform) const;
+
+    // Objects that moved or were marked during the last step, and marks made since
+    const std::vector<ObjectHandle>& getMoved() const { return moved; }
+    const std::vector<ObjectHandle>& getMarked() const { return marked; }
+
+private:
+    struct Slot {
+        uint32_t generation = 0;
+        uint32_t movedStamp = 0;
+        bool asleep = false;
+        bool hasTransform = false;
+        b2Transform transform = b2Transform_identity;
+    };
+
+    const Slot* find(ObjectHandle handle) const;
+    Slot& slotFor(ObjectHandle handle);
+
+    std::vector<Slot> slots;  // indexed by ObjectHandle::index
+    std::vector<ObjectHandle> moved;
+    std::vector<ObjectHandle> marked;
+    uint32_t stamp = 0;
+};
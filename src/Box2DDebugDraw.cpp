@@ -10,6 +10,8 @@
 #include "components/AdjustableComponent.h"
 #include "components/behaviors/PathfindingBehaviorComponent.h"
 #include "GlobalValueManager.h"
+#include "FrameProfiler.h"
+#include "TextRenderer.h"
 
 #include <algorithm>
 #include <cmath>
@@ -21,6 +23,8 @@
 namespace {
 constexpr int kCircleSegments = 16;
 constexpr float kPi = 3.14159265358979323846f;
+// Screen pixels labels may stack above or spread beside their object
+constexpr float kLabelCullMargin = 200.0f;
 
 Uint8 extractRed(b2HexColor color) {
     return static_cast<Uint8>((color >> 16) & 0xFF);
@@ -80,10 +84,8 @@ void Box2DDebugDraw::init(SDL_Renderer* inRenderer, float inPixelsPerMeter) {
 }
 
 void Box2DDebugDraw::shutdown() {
-    if (labelFont) {
-        TTF_CloseFont(labelFont);
-        labelFont = nullptr;
-    }
+    // The font belongs to TextRenderer
+    labelFont = nullptr;
     renderer = nullptr;
     initialized = false;
     enabled = false;
@@ -113,18 +115,14 @@ b2DebugDraw* Box2DDebugDraw::getInterface() {
 bool Box2DDebugDraw::setLabelFont(const std::string& path, int pointSize) {
     fontPath = path;
     fontSize = pointSize;
-
-    if (labelFont) {
-        TTF_CloseFont(labelFont);
-        labelFont = nullptr;
-    }
+    labelFont = nullptr;
 
     if (!TTF_WasInit()) {
         std::cerr << "SDL_ttf not initialized. Call TTF_Init() before setting fonts." << std::endl;
         return false;
     }
 
-    labelFont = TTF_OpenFont(fontPath.c_str(), fontSize);
+    labelFont = TextRenderer::getInstance().getFont(fontPath, fontSize);
     if (!labelFont) {
         std::cerr << "Failed to load debug draw font '" << fontPath << "': " << TTF_GetError() << std::endl;
         return false;
@@ -139,6 +137,14 @@ void Box2DDebugDraw::setCamera(float scale, float viewMinX, float viewMinY) {
     cameraOriginY = viewMinY;
 }
 
+bool Box2DDebugDraw::isOffScreen(float minX, float minY, float maxX, float maxY, float screenMargin) const {
+    const float scale = cameraScale > 0.0f ? cameraScale : 1.0f;
+    return (maxX - cameraOriginX) * scale < -screenMargin ||
+           (maxY - cameraOriginY) * scale < -screenMargin ||
+           (minX - cameraOriginX) * scale > static_cast<float>(Engine::screenWidth) + screenMargin ||
+           (minY - cameraOriginY) * scale > static_cast<float>(Engine::screenHeight) + screenMargin;
+}
+
 void Box2DDebugDraw::DrawPolygon(const b2Vec2* vertices, int vertexCount, b2HexColor color, void* context) {
     auto* self = static_cast<Box2DDebugDraw*>(context);
     if (!self || !self->renderer) {
@@ -323,7 +329,7 @@ bool Box2DDebugDraw::ensureFontLoaded() {
         return false;
     }
 
-    labelFont = TTF_OpenFont(fontPath.c_str(), fontSize);
+    labelFont = TextRenderer::getInstance().getFont(fontPath, fontSize);
     if (!labelFont) {
         std::cerr << "Failed to load debug draw font '" << fontPath << "': " << TTF_GetError() << std::endl;
         return false;
@@ -332,7 +338,7 @@ bool Box2DDebugDraw::ensureFontLoaded() {
     return true;
 }
 
-void Box2DDebugDraw::drawTextCentered(const std::string& text, float centerX, float y, const SDL_Color& color, int* textHeight) {
+void Box2DDebugDraw::drawTextCentered(const std::string& text, float centerX, float y, const SDL_Color& color, bool staticText) {
     if (!renderer || text.empty()) {
         return;
     }
@@ -341,33 +347,16 @@ void Box2DDebugDraw::drawTextCentered(const std::string& text, float centerX, fl
         return;
     }
 
-    SDL_Surface* surface = TTF_RenderUTF8_Blended(labelFont, text.c_str(), color);
-    if (!surface) {
-        std::cerr << "Failed to render debug draw text '" << text << "': " << TTF_GetError() << std::endl;
-        return;
-    }
-
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (!texture) {
-        std::cerr << "Failed to create texture for debug draw text '" << text << "': " << SDL_GetError() << std::endl;
-        SDL_FreeSurface(surface);
-        return;
-    }
-
-    SDL_Rect destination;
-    destination.w = surface->w;
-    destination.h = surface->h;
-    destination.x = static_cast<int>(std::round(centerX - static_cast<float>(destination.w) * 0.5f));
-    destination.y = static_cast<int>(std::round(y));
-
-    if (textHeight) {
-        *textHeight = destination.h;
+    // Changing values go through the glyph atlas; names and other fixed strings are drawn
+    // from TextRenderer's string cache
+    TextRenderer& textRenderer = TextRenderer::getInstance();
+    if (staticText) {
+        const SDL_Point size = textRenderer.measureLabel(labelFont, text);
+        textRenderer.drawLabel(labelFont, text, centerX - static_cast<float>(size.x) * 0.5f, y, color);
+    } else {
+        const SDL_Point size = textRenderer.measureText(labelFont, text);
+        textRenderer.drawText(labelFont, text, centerX - static_cast<float>(size.x) * 0.5f, y, color);
     }
-
-    SDL_RenderCopy(renderer, texture, nullptr, &destination);
-
-    SDL_DestroyTexture(texture);
-    SDL_FreeSurface(surface);
 }
 
 void Box2DDebugDraw::renderLabels(const std::vector<std::unique_ptr<Object>>& objects) {
@@ -423,7 +412,7 @@ void Box2DDebugDraw::renderLabels(const std::vector<std::unique_ptr<Object>>& ob
         // Draw lines to target objects
         std::vector<Object*> targetObjects = sensor->getTargetObjects(objects);
         for (Object* target : targetObjects) {
-            if (!target || !Object::isAlive(target)) {
+            if (!target) {
                 continue;
             }
             auto* targetBody = target->getComponent<BodyComponent>();
@@ -600,7 +589,10 @@ void Box2DDebugDraw::renderLabels(const std::vector<std::unique_ptr<Object>>& ob
         }
     }
 
-    // Second pass: Draw box zones and labels (health, name, sensor info, spawner info)
+    // Second pass: Draw box zones and labels (health, name, sensor info, spawner info),
+    // skipping objects whose labels would land off screen
+    size_t labelsDrawn = 0;
+    size_t labelsCulled = 0;
     for (const auto& objectPtr : objects) {
         if (!objectPtr) {
             continue;
@@ -613,14 +605,16 @@ void Box2DDebugDraw::renderLabels(const std::vector<std::unique_ptr<Object>>& ob
             sensor->getBoxZoneBounds(minX, minY, maxX, maxY);
             
             // Draw box zone rectangle
-            b2Vec2 vertices[4] = {
-                {minX * Engine::PIXELS_TO_METERS, minY * Engine::PIXELS_TO_METERS},
-                {maxX * Engine::PIXELS_TO_METERS, minY * Engine::PIXELS_TO_METERS},
-                {maxX * Engine::PIXELS_TO_METERS, maxY * Engine::PIXELS_TO_METERS},
-                {minX * Engine::PIXELS_TO_METERS, maxY * Engine::PIXELS_TO_METERS}
-            };
-            b2HexColor boxColor = sensor->boxZoneRequiresFull() ? static_cast<b2HexColor>(0x00FF00FF) : static_cast<b2HexColor>(0x00FF0080);  // Green, full opacity or half
-            drawPolygonImpl(vertices, 4, boxColor);
+            if (!isOffScreen(minX, minY, maxX, maxY, 0.0f)) {
+                b2Vec2 vertices[4] = {
+                    {minX * Engine::PIXELS_TO_METERS, minY * Engine::PIXELS_TO_METERS},
+                    {maxX * Engine::PIXELS_TO_METERS, minY * Engine::PIXELS_TO_METERS},
+                    {maxX * Engine::PIXELS_TO_METERS, maxY * Engine::PIXELS_TO_METERS},
+                    {minX * Engine::PIXELS_TO_METERS, maxY * Engine::PIXELS_TO_METERS}
+                };
+                b2HexColor boxColor = sensor->boxZoneRequiresFull() ? static_cast<b2HexColor>(0x00FF00FF) : static_cast<b2HexColor>(0x00FF0080);  // Green, full opacity or half
+                drawPolygonImpl(vertices, 4, boxColor);
+            }
         }
 
         auto* body = objectPtr->getComponent<BodyComponent>();
@@ -639,6 +633,13 @@ void Box2DDebugDraw::renderLabels(const std::vector<std::unique_ptr<Object>>& ob
             fixtureHeight = 32.0f;
         }
 
+        if (isOffScreen(posX - fixtureWidth * 0.5f, posY - fixtureHeight * 0.5f, posX + fixtureWidth * 0.5f,
+                        posY + fixtureHeight * 0.5f, kLabelCullMargin)) {
+            ++labelsCulled;
+            continue;
+        }
+        ++labelsDrawn;
+
         const float scale = cameraScale > 0.0f ? cameraScale : 1.0f;
         SDL_FPoint screenCenter{
             (posX - cameraOriginX) * scale,
@@ -706,7 +707,7 @@ void Box2DDebugDraw::renderLabels(const std::vector<std::unique_ptr<Object>>& ob
             std::vector<Object*> allObjectPtrs;
             allObjectPtrs.reserve(objects.size());
             for (const auto& obj : objects) {
-                if (obj && Object::isAlive(obj.get())) {
+                if (obj) {
                     allObjectPtrs.push_back(obj.get());
                 }
             }
@@ -835,11 +836,17 @@ void Box2DDebugDraw::renderLabels(const std::vector<std::unique_ptr<Object>>& ob
             }
 
             float nameTop = currentLabelTop - static_cast<float>(nameTextHeight);
-            drawTextCentered(name, screenCenter.x, nameTop, nameColor);
+            drawTextCentered(name, screenCenter.x, nameTop, nameColor, true);
             currentLabelTop = nameTop - spacing;
         }
     }
 
+    FrameProfiler& profiler = FrameProfiler::getInstance();
+    if (profiler.isEnabled()) {
+        profiler.addCounter("Debug labels drawn", static_cast<double>(labelsDrawn));
+        profiler.addCounter("Debug labels culled", static_cast<double>(labelsCulled));
+    }
+
     SDL_SetRenderDrawColor(renderer, prevR, prevG, prevB, prevA);
 }
 
@@ -45,9 +45,11 @@ private:
     void drawPointImpl(b2Vec2 p, float size, b2HexColor color);
 
     SDL_FPoint toScreen(b2Vec2 position) const;
+    // World-pixel box against the screen grown by screenMargin
+    bool isOffScreen(float minX, float minY, float maxX, float maxY, float screenMargin) const;
     void useColor(b2HexColor color);
     bool ensureFontLoaded();
-    void drawTextCentered(const std::string& text, float centerX, float y, const SDL_Color& color, int* textHeight = nullptr);
+    void drawTextCentered(const std::string& text, float centerX, float y, const SDL_Color& color, bool staticText = false);
 
     SDL_Renderer* renderer;
     float pixelsPerMeter;
@@ -59,7 +61,7 @@ private:
     float cameraOriginY;
     std::string fontPath;
     int fontSize;
-    TTF_Font* labelFont;
+    TTF_Font* labelFont;  // owned by TextRenderer
 };
 
 #endif // BOX2DDEBUGDRAW_H
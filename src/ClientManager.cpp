@@ -923,7 +923,7 @@ void ClientManager::CreateObjectFromJson(uint32_t objectId, const nlohmann::json
     // Store object ID mapping
     {
         std::lock_guard<std::mutex> lock(objectIdsMutex);
-        idToObject[objectId] = object.get();
+        idToObject[objectId] = object->getHandle();
     }
 
     // Add to engine
@@ -1095,7 +1095,7 @@ Object* ClientManager::GetObjectById(uint32_t objectId) {
     std::lock_guard<std::mutex> lock(objectIdsMutex);
     auto it = idToObject.find(objectId);
     if (it != idToObject.end()) {
-        return it->second;
+        return Object::resolve(it->second);
     }
     return nullptr;
 }
@@ -1104,8 +1104,9 @@ void ClientManager::CleanupObjectIds() {
     std::lock_guard<std::mutex> lock(objectIdsMutex);
     
     std::vector<uint32_t> toRemove;
-    for (auto& [id, obj] : idToObject) {
-        if (!Object::isAlive(obj) || obj->isMarkedForDeath()) {
+    for (auto& [id, handle] : idToObject) {
+        Object* obj = Object::resolve(handle);
+        if (!obj || obj->isMarkedForDeath()) {
             toRemove.push_back(id);
         }
     }
@@ -138,7 +138,7 @@ private:
     bool hasVerifiedInputAfterInit;  // Track if we've verified input after init package
 
     // Object ID tracking
-    std::unordered_map<uint32_t, Object*> idToObject;
+    std::unordered_map<uint32_t, ObjectHandle> idToObject;
     std::mutex objectIdsMutex;
 
     // Input tracking
@@ -0,0 +1,120 @@
+#include "ComponentLookupBenchmark.h"
+#include "Object.h"
+#include "FrameProfiler.h"
+#include "components/Component.h"
+
+#include <iostream>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+template<int N>
+class BenchComponent : public Component {
+public:
+    BenchComponent(Object& parent) : Component(parent) {}
+    void update(float) override {}
+    void draw() override {}
+    nlohmann::json toJson() const override { return nlohmann::json::object(); }
+    std::string getTypeName() const override { return "BenchComponent"; }
+};
+
+using BodyLike = BenchComponent<0>;
+using SpriteLike = BenchComponent<1>;
+using InputLike = BenchComponent<2>;
+using HealthLike = BenchComponent<3>;
+
+// The lookup Object used before the slot table: one hash map per object keyed by type_index
+struct LegacyLookup {
+    std::unordered_map<std::type_index, Component*> componentMap;
+
+    template<typename T>
+    T* getComponent() const {
+        auto it = componentMap.find(std::type_index(typeid(T)));
+        return it != componentMap.end() ? static_cast<T*>(it->second) : nullptr;
+    }
+
+    template<typename T>
+    bool hasComponent() const {
+        return componentMap.find(std::type_index(typeid(T))) != componentMap.end();
+    }
+};
+
+template<typename T>
+void addBoth(Object& object, LegacyLookup& legacy) {
+    legacy.componentMap[std::type_index(typeid(T))] = object.addComponent<T>();
+}
+
+// Per object: fetch the body, then check the other component types
+template<typename Lookup>
+size_t lookupMix(const Lookup& lookup) {
+    size_t hits = lookup.template getComponent<BodyLike>() != nullptr;
+    hits += lookup.template hasComponent<SpriteLike>();
+    hits += lookup.template hasComponent<InputLike>();
+    hits += lookup.template hasComponent<HealthLike>();
+    hits += lookup.template hasComponent<BodyLike>();
+    return hits;
+}
+
+constexpr int kLookupsPerObject = 5;
+
+template<typename Lookup>
+double timeLookups(const std::vector<const Lookup*>& lookups, int iterations, size_t& hits) {
+    uint64_t start = FrameProfiler::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (const Lookup* lookup : lookups) {
+            hits += lookupMix(*lookup);
+        }
+    }
+    uint64_t elapsed = FrameProfiler::now() - start;
+    double lookupCount = static_cast<double>(lookups.size()) * iterations * kLookupsPerObject;
+    return lookupCount > 0.0 ? static_cast<double>(elapsed) / lookupCount : 0.0;
+}
+}
+
+int runComponentLookupBenchmark(int objectCount, int iterations) {
+    std::vector<std::unique_ptr<Object>> objects;
+    std::vector<LegacyLookup> legacy(objectCount);
+    objects.reserve(objectCount);
+
+    // Mixed compositions, like a level: every object has a body, some have the rest
+    for (int i = 0; i < objectCount; ++i) {
+        auto object = std::make_unique<Object>();
+        addBoth<BodyLike>(*object, legacy[i]);
+        if (i % 2 == 0) addBoth<SpriteLike>(*object, legacy[i]);
+        if (i % 3 == 0) addBoth<InputLike>(*object, legacy[i]);
+        if (i % 5 == 0) addBoth<HealthLike>(*object, legacy[i]);
+        objects.push_back(std::move(object));
+    }
+
+    std::vector<const Object*> slotLookups;
+    std::vector<const LegacyLookup*> mapLookups;
+    for (int i = 0; i < objectCount; ++i) {
+        slotLookups.push_back(objects[i].get());
+        mapLookups.push_back(&legacy[i]);
+    }
+
+    size_t slotHits = 0;
+    size_t mapHits = 0;
+    // Warm up both paths once before timing
+    timeLookups(mapLookups, 1, mapHits);
+    timeLookups(slotLookups, 1, slotHits);
+    double mapNs = timeLookups(mapLookups, iterations, mapHits);
+    double slotNs = timeLookups(slotLookups, iterations, slotHits);
+
+    if (slotHits != mapHits) {
+        std::cerr << "Component lookup benchmark: slot table and hash map disagree ("
+                  << slotHits << " vs " << mapHits << " hits)" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Component lookups (" << objectCount << " objects x " << iterations << " iterations x "
+              << kLookupsPerObject << " lookups):" << std::endl;
+    std::cout << "  type_index hash map: " << mapNs << " ns/lookup" << std::endl;
+    std::cout << "  type ID slot table:  " << slotNs << " ns/lookup" << std::endl;
+    if (slotNs > 0.0) {
+        std::cout << "  speedup: " << mapNs / slotNs << "x" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Micro-benchmark for Object::getComponent/hasComponent. Runs the lookup mix of the hot
+// paths (one getComponent plus several hasComponent checks per object, as in
+// HostManager::SendObjectUpdates) against the slot table and against the type_index
+// hash map lookup it replaced, and prints ns per lookup for both.
+int runComponentLookupBenchmark(int objectCount, int iterations);
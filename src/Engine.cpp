@@ -11,8 +11,17 @@
 #include "menus/MenuManager.h"
 #include "components/Component.h"
 #include "components/ViewGrabComponent.h"
+#include "components/BodyComponent.h"
 #include "PlayerManager.h"
 #include "SaveManager.h"
+#include "FrameProfiler.h"
+#include "InputRecorder.h"
+#include "JobSystem.h"
+#include "TickScheduler.h"
+#include "FrameBudgetGovernor.h"
+#include "RenderQueue.h"
+#include "TileCache.h"
+#include "TextRenderer.h"
 #include <cmath>
 #include <SDL_ttf.h>
 #include <fstream>
@@ -21,7 +30,28 @@
 #include <algorithm>
 #include <filesystem>
 #include <limits>
+#include <thread>
+
+namespace {
+// Box2D sizes its per-worker scratch from workerCount (at most 64)
+constexpr unsigned kMaxPhysicsThreads = 64;
+// Frame pacing yields (instead of sleeping) only for this last stretch before the deadline
+constexpr double kPacingSpinSeconds = 0.0005;
+
+// Box2D task callbacks backed by the job pool. Box2D's worker index is the pool's thread
+// index, so workerCount covers every pool thread
+void* enqueuePhysicsTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext) {
+    JobSystem& jobs = *static_cast<JobSystem*>(userContext);
+    return jobs.submit(static_cast<size_t>(itemCount), static_cast<size_t>(std::max(minRange, 1)),
+                       [task, taskContext](size_t begin, size_t end, unsigned threadIndex) {
+                           task(static_cast<int>(begin), static_cast<int>(end), threadIndex, taskContext);
+                       });
+}
 
+void finishPhysicsTask(void* userTask, void* userContext) {
+    static_cast<JobSystem*>(userContext)->wait(static_cast<JobSystem::Task*>(userTask));
+}
+}
 
 int Engine::screenWidth = 800;
 int Engine::screenHeight = 600;
@@ -44,6 +74,11 @@ std::string Engine::getLastClientConnectError() const {
 }
 
 void Engine::init() {
+    if (headless) {
+        initHeadless();
+        return;
+    }
+
     // Initialize SDL
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         std::cerr << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
@@ -70,6 +105,7 @@ void Engine::init() {
     if (TTF_Init() == -1) {
         std::cerr << "SDL_ttf could not initialize! TTF_Error: " << TTF_GetError() << std::endl;
     }
+    TextRenderer::getInstance().init(renderer);
     
     debugDraw.init(renderer, METERS_TO_PIXELS);
     if (TTF_WasInit()) {
@@ -78,15 +114,14 @@ void Engine::init() {
         }
     }
     debugDraw.setCamera(cameraState.scale, cameraState.viewMinX, cameraState.viewMinY);
-
-    // Initialize Box2D physics world (v3.x API)
-    // Gravity: (0, 0) for top-down game, use (0, 9.8) for side-scrollers
-    b2WorldDef worldDef = b2DefaultWorldDef();
-    worldDef.gravity = {0.0f, 0.0f};
-    physicsWorldId = b2CreateWorld(&worldDef);
-    if (collisionManager) {
-        collisionManager->setWorld(physicsWorldId);
+    if (TTF_WasInit()) {
+        FrameProfiler::getInstance().setOverlayFont("assets/fonts/ARIAL.TTF", 13);
     }
+
+    // Server data also carries the physics worker count, so it's read before the world exists
+    loadServerDataConfig();
+    startPhysicsWorkers();
+    createPhysicsWorld();
     
     // Initialize sprite manager
     SpriteManager::getInstance().init(renderer, "assets/spriteData.json");
@@ -118,43 +153,209 @@ void Engine::init() {
     // This will create a default save file if one doesn't exist
     SaveManager::getInstance().loadSaveData("save.json");
     
-    // Load server connection parameters from config file
-    loadServerDataConfig();
-    
     std::cout << "SDL and Box2D initialized successfully!" << std::endl;
 }
 
+void Engine::createPhysicsWorld() {
+    objectPool.clear();
+    if (B2_IS_NON_NULL(physicsWorldId)) {
+        b2DestroyWorld(physicsWorldId);
+        physicsWorldId = b2_nullWorldId;
+        SensorEventManager::getInstance().clear();
+    }
+    if (collisionManager) {
+        collisionManager->clearImpacts();
+    }
+
+    // Initialize Box2D physics world (v3.x API)
+    // Gravity: (0, 0) for top-down game, use (0, 9.8) for side-scrollers
+    b2WorldDef worldDef = b2DefaultWorldDef();
+    worldDef.gravity = {0.0f, 0.0f};
+
+    // Let Box2D spread collision, island solving and broadphase updates over the job pool
+    JobSystem& jobs = JobSystem::getInstance();
+    const unsigned physicsThreads = jobs.getWorkerCount() + 1;
+    if (physicsThreads > kMaxPhysicsThreads) {
+        std::cerr << "Engine: " << jobs.getWorkerCount() << " job workers is more than Box2D supports ("
+                  << kMaxPhysicsThreads - 1 << "), stepping physics on the main thread" << std::endl;
+    } else if (physicsThreads > 1) {
+        worldDef.workerCount = static_cast<int>(physicsThreads);
+        worldDef.enqueueTask = enqueuePhysicsTask;
+        worldDef.finishTask = finishPhysicsTask;
+        worldDef.userTaskContext = &jobs;
+    }
+    physicsWorldId = b2CreateWorld(&worldDef);
+    if (collisionManager) {
+        collisionManager->setWorld(physicsWorldId);
+    }
+}
+
+void Engine::initHeadless() {
+    // Timer and event subsystems only: no video, audio or controllers (SDL_QUIT still arrives on SIGINT/SIGTERM)
+    if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) < 0) {
+        std::cerr << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
+        running = false;
+        return;
+    }
+
+    loadServerDataConfig();
+    startPhysicsWorkers();
+    createPhysicsWorld();
+
+    // Sprite data is still needed by components (frame counts, sizes); textures are never loaded
+    SpriteManager::getInstance().init(nullptr, "assets/spriteData.json");
+
+    // Background layers are kept so they can be sent to clients, but never drawn
+    backgroundManager = std::make_unique<BackgroundManager>();
+    backgroundManager->init(nullptr);
+
+    // SoundManager and MenuManager are left uninitialized: sound calls are no-ops and
+    // every menu call site checks for a null MenuManager
+
+    PlayerManager::getInstance().initializeDefaultAssignments();
+
+    SaveManager::getInstance().loadSaveData("save.json");
+
+    std::cout << "Box2D initialized successfully (headless)!" << std::endl;
+}
+
 void Engine::run() {
     printf("Engine running\n");
 
-    Uint32 frameTime = 1000 / targetFPS;
-    Uint32 previousTicks = SDL_GetTicks();
+    // High-resolution timing (SDL_GetTicks only has millisecond granularity)
+    const double counterFrequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    const double targetFrameSeconds = 1.0 / static_cast<double>(targetFPS);
+    Uint64 previousCounter = SDL_GetPerformanceCounter();
 
+    InputRecorder& recorder = InputRecorder::getInstance();
+    uint64_t framesRun = 0;
     while (running) {
-        Uint32 frameStartTicks = SDL_GetTicks();
-        Uint32 elapsedSinceLastFrame = frameStartTicks - previousTicks;
-        previousTicks = frameStartTicks;
-        float frameDeltaSeconds = elapsedSinceLastFrame > 0
-                                      ? static_cast<float>(elapsedSinceLastFrame) / 1000.0f
+        if (frameLimit > 0 && framesRun++ >= frameLimit) {
+            std::cout << "Engine: Frame limit of " << frameLimit << " reached" << std::endl;
+            break;
+        }
+
+        Uint64 frameStartCounter = SDL_GetPerformanceCounter();
+        double elapsedSinceLastFrame = static_cast<double>(frameStartCounter - previousCounter) / counterFrequency;
+        previousCounter = frameStartCounter;
+        float frameDeltaSeconds = elapsedSinceLastFrame > 0.0
+                                      ? static_cast<float>(elapsedSinceLastFrame)
                                       : 1.0f / static_cast<float>(targetFPS);
+        // Replay substitutes the recorded frame delta and ends the run when it runs out
+        if (!recorder.beginFrame(frameDeltaSeconds)) {
+            std::cout << "Engine: Replay finished" << std::endl;
+            break;
+        }
         deltaTime = frameDeltaSeconds;
+
+        FrameProfiler& profiler = FrameProfiler::getInstance();
+        profiler.beginFrame();
+
+        {
+            PROFILE_SCOPE("processEvents");
+            processEvents();
+        }
+        {
+            PROFILE_SCOPE("update");
+            update(deltaTime);
+        }
         
-        processEvents();
-        update(deltaTime);
-        
-        // Clear screen with black background
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
-        
-        render();
-        
-        SDL_RenderPresent(renderer);
+        if (!headless) {
+            {
+                PROFILE_SCOPE("render");
+                // Clear screen with black background
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+                SDL_RenderClear(renderer);
+                
+                render();
+            }
+            
+            {
+                PROFILE_SCOPE("present");
+                SDL_RenderPresent(renderer);
+            }
+        }
+
+        // Frame time excludes the pacing sleep below
+        profiler.endFrame();
+        double frameDuration = static_cast<double>(SDL_GetPerformanceCounter() - frameStartCounter) / counterFrequency;
+        FrameBudgetGovernor::getInstance().endFrame(frameDuration * 1000.0);
+
+        // Sleep off most of the remaining frame time, then in 1 ms steps, and yield only
+        // through the last fraction of a millisecond so pacing isn't quantized to whole
+        // milliseconds. Headless runs have no display to pace for and don't yield at all
+        auto frameRemaining = [&]() {
+            return targetFrameSeconds -
+                   static_cast<double>(SDL_GetPerformanceCounter() - frameStartCounter) / counterFrequency;
+        };
+        double remaining = targetFrameSeconds - frameDuration;
+        if (remaining > 0.002) {
+            SDL_Delay(static_cast<Uint32>((remaining - 0.001) * 1000.0));
+        }
+        while (frameRemaining() > kPacingSpinSeconds) {
+            SDL_Delay(1);
+        }
+        while (!headless && frameRemaining() > 0.0) {
+            SDL_Delay(0);
+        }
+    }
+}
+
+void Engine::setFixedTimestep(bool enabled, float simulationHz, int maxCatchUpSteps) {
+    timestepConfig.fixedStep = enabled;
+    timestepConfig.simulationHz = simulationHz > 0.0f ? simulationHz : 60.0f;
+    timestepConfig.maxCatchUpSteps = std::max(maxCatchUpSteps, 1);
+    simulationAccumulator = 0.0;
+    renderInterpolationAlpha = 1.0f;
+
+    if (enabled) {
+        std::cout << "Engine: Fixed timestep enabled (" << timestepConfig.simulationHz << " Hz, max "
+                  << timestepConfig.maxCatchUpSteps << " catch-up steps)" << std::endl;
+    }
+}
+
+int Engine::consumeSimulationSteps(float frameDelta, float& stepDelta) {
+    if (!timestepConfig.fixedStep) {
+        // Variable step: one simulation step per rendered frame
+        stepDelta = frameDelta;
+        renderInterpolationAlpha = 1.0f;
+        return 1;
+    }
+
+    const double step = 1.0 / static_cast<double>(timestepConfig.simulationHz);
+    stepDelta = static_cast<float>(step);
 
-        Uint32 frameEndTicks = SDL_GetTicks();
-        Uint32 frameDuration = frameEndTicks - frameStartTicks;
-        if (frameDuration < frameTime) {
-            SDL_Delay(frameTime - frameDuration);
+    simulationAccumulator += static_cast<double>(frameDelta);
+    int steps = static_cast<int>(simulationAccumulator / step);
+    if (steps > timestepConfig.maxCatchUpSteps) {
+        // Too far behind - drop the backlog rather than spending the next frame catching up
+        steps = timestepConfig.maxCatchUpSteps;
+        simulationAccumulator = std::fmod(simulationAccumulator, step);
+    } else {
+        simulationAccumulator -= static_cast<double>(steps) * step;
+    }
+
+    renderInterpolationAlpha = static_cast<float>(std::clamp(simulationAccumulator / step, 0.0, 1.0));
+    return steps;
+}
+
+void Engine::capturePreviousBodyTransforms() {
+    // A body that didn't move last step still holds the transform captured before its
+    // last move, which is also where it is now
+    auto capture = [](ObjectHandle handle) {
+        Object* object = Object::resolve(handle);
+        if (!object || object->isMarkedForDeath()) {
+            return;
+        }
+        if (auto* body = object->getComponent<BodyComponent>()) {
+            body->capturePreviousTransform();
         }
+    };
+    for (ObjectHandle handle : motionTracker.getMoved()) {
+        capture(handle);
+    }
+    for (ObjectHandle handle : motionTracker.getMarked()) {
+        capture(handle);
     }
 }
 
@@ -177,6 +378,11 @@ void Engine::processEvents() {
                     if (event.key.repeat == 0 && event.key.keysym.scancode == SDL_SCANCODE_F1) {
                         debugDraw.toggle();
                         std::cout << "Box2D debug draw " << (debugDraw.isEnabled() ? "enabled" : "disabled") << std::endl;
+                    } else if (event.key.repeat == 0 && event.key.keysym.scancode == SDL_SCANCODE_F2) {
+                        FrameProfiler::getInstance().toggleOverlay();
+                        std::cout << "Frame profiler overlay " << (FrameProfiler::getInstance().isOverlayVisible() ? "enabled" : "disabled") << std::endl;
+                    } else if (event.key.repeat == 0 && event.key.keysym.scancode == SDL_SCANCODE_F3) {
+                        FrameProfiler::getInstance().exportChromeTrace("frame_trace.json");
                     }
                 }
                 break;
@@ -186,6 +392,12 @@ void Engine::processEvents() {
                     onWindowResized(event.window.data1, event.window.data2);
                 }
                 break;
+
+            case SDL_RENDER_TARGETS_RESET:
+            case SDL_RENDER_DEVICE_RESET:
+                // Baked tile chunks lost their contents
+                TileCache::getInstance().clear();
+                break;
                 
             case SDL_CONTROLLERDEVICEADDED:
                 // Handle hot-plug: controller connected
@@ -204,8 +416,13 @@ void Engine::processEvents() {
     
     // Escape key quit is now handled by pause action (no longer directly quit)
     
-    // Update input manager to poll all input sources
-    InputManager::getInstance().update();
+    // Update input manager to poll all input sources (headless has no local devices)
+    if (!headless) {
+        InputManager::getInstance().update();
+    }
+    
+    // Record the polled input, or replace it with the recorded frame during replay
+    InputRecorder::getInstance().syncLocalInput();
 }
 
 void Engine::update(float deltaTime) {
@@ -213,9 +430,41 @@ void Engine::update(float deltaTime) {
 
     // Process any queued level loads first (before updating objects)
     if (!pendingLevelLoad.empty()) {
-        std::string levelToLoad = pendingLevelLoad;
+        // The level is prepared on a worker thread (usually preloaded already); until it's ready
+        // the current level keeps rendering but isn't simulated. Recorded sessions load it
+        // synchronously so replays switch levels on the same frame
+        InputRecorder& recorder = InputRecorder::getInstance();
+        bool wait = recorder.isRecording() || recorder.isReplaying();
+        if (!levelLoader.isRequested(pendingLevelLoad)) {
+            levelLoader.request(pendingLevelLoad, objectTemplates);
+        }
+        std::unique_ptr<PreparedLevel> level = levelLoader.take(pendingLevelLoad, wait);
+        if (!level && wait) {
+            level = LevelLoader::prepare(pendingLevelLoad, objectTemplates);
+        }
+        if (!level) {
+            // Menus, messages and the connection keep running while the level is prepared
+            if (menuManager) {
+                menuManager->update(deltaTime);
+            }
+            updateMessages(deltaTime);
+            if (auto host = getHostManager(); host && host->IsHosting()) {
+                PROFILE_SCOPE("HostManager::Update");
+                host->Update(deltaTime);
+            }
+            if (auto client = getClientManager(); client && client->IsConnected()) {
+                PROFILE_SCOPE("ClientManager::Update");
+                client->Update(deltaTime);
+            }
+            simulationAccumulator = 0.0;
+            renderInterpolationAlpha = 1.0f;
+            return;
+        }
+
         pendingLevelLoad.clear();  // Clear before loading to avoid recursion
-        loadFile(levelToLoad);
+        loadingQueuedLevel = true;
+        commitLevel(*level);
+        loadingQueuedLevel = false;
         return;  // Skip rest of update this frame after loading new level
     }
 
@@ -234,11 +483,16 @@ void Engine::update(float deltaTime) {
         // Don't update game objects when menu is active (except network input if hosting)
         // Still update network managers even when paused
         if (auto host = getHostManager(); host && host->IsHosting()) {
+            PROFILE_SCOPE("HostManager::Update");
             host->Update(deltaTime);
         }
         if (auto client = getClientManager(); client && client->IsConnected()) {
+            PROFILE_SCOPE("ClientManager::Update");
             client->Update(deltaTime);
         }
+        // Don't bank paused time as simulation backlog
+        simulationAccumulator = 0.0;
+        renderInterpolationAlpha = 1.0f;
         return;
     }
     
@@ -262,89 +516,228 @@ void Engine::update(float deltaTime) {
     }
     lastPauseState = currentPauseState;
 
+    float stepDelta = deltaTime;
+    int stepCount = consumeSimulationSteps(deltaTime, stepDelta);
+    for (int step = 0; step < stepCount; ++step) {
+        // Stop catching up if a step queued a level change or opened a pausing menu
+        if (!pendingLevelLoad.empty() || (menuManager && menuManager->shouldPauseGame())) {
+            break;
+        }
+        PROFILE_SCOPE("stepSimulation");
+        stepSimulation(stepDelta);
+    }
+
+    // Update HostManager (only when not paused - network updates handled in pause block)
+    if (!shouldPause) {
+        if (auto host = getHostManager(); host && host->IsHosting()) {
+            PROFILE_SCOPE("HostManager::Update");
+            host->Update(deltaTime);
+        }
+    }
+
+    // Update ClientManager (always update, even when paused - network updates need to continue)
+    if (auto client = getClientManager(); client && client->IsConnected()) {
+        {
+            PROFILE_SCOPE("ClientManager::Update");
+            client->Update(deltaTime);
+        }
+        
+        // If client is connected but hasn't received init package, open waiting menu
+        // Check this regardless of pause state and object count
+        if (!client->HasReceivedInitPackage() && menuManager) {
+            // Only open waiting menu if no menu is currently active
+            // (JoinMenu closes all menus when connection succeeds, so this will open after)
+            if (!menuManager->isMenuActive()) {
+                menuManager->openMenu("waiting_for_host");
+            }
+        }
+    }
+}
+
+void Engine::stepSimulation(float stepDelta) {
+    // Camera smoothing in applyViewBounds integrates over simulation steps
+    lastDeltaTime = stepDelta;
+
     // Step the Box2D physics simulation (v3.x API)
-    // subStepCount controls accuracy (4 is default, higher = more accurate but slower)
+    // subStepCount controls accuracy (higher = more accurate but slower); the frame budget
+    // governor lowers it towards the level's minimum while frames run over budget
+    FrameBudgetGovernor& governor = FrameBudgetGovernor::getInstance();
+    governor.beginStep();
+    {
+        // Freeze or wake bodies by distance before the step so dormant ones skip the solver
+        PROFILE_SCOPE("SimulationLod::beginStep");
+        simulationLod.beginStep(objects, stepDelta);
+    }
     if (B2_IS_NON_NULL(physicsWorldId)) {
-        b2World_Step(physicsWorldId, deltaTime, 4);
+        if (timestepConfig.fixedStep) {
+            capturePreviousBodyTransforms();
+        }
+        {
+            PROFILE_SCOPE("b2World_Step");
+            b2World_Step(physicsWorldId, stepDelta, governor.getSubSteps());
+        }
+        // Read the move events straight away, so collision and sensor handlers see this
+        // step's transforms rather than the last one's
+        motionTracker.collect(physicsWorldId);
+        FrameProfiler& profiler = FrameProfiler::getInstance();
+        if (profiler.isEnabled()) {
+            // Box2D's own breakdown of the step, timed inside the solver
+            const b2Profile physicsProfile = b2World_GetProfile(physicsWorldId);
+            profiler.addCounter("Physics step ms", physicsProfile.step);
+            profiler.addCounter("Physics collide ms", physicsProfile.collide);
+            profiler.addCounter("Physics solve ms", physicsProfile.solve);
+            profiler.addCounter("Physics tasks", b2World_GetCounters(physicsWorldId).taskCount);
+            profiler.addCounter("Physics sub-steps", governor.getSubSteps());
+            profiler.addCounter("Dormant objects", static_cast<double>(simulationLod.getDormantCount()));
+        }
         if (collisionManager) {
-            collisionManager->gatherCollisions();
-            collisionManager->processCollisions(deltaTime);
+            {
+                PROFILE_SCOPE("CollisionManager::gatherCollisions");
+                collisionManager->gatherCollisions();
+            }
+            {
+                PROFILE_SCOPE("CollisionManager::processCollisions");
+                collisionManager->processCollisions(stepDelta);
+            }
+        }
+        {
+            PROFILE_SCOPE("SensorEventManager::processWorldEvents");
+            SensorEventManager::getInstance().processWorldEvents(physicsWorldId);
         }
-        SensorEventManager::getInstance().processWorldEvents(physicsWorldId);
+    } else {
+        motionTracker.collect(physicsWorldId);
     }
     
+    {
+        PROFILE_SCOPE("SpatialIndex::sync");
+        spatialIndex.sync(objects, motionTracker);
+    }
+
     ViewGrabComponent::beginFrame();
 
     // Update all game objects
-    for (auto& object : objects) {
-        if (!object->isMarkedForDeath()) {
-            object->update(deltaTime);
+    {
+        PROFILE_SCOPE("Object updates");
+        if (ComponentPoolBase::isEnabled()) {
+            // All components of one type, then the next type, straight through each pool
+            ComponentPoolBase::updateAllPools(stepDelta);
+        } else if (JobSystem::getInstance().isParallel()) {
+            // Parallel-safe components of every object on the job workers (their deferred
+            // mutations applied in object order), then the rest object by object
+            JobSystem::getInstance().parallelForDeferred(objects.size(), 0, [this, stepDelta](size_t index) {
+                Object* object = objects[index].get();
+                if (object && !object->isMarkedForDeath()) {
+                    object->updatePhase(stepDelta, true);
+                }
+            });
+            for (auto& object : objects) {
+                if (!object->isMarkedForDeath()) {
+                    object->updatePhase(stepDelta, false);
+                }
+            }
+        } else {
+            for (auto& object : objects) {
+                if (!object->isMarkedForDeath()) {
+                    object->update(stepDelta);
+                }
+            }
         }
     }
 
+    // Components on their own cadence (Interval, OnWake) that came due this step
+    {
+        PROFILE_SCOPE("TickScheduler::advance");
+        TickScheduler::getInstance().advance(stepDelta);
+    }
+
     ViewGrabComponent::finalizeFrame(*this);
 
-    // Track objects being destroyed for HostManager
-    std::vector<Object*> destroyedObjects;
-    for (auto& object : objects) {
-        if (object->isMarkedForDeath()) {
-            destroyedObjects.push_back(object.get());
+    // Notify HostManager of destroyed objects while they are still alive (it keys them by handle)
+    auto host = getHostManager();
+    if (host && host->IsHosting()) {
+        for (auto& object : objects) {
+            if (object->isMarkedForDeath()) {
+                host->SendObjectDestroy(object.get());
+            }
         }
     }
 
-    // Remove objects that have been marked for death
-    objects.erase(
-        std::remove_if(
-            objects.begin(),
-            objects.end(),
-            [](const std::unique_ptr<Object>& object) {
-                return object->isMarkedForDeath();
-            }),
-        objects.end());
+    // Remove objects that have been marked for death; pooled ones are parked for reuse
+    {
+        PROFILE_SCOPE("Object erase");
+        for (auto& object : objects) {
+            if (object->isMarkedForDeath()) {
+                objectPool.recycle(object);
+            }
+        }
+        objects.erase(
+            std::remove_if(
+                objects.begin(),
+                objects.end(),
+                [](const std::unique_ptr<Object>& object) {
+                    return !object || object->isMarkedForDeath();
+                }),
+            objects.end());
+    }
 
     // Add any queued objects after removals
     std::vector<Object*> createdObjects;
     if (!pendingObjects.empty()) {
+        PROFILE_SCOPE("Object append");
         for (auto& pending : pendingObjects) {
             createdObjects.push_back(pending.get());
+            pending->setInWorld(true);
             objects.push_back(std::move(pending));
         }
         pendingObjects.clear();
     }
 
-    // Notify HostManager of object changes
-    if (auto host = getHostManager(); host && host->IsHosting()) {
-        for (Object* obj : destroyedObjects) {
-            host->SendObjectDestroy(obj);
-        }
+    // Notify HostManager of created objects
+    if (host && host->IsHosting()) {
         for (Object* obj : createdObjects) {
             host->SendObjectCreate(obj);
         }
     }
+}
 
-    // Update HostManager (only when not paused - network updates handled in pause block)
-    if (!shouldPause) {
-        if (auto host = getHostManager(); host && host->IsHosting()) {
-            host->Update(deltaTime);
-        }
+void Engine::setJobWorkers(unsigned workerCount) {
+    JobSystem::getInstance().start(workerCount);
+    if (workerCount > 0) {
+        std::cout << "Engine: Parallel component updates enabled (" << workerCount << " workers)" << std::endl;
     }
+}
 
-    // Update ClientManager (always update, even when paused - network updates need to continue)
-    if (auto client = getClientManager(); client && client->IsConnected()) {
-        client->Update(deltaTime);
-        
-        // If client is connected but hasn't received init package, open waiting menu
-        // Check this regardless of pause state and object count
-        if (!client->HasReceivedInitPackage() && menuManager) {
-            // Only open waiting menu if no menu is currently active
-            // (JoinMenu closes all menus when connection succeeds, so this will open after)
-            if (!menuManager->isMenuActive()) {
-                menuManager->openMenu("waiting_for_host");
-            }
-        }
+void Engine::setPhysicsWorkers(unsigned workerCount) {
+    physicsWorkers = workerCount;
+    physicsWorkersFromCommandLine = true;
+}
+
+void Engine::startPhysicsWorkers() {
+    // Physics shares the pool with parallel component updates; only grow it here
+    JobSystem& jobs = JobSystem::getInstance();
+    const unsigned requested = std::min(physicsWorkers, kMaxPhysicsThreads - 1);
+    if (requested > jobs.getWorkerCount()) {
+        jobs.start(requested);
+    }
+    if (jobs.isParallel()) {
+        std::cout << "Engine: Physics stepping on " << jobs.getWorkerCount() + 1 << " threads" << std::endl;
     }
 }
 
+void Engine::setComponentPooling(bool enabled) {
+    ComponentPoolBase::setEnabled(enabled);
+    if (enabled) {
+        std::cout << "Engine: Pooled component storage enabled (components update type by type)" << std::endl;
+    }
+}
+
+uint32_t Engine::makeRngSeed() {
+    if (Engine* engine = Object::getEngine()) {
+        return engine->nextRandomSeed();
+    }
+    return std::random_device{}();
+}
+
 float Engine::getDeltaTime() {
     return deltaTime;
 }
@@ -352,28 +745,85 @@ float Engine::getDeltaTime() {
 void Engine::render() {
     // Render background first (before all objects)
     if (backgroundManager) {
+        PROFILE_SCOPE("BackgroundManager::render");
         backgroundManager->render(this);
     }
     
-    // Render all game objects
-    for (auto& object : objects) {
-        if (!object->isMarkedForDeath()) {
+    // Render all game objects on screen
+    {
+        PROFILE_SCOPE("Object render");
+        const SpatialIndex::Bounds view = getViewBounds(CULL_MARGIN);
+        size_t drawn = 0;
+        size_t culled = 0;
+        for (auto& object : objects) {
+            if (object->isMarkedForDeath()) {
+                continue;
+            }
+            if (isOutsideView(*object, view)) {
+                ++culled;
+                continue;
+            }
             object->render(renderer);
+            ++drawn;
+        }
+
+        FrameProfiler& profiler = FrameProfiler::getInstance();
+        if (profiler.isEnabled()) {
+            profiler.addCounter("Objects drawn", static_cast<double>(drawn));
+            profiler.addCounter("Objects culled", static_cast<double>(culled));
         }
     }
+    {
+        // Sprites queued by the object pass, batched by layer and texture
+        PROFILE_SCOPE("RenderQueue::flush");
+        RenderQueue::getInstance().flush(renderer);
+    }
 
     if (debugDraw.isEnabled() && B2_IS_NON_NULL(physicsWorldId)) {
+        PROFILE_SCOPE("Debug draw");
         b2World_Draw(physicsWorldId, debugDraw.getInterface());
-        debugDraw.renderLabels(objects);
+        if (!FrameBudgetGovernor::getInstance().skipDebugLabels()) {
+            debugDraw.renderLabels(objects);
+        }
     }
     
     // Render menus on top of everything
     if (menuManager) {
+        PROFILE_SCOPE("MenuManager::render");
         menuManager->render();
     }
     
     // Render messages on top of everything (including menus)
     renderMessages();
+
+    // Profiler overlay sits above everything, next to the F1 debug draw
+    FrameProfiler::getInstance().renderOverlay(renderer);
+
+    TileCache::getInstance().endFrame();
+}
+
+SpatialIndex::Bounds Engine::getViewBounds(float margin) const {
+    const float scale = cameraState.scale > 0.0f ? cameraState.scale : 1.0f;
+    return {cameraState.viewMinX - margin, cameraState.viewMinY - margin,
+            cameraState.viewMinX + static_cast<float>(screenWidth) / scale + margin,
+            cameraState.viewMinY + static_cast<float>(screenHeight) / scale + margin};
+}
+
+bool Engine::isOutsideView(const Object& object, const SpatialIndex::Bounds& view) const {
+    // Objects without a body, or not indexed until the next step, have no bounds to go by
+    SpatialIndex::Bounds bounds;
+    if (!spatialIndex.getBounds(object.getHandle(), bounds) || bounds.overlaps(view)) {
+        return false;
+    }
+    const float overhang = object.getDrawOverhang();
+    if (!std::isfinite(overhang)) {
+        return false;
+    }
+    bounds.minX -= overhang;
+    bounds.minY -= overhang;
+    bounds.maxX += overhang;
+    bounds.maxY += overhang;
+    return !bounds.overlaps(view);
 }
 
 void Engine::onWindowResized(int width, int height) {
@@ -496,7 +946,16 @@ void Engine::cleanup() {
     cleanedUp = true;
 
     // Clean up objects before destroying physics world
+    nameIndex.clear();
     objects.clear();
+    pendingObjects.clear();
+    objectPool.clear();
+    spatialIndex.clear();
+    motionTracker.clear();
+    simulationLod.clear();
+    TickScheduler::getInstance().clear();
+    levelLoader.clear();
+    JobSystem::getInstance().stop();
     // Destroy physics world (v3.x API)
     if (B2_IS_NON_NULL(physicsWorldId)) {
         b2DestroyWorld(physicsWorldId);
@@ -520,6 +979,7 @@ void Engine::cleanup() {
         menuManager->cleanup();
         menuManager.reset();
     }
+    TextRenderer::getInstance().shutdown();
     if (renderer) {
         SDL_DestroyRenderer(renderer);
         renderer = nullptr;
@@ -529,6 +989,7 @@ void Engine::cleanup() {
         window = nullptr;
     }
     debugDraw.shutdown();
+    FrameProfiler::getInstance().shutdown();
     if (TTF_WasInit()) {
         TTF_Quit();
     }
@@ -559,6 +1020,7 @@ Engine::Engine() {
     currentMessage = nullptr;
     currentLevelOrder = 0;
     lastClientConnectError.clear();
+    Object::setEngine(this);
 }
 
 Engine::~Engine() {
@@ -566,48 +1028,39 @@ Engine::~Engine() {
 }
 
 void Engine::loadFile(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Error: Could not open file " << filename << std::endl;
-        return;
+    // Use the preloaded level if there is one (waiting if it's still being prepared)
+    std::unique_ptr<PreparedLevel> level = levelLoader.take(filename, true);
+    if (!level) {
+        level = LevelLoader::prepare(filename, objectTemplates);
     }
+    commitLevel(*level);
+}
 
-    nlohmann::json j;
-    try {
-        file >> j;
-        file.close();
-        std::cout << "JSON file parsed successfully" << std::endl;
-    } catch (const nlohmann::json::exception& e) {
-        std::cerr << "JSON parsing error: " << e.what() << std::endl;
-        file.close();
+void Engine::commitLevel(const PreparedLevel& level) {
+    if (!level.error.empty()) {
+        std::cerr << level.error << std::endl;
         return;
     }
+    const std::string& filename = level.path;
+    objectTemplates = level.templates;
 
-    // Check if this is a save file (has metadata)
-    // If so, extract just the level data (background + objects)
-    nlohmann::json levelData = j;
-    bool isSaveFile = j.contains("metadata");
-    if (isSaveFile) {
-        // This is a save file, extract level data
-        levelData = nlohmann::json::object();
-        if (j.contains("background")) {
-            levelData["background"] = j["background"];
-        }
-        if (j.contains("objects")) {
-            levelData["objects"] = j["objects"];
-        }
-        
-        // If save file has no level data, it's invalid for loading
-        if (!levelData.contains("objects") || !levelData["objects"].is_array()) {
-            std::cerr << "Error: Save file does not contain level data (objects array)" << std::endl;
-            return;
-        }
-    }
-
-    loadObjectTemplates("assets/objectData.json");
-
-    // Clear existing objects
+    // Clear existing objects (prefabs are re-registered by the new level's components)
+    nameIndex.clear();  // before the objects go, so they don't remove themselves one by one
     objects.clear();
+    objectPool.clear();
+    spatialIndex.clear();
+    motionTracker.clear();
+    simulationLod.clear();
+    TickScheduler::getInstance().clear();
+
+    // Recorded sessions start from a fresh physics world and a known RNG seed so replays
+    // don't depend on whatever was loaded before
+    InputRecorder& recorder = InputRecorder::getInstance();
+    if ((recorder.isRecording() || recorder.isReplaying()) && !loadingQueuedLevel) {
+        pendingObjects.clear();
+        createPhysicsWorld();
+    }
+    recorder.onLevelLoad(*this, filename, loadingQueuedLevel);
     pendingObjects.clear();
     if (collisionManager) {
         collisionManager->clearImpacts();
@@ -617,43 +1070,51 @@ void Engine::loadFile(const std::string& filename) {
     GlobalValueManager::getInstance().clear();
     
     // Load initial global values from level file (if present)
-    if (j.contains("globalValues") && j["globalValues"].is_object()) {
+    if (level.globalValues.is_object()) {
         GlobalValueManager& gvm = GlobalValueManager::getInstance();
-        gvm.fromJson(j["globalValues"]);
+        gvm.fromJson(level.globalValues);
         std::cout << "Engine: Loaded initial global values from level file" << std::endl;
     }
 
     // Load background configuration
     if (backgroundManager) {
-        backgroundManager->loadFromJson(levelData, this);
+        backgroundManager->loadFromJson(level.levelData, this);
     }
 
+    // Per-level quality floor and frame budget
+    auto frameBudgetIt = level.levelData.find("frameBudget");
+    FrameBudgetGovernor::getInstance().configure(
+        frameBudgetIt != level.levelData.end() ? *frameBudgetIt : nlohmann::json(), 1000.0f / static_cast<float>(targetFPS));
+
     // Set Engine instance so objects can access it
     Object::setEngine(this);
 
     // Load objects from JSON using the component library
-    if (!levelData.contains("objects") || !levelData["objects"].is_array()) {
+    if (!level.hasObjects) {
         std::cerr << "Error: JSON file must contain an 'objects' array" << std::endl;
         return;
     }
 
-    for (const auto& objectData : levelData["objects"]) {
+    // Entries were parsed and compiled by the loader; only component construction happens here
+    objects.reserve(level.objects.size());
+    for (const ObjectPrototype& prototype : level.objects) {
         auto object = std::make_unique<Object>();
-        object->fromJson(buildObjectDefinition(objectData));
+        prototype.instantiate(*object);
+        object->setInWorld(true);
         objects.push_back(std::move(object));
     }
 
     std::cout << "Loaded " << objects.size() << " objects from " << filename << std::endl;
+
+    // Build spawner output and effects up front so the first bursts don't allocate
+    objectPool.prewarm();
     
     // Extract and store the base filename (without path and extension)
     std::filesystem::path filePath(filename);
     currentLoadedLevel = filePath.stem().string();
     
     // Extract and store the level's order value
-    currentLevelOrder = 0;
-    if (j.contains("order") && j["order"].is_number_integer()) {
-        currentLevelOrder = j["order"].get<int>();
-    }
+    currentLevelOrder = level.order;
     
     // If hosting, send initialization package to all connected clients
     // Only send if the loaded level is NOT level_mainmenu
@@ -665,6 +1126,21 @@ void Engine::loadFile(const std::string& filename) {
             host->NotifyClientsHostReturnedToMenu();
         }
     }
+
+    preloadNextLevel();
+}
+
+void Engine::preloadNextLevel() {
+    // Prepare the level a win/exit from here will most likely load: the next level when this
+    // one advances progression, otherwise the main menu; from the main menu, the next unplayed level
+    int progression = SaveManager::getInstance().getLevelProgression();
+    if (currentLoadedLevel == "level_mainmenu") {
+        levelLoader.requestNextLevel(progression, objectTemplates);
+    } else if (currentLevelOrder > progression) {
+        levelLoader.requestNextLevel(currentLevelOrder, objectTemplates);
+    } else {
+        levelLoader.request("assets/levels/level_mainmenu.json", objectTemplates);
+    }
 }
 
 bool Engine::saveGame(const std::string& saveFilePath) {
@@ -820,57 +1296,19 @@ nlohmann::json Engine::mergeObjectDefinitions(const nlohmann::json& baseObject,
     return result;
 }
 
-void Engine::loadObjectTemplates(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Warning: Could not open object template file " << filename << std::endl;
-        return;
-    }
-
-    try {
-        nlohmann::json data;
-        file >> data;
-        const nlohmann::json* templatesSection = &data;
-        if (data.contains("templates") && data["templates"].is_object()) {
-            templatesSection = &data["templates"];
-        }
-
-        if (!templatesSection->is_object()) {
-            std::cerr << "Warning: Template file '" << filename << "' must contain an object of templates" << std::endl;
-            return;
-        }
-
-        objectTemplates.clear();
-        for (const auto& [name, templateData] : templatesSection->items()) {
-            objectTemplates[name] = templateData;
-        }
-    } catch (const std::exception& e) {
-        std::cerr << "Warning: Failed to parse object template file '" << filename << "': " << e.what() << std::endl;
-    }
-}
-
 nlohmann::json Engine::buildObjectDefinition(const nlohmann::json& objectData) const {
-    if (!objectData.is_object()) {
-        return objectData;
-    }
-
-    auto templateIt = objectData.find("template");
-    if (templateIt == objectData.end() || !templateIt->is_string()) {
-        return objectData;
-    }
-
-    const std::string templateName = templateIt->get<std::string>();
-    auto found = objectTemplates.find(templateName);
-    if (found == objectTemplates.end()) {
-        std::cerr << "Warning: Object template '" << templateName << "' not found" << std::endl;
+    if (!objectTemplates) {
         nlohmann::json fallback = objectData;
-        fallback.erase("template");
+        if (fallback.is_object()) {
+            fallback.erase("template");
+        }
         return fallback;
     }
+    return objectTemplates->buildObjectDefinition(objectData);
+}
 
-    nlohmann::json merged = mergeObjectDefinitions(found->second, objectData);
-    merged.erase("template");
-    return merged;
+const ObjectPrototype* Engine::findPrototype(const std::string& templateName) const {
+    return objectTemplates ? objectTemplates->findPrototype(templateName) : nullptr;
 }
 
 std::string Engine::startHosting(uint16_t hostPort, const std::string& serverManagerIP, uint16_t serverManagerPort) {
@@ -1028,31 +1466,18 @@ void Engine::renderMessages() {
         return;
     }
     
-    // Load font (larger for better visibility)
-    TTF_Font* font = TTF_OpenFont("assets/fonts/ARIAL.TTF", 28);
-    if (!font) {
-        return;
-    }
-    
-    // Render text
-    SDL_Color textColor = {255, 255, 255, 255};
-    SDL_Surface* textSurface = TTF_RenderUTF8_Blended(font, currentMessage->text.c_str(), textColor);
-    if (!textSurface) {
-        TTF_CloseFont(font);
-        return;
-    }
-    
-    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-    if (!textTexture) {
-        SDL_FreeSurface(textSurface);
-        TTF_CloseFont(font);
+    // Font opened once, and the message rendered once for as long as it shows
+    TextRenderer& text = TextRenderer::getInstance();
+    TTF_Font* font = text.getFont("assets/fonts/ARIAL.TTF", 28);
+    SDL_Point textSize = text.measureLabel(font, currentMessage->text);
+    if (textSize.x <= 0) {
         return;
     }
     
     // Calculate message position (anchored to bottom center)
     int marginBottom = 60;
-    int textWidth = textSurface->w;
-    int textHeight = textSurface->h;
+    int textWidth = textSize.x;
+    int textHeight = textSize.y;
     int bgPadding = 20;
     
     int bgX = (screenWidth - textWidth) / 2 - bgPadding;
@@ -1075,19 +1500,9 @@ void Engine::renderMessages() {
     SDL_Rect borderRect = {bgRect.x - 1, bgRect.y - 1, bgRect.w + 2, bgRect.h + 2};
     SDL_RenderDrawRect(renderer, &borderRect);
     
-    // Draw text with proper blend mode
-    SDL_SetTextureBlendMode(textTexture, SDL_BLENDMODE_BLEND);
-    SDL_Rect textRect;
-    textRect.x = bgX + bgPadding;
-    textRect.y = bgY + bgPadding;
-    textRect.w = textWidth;
-    textRect.h = textHeight;
-    SDL_RenderCopy(renderer, textTexture, nullptr, &textRect);
-    
-    // Cleanup
-    SDL_DestroyTexture(textTexture);
-    SDL_FreeSurface(textSurface);
-    TTF_CloseFont(font);
+    SDL_Color textColor = {255, 255, 255, 255};
+    text.drawLabel(font, currentMessage->text, static_cast<float>(bgX + bgPadding),
+                   static_cast<float>(bgY + bgPadding), textColor);
 }
 
 void Engine::loadServerDataConfig() {
@@ -1125,6 +1540,20 @@ void Engine::loadServerDataConfig() {
             }
         }
 
+        if (!physicsWorkersFromCommandLine && configJson.contains("physicsWorkers")
+            && configJson["physicsWorkers"].is_number_integer()) {
+            // Negative: all hardware threads but the main one, as with --physics-workers
+            int requested = configJson["physicsWorkers"].get<int>();
+            if (requested < 0) {
+                requested = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+            }
+            physicsWorkers = static_cast<unsigned>(std::max(requested, 0));
+        }
+
+        if (configJson.contains("simulationLod")) {
+            simulationLod.configure(configJson["simulationLod"]);
+        }
+
         if (loaded) {
             connectionParams.configured = true;
             std::cout << "Engine: Loaded connection parameters from " << kServerDataPath 
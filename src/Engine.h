@@ -10,8 +10,15 @@
 #include <string>
 #include <queue>
 #include <mutex>
+#include <random>
 #include <nlohmann/json.hpp>
 #include "Object.h"
+#include "ObjectPool.h"
+#include "LevelLoader.h"
+#include "NameIndex.h"
+#include "SpatialIndex.h"
+#include "BodyMotionTracker.h"
+#include "SimulationLod.h"
 #include "Box2DDebugDraw.h"
 
 class CollisionManager;
@@ -33,6 +40,19 @@ class Engine {
         std::vector<std::unique_ptr<Object>>& getObjects() { return objects; }
         void queueObject(std::unique_ptr<Object> object);
         std::vector<std::unique_ptr<Object>>& getQueuedObjects() { return pendingObjects; }
+        ObjectSlotTable& getObjectSlots() { return objectSlots; }
+        ObjectPool& getObjectPool() { return objectPool; }
+        // Objects in the object list by name (kept current as objects are added, renamed or removed)
+        NameIndex& getNameIndex() { return nameIndex; }
+        Object* findObjectByName(const std::string& name) const { return nameIndex.findFirst(name); }
+        const std::vector<ObjectHandle>& findObjectsMatching(const NameMatcher& matcher) { return nameIndex.match(matcher, objects); }
+        // Grid of body positions, synced at the start of each simulation step's object updates
+        const SpatialIndex& getSpatialIndex() const { return spatialIndex; }
+        // Objects whose bodies moved in the last simulation step (from Box2D's body move events)
+        BodyMotionTracker& getMotionTracker() { return motionTracker; }
+        const BodyMotionTracker& getMotionTracker() const { return motionTracker; }
+        // Far-away bodies frozen and their components run at a reduced rate
+        const SimulationLod& getSimulationLod() const { return simulationLod; }
         CollisionManager* getCollisionManager() { return collisionManager.get(); }
         BackgroundManager* getBackgroundManager() { return backgroundManager.get(); }
         std::shared_ptr<HostManager> getHostManager() const;
@@ -91,6 +111,14 @@ class Engine {
         // Template support for object spawning
         nlohmann::json buildObjectDefinition(const nlohmann::json& objectData) const;
         
+        // Compiled form of a template from objectData.json (nullptr if unknown)
+        const ObjectPrototype* findPrototype(const std::string& templateName) const;
+        
+        // Template merge rules for whole objects and single components (also applied by
+        // ObjectTemplateSet and ObjectPrototype overrides)
+        static nlohmann::json mergeObjectDefinitions(const nlohmann::json& baseObject, const nlohmann::json& overrides);
+        static void mergeComponentData(nlohmann::json& baseComponent, const nlohmann::json& overrideComponent);
+        
         // Display a message to the user (queued, displayed one at a time at bottom of screen)
         void displayMessage(const std::string& message);
         
@@ -103,18 +131,64 @@ class Engine {
         // Queue a level to be loaded at the start of the next frame
         void queueLevelLoad(const std::string& levelPath);
         
+        // Level with the lowest order above afterOrder ("" if none), usually already found by the preloader
+        std::string findNextLevelPath(int afterOrder) { return levelLoader.findNextLevelPath(afterOrder); }
+        
         // Set connection parameters from command-line (overrides config file values)
         void setConnectionParameters(uint16_t hostPort, const std::string& serverManagerIP, uint16_t serverManagerPort);
         
+        // Fixed-timestep simulation: physics and objects advance in constant steps of 1/simulationHz,
+        // running at most maxCatchUpSteps per frame (excess backlog is dropped instead of spiralling)
+        void setFixedTimestep(bool enabled, float simulationHz = 60.0f, int maxCatchUpSteps = 5);
+        bool isFixedTimestep() const { return timestepConfig.fixedStep; }
+        float getSimulationStep() const { return 1.0f / timestepConfig.simulationHz; }
+        int getMaxCatchUpSteps() const { return timestepConfig.maxCatchUpSteps; }
+        
+        // Blend factor between the previous and current physics state for rendering (1 = current state)
+        float getRenderInterpolationAlpha() const { return renderInterpolationAlpha; }
+        
+        // Headless mode: no window, renderer, fonts, audio or menus; simulation and networking still run.
+        // Must be set before init()
+        void setHeadless(bool enabled) { headless = enabled; }
+        bool isHeadless() const { return headless; }
+        
+        // Stop after this many frames (0 = run until quit); used for benchmarks and soak tests
+        void setFrameLimit(uint64_t frames) { frameLimit = frames; }
+        
+        // Opt-in per-type component pools updated type by type; must be set before objects are created
+        void setComponentPooling(bool enabled);
+        
+        // Run parallel-safe component updates on this many job workers (0 = all on the main thread)
+        void setJobWorkers(unsigned workerCount);
+        
+        // Job workers Box2D may use for stepping; overrides "physicsWorkers" in serverData.json.
+        // Physics uses the shared job pool, which grows to this size if --jobs asked for fewer.
+        // Must be set before init()
+        void setPhysicsWorkers(unsigned workerCount);
+        
+        // Seed stream for gameplay RNGs (spawners, weapon spread) so recorded sessions replay identically
+        void setRandomSeed(uint32_t seed) { seedGenerator.seed(seed); }
+        uint32_t nextRandomSeed() { return static_cast<uint32_t>(seedGenerator()); }
+        static uint32_t makeRngSeed();  // next seed from the active engine's stream
+        
     private:
+        void initHeadless();
+        void createPhysicsWorld();
         void loadServerDataConfig();
-        void loadObjectTemplates(const std::string& filename);
+        void startPhysicsWorkers();
+        void commitLevel(const PreparedLevel& level);
+        void preloadNextLevel();
         static void mergeJsonObjects(nlohmann::json& target, const nlohmann::json& overrides);
-        static void mergeComponentData(nlohmann::json& baseComponent, const nlohmann::json& overrideComponent);
-        static nlohmann::json mergeObjectDefinitions(const nlohmann::json& baseObject, const nlohmann::json& overrides);
         void processEvents();
         void update(float deltaTime);
+        void stepSimulation(float stepDelta);
+        int consumeSimulationSteps(float frameDelta, float& stepDelta);
+        void capturePreviousBodyTransforms();
         void render();
+        // Camera view in world pixels, grown by margin on every side
+        SpatialIndex::Bounds getViewBounds(float margin) const;
+        // True when the object's body bounds (SpatialIndex) and draw overhang miss view
+        bool isOutsideView(const Object& object, const SpatialIndex::Bounds& view) const;
         void onWindowResized(int width, int height);
         static float getDeltaTime();
         void updateMessages(float deltaTime);
@@ -123,14 +197,21 @@ class Engine {
         SDL_Renderer* renderer;
         bool running;
         bool cleanedUp;
+        ObjectSlotTable objectSlots;  // declared before the object lists so it outlives them
+        NameIndex nameIndex;  // likewise, destroyed objects remove themselves from it
+        BodyMotionTracker motionTracker;  // and mark themselves in this
         std::vector<std::unique_ptr<Object>> objects;
         std::vector<std::unique_ptr<Object>> pendingObjects;
+        ObjectPool objectPool;  // parked objects; cleared before the physics world goes away
+        SpatialIndex spatialIndex;
+        SimulationLod simulationLod;
         std::unique_ptr<CollisionManager> collisionManager;
         
         // Box2D physics world (v3.x uses handles/IDs instead of pointers)
         b2WorldId physicsWorldId;
         Box2DDebugDraw debugDraw;
-        std::unordered_map<std::string, nlohmann::json> objectTemplates;
+        std::shared_ptr<const ObjectTemplateSet> objectTemplates;  // reloaded only when objectData.json changes
+        LevelLoader levelLoader;  // queued and next levels prepared on worker threads
         std::unique_ptr<BackgroundManager> backgroundManager;
         std::shared_ptr<HostManager> hostManager;
         std::shared_ptr<ClientManager> clientManager;
@@ -145,6 +226,9 @@ class Engine {
         static constexpr float MIN_CAMERA_WIDTH = 800.0f;
         static constexpr float MIN_CAMERA_HEIGHT = 450.0f;
         static constexpr float CAMERA_SMOOTHING_RATE = 8.0f;
+        // World pixels added around the view when culling: body bounds are from the last step,
+        // sprites are drawn at the interpolated position
+        static constexpr float CULL_MARGIN = 64.0f;
         float lastDeltaTime = 1.0f / 60.0f;
         
         // Message display system
@@ -177,6 +261,26 @@ class Engine {
             uint16_t serverManagerPort = 8888;
         };
         ConnectionParams connectionParams;
+        
+        // Job workers for Box2D's task callbacks (command line, else serverData.json)
+        unsigned physicsWorkers = 0;
+        bool physicsWorkersFromCommandLine = false;
+        
+        // Simulation timestep configuration (variable step unless fixed step is enabled)
+        struct TimestepConfig {
+            bool fixedStep = false;
+            float simulationHz = 60.0f;
+            int maxCatchUpSteps = 5;
+        };
+        TimestepConfig timestepConfig;
+        double simulationAccumulator = 0.0;
+        float renderInterpolationAlpha = 1.0f;
+        
+        bool headless = false;
+        uint64_t frameLimit = 0;
+        
+        std::mt19937 seedGenerator{std::random_device{}()};
+        bool loadingQueuedLevel = false;
 };
 
 #endif // ENGINE_H
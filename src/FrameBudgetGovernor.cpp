@@ -0,0 +1,95 @@
+#include "FrameBudgetGovernor.h"
+#include "InputRecorder.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+constexpr double kSmoothing = 0.1;       // weight of the newest frame in the average
+constexpr int kOverBudgetFrames = 15;    // ~0.25 s over budget before dropping a tier
+constexpr int kHeadroomFrames = 120;     // ~2 s of headroom before restoring one
+constexpr double kHeadroomRatio = 0.75;  // "headroom" means under 75% of the budget
+constexpr int kMaxSubSteps = 16;
+}
+
+FrameBudgetGovernor& FrameBudgetGovernor::getInstance() {
+    static FrameBudgetGovernor instance;
+    return instance;
+}
+
+FrameBudgetGovernor::FrameBudgetGovernor() {
+    layoutTiers();
+}
+
+void FrameBudgetGovernor::configure(const nlohmann::json& json, float defaultBudgetMs) {
+    settings = Settings{};
+    settings.budgetMs = defaultBudgetMs;
+    if (json.is_object()) {
+        settings.budgetMs = json.value("budgetMs", settings.budgetMs);
+        settings.minSubSteps = json.value("minSubSteps", settings.minSubSteps);
+        settings.maxSubSteps = json.value("maxSubSteps", settings.maxSubSteps);
+        settings.skipBackgroundLayers = json.value("skipBackgroundLayers", settings.skipBackgroundLayers);
+        settings.throttleSensors = json.value("throttleSensors", settings.throttleSensors);
+    }
+    if (settings.budgetMs <= 0.0f) {
+        settings.budgetMs = defaultBudgetMs;
+    }
+    settings.maxSubSteps = std::clamp(settings.maxSubSteps, 1, kMaxSubSteps);
+    settings.minSubSteps = std::clamp(settings.minSubSteps, 1, settings.maxSubSteps);
+
+    layoutTiers();
+    tier = 0;
+    averageMs = 0.0;
+    overBudgetFrames = 0;
+    headroomFrames = 0;
+}
+
+void FrameBudgetGovernor::layoutTiers() {
+    // Tiers a level switches off sit past maxTier, so they're never reached
+    int next = kTierDebugLabels + (settings.maxSubSteps - settings.minSubSteps) + 1;
+    backgroundTier = settings.skipBackgroundLayers ? next++ : kMaxSubSteps * 2;
+    sensorTier = settings.throttleSensors ? next++ : kMaxSubSteps * 2;
+    maxTier = next - 1;
+}
+
+int FrameBudgetGovernor::getSubSteps() const {
+    const int dropped = std::clamp(tier - kTierDebugLabels, 0, settings.maxSubSteps - settings.minSubSteps);
+    return settings.maxSubSteps - dropped;
+}
+
+void FrameBudgetGovernor::endFrame(double workMs) {
+    // Replays have to reproduce the recorded simulation exactly
+    InputRecorder& recorder = InputRecorder::getInstance();
+    if (recorder.isRecording() || recorder.isReplaying()) {
+        setTier(0);
+        return;
+    }
+
+    averageMs = averageMs > 0.0 ? averageMs + (workMs - averageMs) * kSmoothing : workMs;
+    if (averageMs > settings.budgetMs) {
+        headroomFrames = 0;
+        if (++overBudgetFrames >= kOverBudgetFrames && tier < maxTier) {
+            setTier(tier + 1);
+        }
+    } else if (averageMs < settings.budgetMs * kHeadroomRatio) {
+        overBudgetFrames = 0;
+        if (++headroomFrames >= kHeadroomFrames && tier > 0) {
+            setTier(tier - 1);
+        }
+    } else {
+        overBudgetFrames = 0;
+        headroomFrames = 0;
+    }
+}
+
+void FrameBudgetGovernor::setTier(int newTier) {
+    overBudgetFrames = 0;
+    headroomFrames = 0;
+    if (newTier == tier) {
+        return;
+    }
+    tier = newTier;
+    std::cout << "FrameBudgetGovernor: " << averageMs << " ms average against a " << settings.budgetMs
+              << " ms budget, quality tier " << tier << "/" << maxTier << " (" << getSubSteps()
+              << " sub-steps)" << std::endl;
+}
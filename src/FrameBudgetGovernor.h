@@ -0,0 +1,78 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+
+/**
+ * Trades simulation and rendering quality for frame time. Engine reports how long each
+ * frame's work took (excluding the pacing sleep); while the smoothed cost stays over the
+ * budget the governor drops one quality tier at a time, and once there has been headroom
+ * for a while it climbs back up. Tiers, cheapest loss first:
+ *
+ *   1. skip debug-draw labels
+ *   2. one Box2D sub-step fewer per tier, down to the level's minSubSteps
+ *   3. draw only the back-most background layer
+ *   4. re-evaluate awake sensors every other step (input sensors still run every step)
+ *
+ * Levels tune it with an optional "frameBudget" block:
+ *   { "budgetMs": 16.6, "minSubSteps": 2, "maxSubSteps": 4,
+ *     "skipBackgroundLayers": true, "throttleSensors": true }
+ *
+ * Recording and replaying pin full quality, since sub-steps and sensor timing change the
+ * simulation and replays have to match the recording.
+ */
+class FrameBudgetGovernor {
+public:
+    static FrameBudgetGovernor& getInstance();
+
+    // Apply a level's "frameBudget" block (null for defaults) and return to full quality
+    void configure(const nlohmann::json& settings, float defaultBudgetMs);
+
+    // Feed the measured cost of the frame that just finished
+    void endFrame(double workMs);
+
+    // Called by Engine before each simulation step
+    void beginStep() { ++stepCounter; }
+
+    int getSubSteps() const;
+    bool skipDebugLabels() const { return tier >= kTierDebugLabels; }
+    bool skipBackgroundLayers() const { return tier >= backgroundTier; }
+
+    // True when the sensor in this object slot should sit out the current step
+    bool deferSensorUpdate(uint32_t slot) const {
+        return tier >= sensorTier && ((stepCounter + slot) & 1u) != 0;
+    }
+
+    int getTier() const { return tier; }
+
+private:
+    struct Settings {
+        float budgetMs = 1000.0f / 60.0f;
+        int minSubSteps = 2;
+        int maxSubSteps = 4;
+        bool skipBackgroundLayers = true;
+        bool throttleSensors = true;
+    };
+
+    static constexpr int kTierDebugLabels = 1;
+
+    FrameBudgetGovernor();
+    ~FrameBudgetGovernor() = default;
+    FrameBudgetGovernor(const FrameBudgetGovernor&) = delete;
+    FrameBudgetGovernor& operator=(const FrameBudgetGovernor&) = delete;
+
+    void layoutTiers();
+    void setTier(int newTier);
+
+    Settings settings;
+    int tier = 0;
+    // First tier of each optional step; past maxTier when the level turns it off
+    int backgroundTier = 0;
+    int sensorTier = 0;
+    int maxTier = 0;
+    double averageMs = 0.0;  // exponential moving average of frame cost
+    int overBudgetFrames = 0;
+    int headroomFrames = 0;
+    uint32_t stepCounter = 0;
+};
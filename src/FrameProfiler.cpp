@@ -0,0 +1,361 @@
+#include "FrameProfiler.h"
+#include "components/Component.h"
+#include "TextRenderer.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+namespace {
+constexpr size_t kMaxHistoryFrames = 600;              // ~10 seconds at 60 FPS
+constexpr uint64_t kOverlayRefreshNs = 250000000ull;   // 4 overlay refreshes per second
+constexpr size_t kMaxOverlayComponentRows = 12;
+constexpr int kOverlayMargin = 10;
+constexpr int kOverlayPadding = 6;
+
+double nsToMs(uint64_t ns) {
+    return static_cast<double>(ns) / 1000000.0;
+}
+}
+
+FrameProfiler& FrameProfiler::getInstance() {
+    static FrameProfiler instance;
+    return instance;
+}
+
+uint64_t FrameProfiler::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+FrameProfiler::FrameProfiler()
+    : enabled(false),
+      overlayVisible(false),
+      enabledByOverlay(false),
+      inFrame(false),
+      keepFullHistory(false),
+      scopeDepth(0),
+      epochNs(now()),
+      windowFrameCount(0),
+      windowStartNs(0),
+      overlayFont(nullptr) {}
+
+FrameProfiler::~FrameProfiler() {
+    // The overlay font belongs to TextRenderer, which releases it while SDL is still alive
+}
+
+void FrameProfiler::setEnabled(bool value) {
+    if (enabled == value) {
+        return;
+    }
+    enabled = value;
+    enabledByOverlay = false;
+    inFrame = false;
+    scopeDepth = 0;
+    windowFrameCount = 0;
+    windowStats.clear();
+    windowComponentStats.clear();
+    windowCounterStats.clear();
+    windowFrameStat = WindowStat{};
+    windowStartNs = now();
+    if (!enabled) {
+        overlayVisible = false;
+    }
+}
+
+void FrameProfiler::setOverlayVisible(bool visible) {
+    if (visible && !enabled) {
+        setEnabled(true);
+        enabledByOverlay = true;
+    } else if (!visible && enabledByOverlay) {
+        setEnabled(false);
+    }
+    overlayVisible = visible;
+}
+
+void FrameProfiler::toggleOverlay() {
+    setOverlayVisible(!overlayVisible);
+}
+
+void FrameProfiler::beginFrame() {
+    if (!enabled) {
+        return;
+    }
+    inFrame = true;
+    scopeDepth = 0;
+    currentFrame = FrameRecord{};
+    currentFrame.startNs = now();
+    currentComponentTotals.clear();
+}
+
+void FrameProfiler::endFrame() {
+    if (!inFrame) {
+        return;
+    }
+    inFrame = false;
+    uint64_t endNs = now();
+    currentFrame.durationNs = endNs - currentFrame.startNs;
+
+    currentFrame.componentTotals.reserve(currentComponentTotals.size());
+    for (auto& [type, total] : currentComponentTotals) {
+        currentFrame.componentTotals.push_back(std::move(total));
+    }
+    std::sort(currentFrame.componentTotals.begin(), currentFrame.componentTotals.end(),
+              [](const ComponentTotal& a, const ComponentTotal& b) { return a.durationNs > b.durationNs; });
+    currentComponentTotals.clear();
+
+    accumulateWindow(currentFrame);
+
+    history.push_back(std::move(currentFrame));
+    while (!keepFullHistory && history.size() > kMaxHistoryFrames) {
+        history.pop_front();
+    }
+}
+
+int FrameProfiler::pushScope() {
+    return scopeDepth++;
+}
+
+void FrameProfiler::popScope(const char* name, uint64_t startNs, uint64_t endNs, int depth) {
+    scopeDepth = std::max(scopeDepth - 1, 0);
+    if (!inFrame) {
+        return;
+    }
+    currentFrame.events.push_back(ScopeEvent{name, startNs, endNs - startNs, depth});
+}
+
+void FrameProfiler::recordComponentUpdate(const Component& component, uint64_t durationNs, int calls) {
+    if (!inFrame) {
+        return;
+    }
+    auto [it, inserted] = currentComponentTotals.try_emplace(std::type_index(typeid(component)));
+    if (inserted) {
+        it->second.typeName = component.getTypeName();
+    }
+    it->second.durationNs += durationNs;
+    it->second.calls += calls;
+}
+
+void FrameProfiler::addCounter(const char* name, double value) {
+    if (!inFrame) {
+        return;
+    }
+    for (auto& counter : currentFrame.counters) {
+        if (counter.first == name || std::strcmp(counter.first, name) == 0) {
+            counter.second += value;
+            return;
+        }
+    }
+    currentFrame.counters.emplace_back(name, value);
+}
+
+void FrameProfiler::accumulateWindow(const FrameRecord& frame) {
+    if (windowFrameCount == 0) {
+        windowStartNs = frame.startNs;
+    }
+    windowFrameCount++;
+
+    double frameMs = nsToMs(frame.durationNs);
+    windowFrameStat.totalMs += frameMs;
+    windowFrameStat.maxMs = std::max(windowFrameStat.maxMs, frameMs);
+
+    // A phase can run several times per frame (e.g. fixed-step catch-up), so sum per frame first
+    std::unordered_map<std::string, double> frameTotals;
+    for (const ScopeEvent& event : frame.events) {
+        frameTotals[event.name] += nsToMs(event.durationNs);
+    }
+    for (const auto& [name, ms] : frameTotals) {
+        WindowStat& stat = windowStats[name];
+        stat.totalMs += ms;
+        stat.maxMs = std::max(stat.maxMs, ms);
+    }
+    for (const ComponentTotal& total : frame.componentTotals) {
+        WindowStat& stat = windowComponentStats[total.typeName];
+        double ms = nsToMs(total.durationNs);
+        stat.totalMs += ms;
+        stat.maxMs = std::max(stat.maxMs, ms);
+    }
+    for (const auto& [name, value] : frame.counters) {
+        auto it = std::find_if(windowCounterStats.begin(), windowCounterStats.end(),
+                               [name = name](const auto& row) { return row.first == name; });
+        if (it == windowCounterStats.end()) {
+            windowCounterStats.emplace_back(name, WindowStat{});
+            it = std::prev(windowCounterStats.end());
+        }
+        it->second.totalMs += value;
+        it->second.maxMs = std::max(it->second.maxMs, value);
+    }
+
+    if (frame.startNs + frame.durationNs - windowStartNs < kOverlayRefreshNs) {
+        return;
+    }
+
+    // Window closed: order rows by nesting as seen in the latest frame
+    std::vector<ScopeEvent> ordered = frame.events;
+    std::sort(ordered.begin(), ordered.end(), [](const ScopeEvent& a, const ScopeEvent& b) {
+        if (a.startNs != b.startNs) {
+            return a.startNs < b.startNs;
+        }
+        return a.depth < b.depth;
+    });
+    windowOrder.clear();
+    for (const ScopeEvent& event : ordered) {
+        bool seen = std::any_of(windowOrder.begin(), windowOrder.end(),
+                                [&event](const auto& row) { return row.first == event.name; });
+        if (!seen) {
+            windowOrder.emplace_back(event.name, event.depth);
+        }
+    }
+
+    const double frames = static_cast<double>(windowFrameCount);
+    std::vector<std::string> lines;
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(2);
+
+    double avgFrameMs = windowFrameStat.totalMs / frames;
+    line << "Frame: " << avgFrameMs << " ms avg, " << windowFrameStat.maxMs << " ms max";
+    if (avgFrameMs > 0.0) {
+        line << " (" << std::setprecision(0) << 1000.0 / avgFrameMs << " fps busy)" << std::setprecision(2);
+    }
+    lines.push_back(line.str());
+
+    for (const auto& [name, depth] : windowOrder) {
+        const WindowStat& stat = windowStats[name];
+        line.str("");
+        line << std::string(static_cast<size_t>(depth + 1) * 2, ' ') << name << ": "
+             << stat.totalMs / frames << " ms avg, " << stat.maxMs << " ms max";
+        lines.push_back(line.str());
+    }
+
+    if (!windowComponentStats.empty()) {
+        std::vector<std::pair<std::string, WindowStat>> components(windowComponentStats.begin(), windowComponentStats.end());
+        std::sort(components.begin(), components.end(),
+                  [](const auto& a, const auto& b) { return a.second.totalMs > b.second.totalMs; });
+        lines.push_back("Component update totals:");
+        for (size_t i = 0; i < components.size() && i < kMaxOverlayComponentRows; ++i) {
+            line.str("");
+            line << "  " << components[i].first << ": " << components[i].second.totalMs / frames
+                 << " ms avg, " << components[i].second.maxMs << " ms max";
+            lines.push_back(line.str());
+        }
+    }
+
+    if (!windowCounterStats.empty()) {
+        lines.push_back("Counters (per frame):");
+        for (const auto& [name, stat] : windowCounterStats) {
+            line.str("");
+            line << "  " << name << ": " << stat.totalMs / frames << " avg, " << stat.maxMs << " max";
+            lines.push_back(line.str());
+        }
+    }
+
+    overlayText = std::move(lines);
+
+    windowStats.clear();
+    windowComponentStats.clear();
+    windowCounterStats.clear();
+    windowFrameStat = WindowStat{};
+    windowFrameCount = 0;
+}
+
+bool FrameProfiler::exportChromeTrace(const std::string& path) const {
+    if (history.empty()) {
+        std::cerr << "FrameProfiler: No frames captured, nothing to export" << std::endl;
+        return false;
+    }
+
+    auto toMicros = [this](uint64_t ns) {
+        return static_cast<double>(ns - std::min(ns, epochNs)) / 1000.0;
+    };
+
+    nlohmann::json events = nlohmann::json::array();
+    events.push_back({{"name", "process_name"}, {"ph", "M"}, {"pid", 1}, {"args", {{"name", "demo"}}}});
+    events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", 1}, {"tid", 1}, {"args", {{"name", "main"}}}});
+
+    for (const FrameRecord& frame : history) {
+        events.push_back({{"name", "Frame"}, {"cat", "frame"}, {"ph", "X"}, {"pid", 1}, {"tid", 1},
+                          {"ts", toMicros(frame.startNs)}, {"dur", static_cast<double>(frame.durationNs) / 1000.0}});
+        for (const ScopeEvent& event : frame.events) {
+            events.push_back({{"name", event.name}, {"cat", "phase"}, {"ph", "X"}, {"pid", 1}, {"tid", 1},
+                              {"ts", toMicros(event.startNs)}, {"dur", static_cast<double>(event.durationNs) / 1000.0}});
+        }
+        if (!frame.componentTotals.empty()) {
+            nlohmann::json args = nlohmann::json::object();
+            for (const ComponentTotal& total : frame.componentTotals) {
+                args[total.typeName] = nsToMs(total.durationNs);
+            }
+            events.push_back({{"name", "Component update ms"}, {"ph", "C"}, {"pid", 1}, {"tid", 1},
+                              {"ts", toMicros(frame.startNs)}, {"args", args}});
+        }
+        for (const auto& [name, value] : frame.counters) {
+            events.push_back({{"name", name}, {"ph", "C"}, {"pid", 1}, {"tid", 1},
+                              {"ts", toMicros(frame.startNs)}, {"args", {{"value", value}}}});
+        }
+    }
+
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "FrameProfiler: Failed to open trace file '" << path << "' for writing" << std::endl;
+        return false;
+    }
+    nlohmann::json trace = {{"traceEvents", events}, {"displayTimeUnit", "ms"}};
+    file << trace.dump();
+    std::cout << "FrameProfiler: Wrote " << history.size() << " frames to " << path << std::endl;
+    return true;
+}
+
+bool FrameProfiler::setOverlayFont(const std::string& path, int pointSize) {
+    overlayFont = nullptr;
+    if (!TTF_WasInit()) {
+        std::cerr << "SDL_ttf not initialized. Call TTF_Init() before setting fonts." << std::endl;
+        return false;
+    }
+    overlayFont = TextRenderer::getInstance().getFont(path, pointSize);
+    if (!overlayFont) {
+        std::cerr << "Failed to load profiler overlay font '" << path << "': " << TTF_GetError() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void FrameProfiler::renderOverlay(SDL_Renderer* renderer) {
+    if (!overlayVisible || !renderer || !overlayFont || overlayText.empty()) {
+        return;
+    }
+
+    // The lines change a few times per second, so they go through the glyph atlas
+    TextRenderer& text = TextRenderer::getInstance();
+    int panelWidth = 0;
+    int panelHeight = 0;
+    for (const std::string& line : overlayText) {
+        const SDL_Point size = text.measureText(overlayFont, line);
+        panelWidth = std::max(panelWidth, size.x);
+        panelHeight += size.y;
+    }
+
+    SDL_BlendMode previousBlend;
+    SDL_GetRenderDrawBlendMode(renderer, &previousBlend);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+    SDL_Rect panel = {kOverlayMargin, kOverlayMargin, panelWidth + kOverlayPadding * 2, panelHeight + kOverlayPadding * 2};
+    SDL_RenderFillRect(renderer, &panel);
+    SDL_SetRenderDrawBlendMode(renderer, previousBlend);
+
+    const SDL_Color textColor = {230, 230, 230, 255};
+    int y = kOverlayMargin + kOverlayPadding;
+    for (const std::string& line : overlayText) {
+        y += text.drawText(overlayFont, line, static_cast<float>(kOverlayMargin + kOverlayPadding),
+                           static_cast<float>(y), textColor).y;
+    }
+}
+
+void FrameProfiler::shutdown() {
+    overlayFont = nullptr;
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+class Component;
+
+// Collects per-phase frame timings. Scopes are only timed while the profiler is
+// enabled, so the instrumentation costs a single branch when it is off.
+class FrameProfiler {
+public:
+    static FrameProfiler& getInstance();
+
+    // Monotonic timestamp in nanoseconds
+    static uint64_t now();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return enabled; }
+
+    // Overlay visibility (showing the overlay also enables collection)
+    void setOverlayVisible(bool visible);
+    bool isOverlayVisible() const { return overlayVisible; }
+    void toggleOverlay();
+
+    // Frame boundaries (call from the main loop)
+    void beginFrame();
+    void endFrame();
+
+    // Scope bookkeeping used by ProfileScope
+    int pushScope();
+    void popScope(const char* name, uint64_t startNs, uint64_t endNs, int depth);
+
+    // Accumulate time spent in component updates (calls > 1 for a whole pooled pass)
+    void recordComponentUpdate(const Component& component, uint64_t durationNs, int calls = 1);
+
+    // Add value to a named counter for this frame (summed when recorded more than once per
+    // frame); name must outlive the profiler, like scope names
+    void addCounter(const char* name, double value);
+
+    // Keep every frame rather than only the last ~600 (a session traced on exit)
+    void setKeepFullHistory(bool keep) { keepFullHistory = keep; }
+
+    // Write the retained frame history as Chrome trace JSON (chrome://tracing / Perfetto)
+    bool exportChromeTrace(const std::string& path) const;
+
+    // Draw the overlay panel (no-op when hidden)
+    void renderOverlay(SDL_Renderer* renderer);
+    bool setOverlayFont(const std::string& path, int pointSize);
+    void shutdown();
+
+private:
+    FrameProfiler();
+    ~FrameProfiler();
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    struct ScopeEvent {
+        const char* name;
+        uint64_t startNs;
+        uint64_t durationNs;
+        int depth;
+    };
+
+    struct ComponentTotal {
+        std::string typeName;
+        uint64_t durationNs = 0;
+        int calls = 0;
+    };
+
+    struct FrameRecord {
+        uint64_t startNs = 0;
+        uint64_t durationNs = 0;
+        std::vector<ScopeEvent> events;
+        std::vector<ComponentTotal> componentTotals;
+        std::vector<std::pair<const char*, double>> counters;  // in the order first recorded
+    };
+
+    struct WindowStat {
+        double totalMs = 0.0;
+        double maxMs = 0.0;
+    };
+
+    void accumulateWindow(const FrameRecord& frame);
+
+    bool enabled;
+    bool overlayVisible;
+    bool enabledByOverlay;
+    bool inFrame;
+    bool keepFullHistory;
+    int scopeDepth;
+    uint64_t epochNs;
+
+    FrameRecord currentFrame;
+    std::unordered_map<std::type_index, ComponentTotal> currentComponentTotals;
+    std::deque<FrameRecord> history;
+
+    // Rolling window feeding the overlay; refreshed a few times per second so the
+    // text stays readable
+    std::vector<std::pair<std::string, int>> windowOrder;
+    std::unordered_map<std::string, WindowStat> windowStats;
+    std::unordered_map<std::string, WindowStat> windowComponentStats;
+    std::vector<std::pair<std::string, WindowStat>> windowCounterStats;  // totalMs/maxMs hold counter values
+    WindowStat windowFrameStat;
+    int windowFrameCount;
+    uint64_t windowStartNs;
+    std::vector<std::string> overlayText;  // drawn through TextRenderer's glyph atlas
+
+    TTF_Font* overlayFont;  // owned by TextRenderer
+};
+
+// RAII timer for a named phase; name must outlive the profiler (use string literals)
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name)
+        : name(name), active(FrameProfiler::getInstance().isEnabled()), depth(0), startNs(0) {
+        if (active) {
+            depth = FrameProfiler::getInstance().pushScope();
+            startNs = FrameProfiler::now();
+        }
+    }
+
+    ~ProfileScope() {
+        if (active) {
+            FrameProfiler::getInstance().popScope(name, startNs, FrameProfiler::now(), depth);
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name;
+    bool active;
+    int depth;
+    uint64_t startNs;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
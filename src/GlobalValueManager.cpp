@@ -15,11 +15,16 @@ float GlobalValueManager::getValue(const std::string& name) const {
 }
 
 void GlobalValueManager::setValue(const std::string& name, float value) {
+    auto it = values.find(name);
+    if (it != values.end() && it->second == value) {
+        return;
+    }
     values[name] = value;
+    markChanged(name);
 }
 
 void GlobalValueManager::modifyValue(const std::string& name, float delta) {
-    values[name] = getValue(name) + delta;
+    setValue(name, getValue(name) + delta);
 }
 
 bool GlobalValueManager::hasValue(const std::string& name) const {
@@ -27,11 +32,24 @@ bool GlobalValueManager::hasValue(const std::string& name) const {
 }
 
 void GlobalValueManager::removeValue(const std::string& name) {
-    values.erase(name);
+    if (values.erase(name) > 0) {
+        markChanged(name);
+    }
 }
 
 void GlobalValueManager::clear() {
     values.clear();
+    changeStamps.clear();
+    clearStamp = ++changeCounter;
+}
+
+uint64_t GlobalValueManager::getChangeStamp(const std::string& name) const {
+    auto it = changeStamps.find(name);
+    return it != changeStamps.end() ? it->second : clearStamp;
+}
+
+void GlobalValueManager::markChanged(const std::string& name) {
+    changeStamps[name] = ++changeCounter;
 }
 
 nlohmann::json GlobalValueManager::toJson() const {
@@ -49,7 +67,7 @@ void GlobalValueManager::fromJson(const nlohmann::json& data) {
     
     for (const auto& [key, value] : data.items()) {
         if (value.is_number()) {
-            values[key] = value.get<float>();
+            setValue(key, value.get<float>());
         }
     }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <nlohmann/json.hpp>
@@ -26,6 +27,11 @@ public:
     // Clear all values
     void clear();
     
+    // Counter value when name last changed (or was cleared); compare against
+    // getCurrentStamp() taken earlier to tell whether a value moved since then
+    uint64_t getChangeStamp(const std::string& name) const;
+    uint64_t getCurrentStamp() const { return changeCounter; }
+    
     // Serialization
     nlohmann::json toJson() const;
     void fromJson(const nlohmann::json& data);
@@ -36,6 +42,11 @@ private:
     GlobalValueManager(const GlobalValueManager&) = delete;
     GlobalValueManager& operator=(const GlobalValueManager&) = delete;
     
+    void markChanged(const std::string& name);
+    
     std::unordered_map<std::string, float> values;
+    std::unordered_map<std::string, uint64_t> changeStamps;
+    uint64_t changeCounter = 0;
+    uint64_t clearStamp = 0;
 };
 
@@ -211,6 +211,7 @@ void HostManager::Shutdown() {
     {
         std::lock_guard<std::mutex> lock(stateTrackingMutex);
         lastSentState.clear();
+        lastBodyState.clear();
     }
 
     NetworkUtils::Cleanup();
@@ -932,6 +933,8 @@ void HostManager::SendObjectUpdates() {
         return;
     }
 
+    const BodyMotionTracker& motion = engine->getMotionTracker();
+
     // Send updates for all objects
     for (const auto& obj : engine->getObjects()) {
         if (!obj || obj->isMarkedForDeath()) {
@@ -951,11 +954,28 @@ void HostManager::SendObjectUpdates() {
         // Get or assign object ID
         uint32_t objectId = GetOrAssignObjectId(obj.get());
 
+        // Body state only changes when the body moves, so a body that hasn't moved since the
+        // last sync reuses its string, and a body-only object is skipped outright
+        std::string bodyState;
+        if (hasBody) {
+            std::lock_guard<std::mutex> lock(stateTrackingMutex);
+            auto cached = lastBodyState.find(objectId);
+            bool unchanged = cached != lastBodyState.end() && !motion.movedSince(obj->getHandle(), cached->second.motionStamp);
+            if (unchanged && !hasSprite && !hasSound && !hasViewGrab && lastSentState.count(objectId)) {
+                continue;
+            }
+            if (unchanged) {
+                bodyState = cached->second.serialized;
+            } else {
+                bodyState = SerializeObjectBody(obj.get()).dump();
+                lastBodyState[objectId] = {bodyState, motion.getStamp()};
+            }
+        }
+
         // Serialize current state for comparison
         std::string currentState;
         if (hasBody) {
-            nlohmann::json bodyJson = SerializeObjectBody(obj.get());
-            currentState += bodyJson.dump() + "\n";
+            currentState += bodyState + "\n";
         }
         if (hasSprite) {
             nlohmann::json spriteJson = SerializeObjectSprite(obj.get());
@@ -1019,12 +1039,10 @@ void HostManager::SendObjectUpdates() {
         } else {
             // Uncompressed format: null-terminated strings (original format)
             if (hasBody) {
-                nlohmann::json bodyJson = SerializeObjectBody(obj.get());
-                std::string bodyStr = bodyJson.dump();
                 size_t oldSize = buffer.size();
-                buffer.resize(oldSize + bodyStr.size() + 1);
-                memcpy(buffer.data() + oldSize, bodyStr.c_str(), bodyStr.size());
-                buffer[oldSize + bodyStr.size()] = '\0';
+                buffer.resize(oldSize + bodyState.size() + 1);
+                memcpy(buffer.data() + oldSize, bodyState.c_str(), bodyState.size());
+                buffer[oldSize + bodyState.size()] = '\0';
             }
             if (hasSprite) {
                 nlohmann::json spriteJson = SerializeObjectSprite(obj.get());
@@ -1068,6 +1086,7 @@ void HostManager::SendObjectCreate(Object* obj) {
     {
         std::lock_guard<std::mutex> lock(stateTrackingMutex);
         lastSentState.erase(objectId);
+        lastBodyState.erase(objectId);
     }
     nlohmann::json objJson = SerializeObjectForSync(obj);
 
@@ -1106,7 +1125,7 @@ void HostManager::SendObjectDestroy(Object* obj) {
     // Remove from ID maps and state tracking
     {
         std::lock_guard<std::mutex> lock(objectIdsMutex);
-        objectToId.erase(obj);
+        objectToId.erase(obj->getHandle());
         idToObject.erase(objectId);
     }
     
@@ -1114,6 +1133,7 @@ void HostManager::SendObjectDestroy(Object* obj) {
     {
         std::lock_guard<std::mutex> lock(stateTrackingMutex);
         lastSentState.erase(objectId);
+        lastBodyState.erase(objectId);
     }
 }
 
@@ -1124,14 +1144,15 @@ uint32_t HostManager::GetOrAssignObjectId(Object* obj) {
 
     std::lock_guard<std::mutex> lock(objectIdsMutex);
     
-    auto it = objectToId.find(obj);
+    const ObjectHandle handle = obj->getHandle();
+    auto it = objectToId.find(handle);
     if (it != objectToId.end()) {
         return it->second;
     }
 
     uint32_t id = nextObjectId++;
-    objectToId[obj] = id;
-    idToObject[id] = obj;
+    objectToId[handle] = id;
+    idToObject[id] = handle;
     return id;
 }
 
@@ -1139,7 +1160,7 @@ Object* HostManager::GetObjectById(uint32_t objectId) {
     std::lock_guard<std::mutex> lock(objectIdsMutex);
     auto it = idToObject.find(objectId);
     if (it != idToObject.end()) {
-        return it->second;
+        return Object::resolve(it->second);
     }
     return nullptr;
 }
@@ -1147,16 +1168,17 @@ Object* HostManager::GetObjectById(uint32_t objectId) {
 void HostManager::CleanupObjectIds() {
     std::lock_guard<std::mutex> lock(objectIdsMutex);
     
-    std::vector<Object*> toRemove;
-    for (auto& [obj, id] : objectToId) {
-        if (!Object::isAlive(obj) || obj->isMarkedForDeath()) {
-            toRemove.push_back(obj);
+    std::vector<ObjectHandle> toRemove;
+    for (auto& [handle, id] : objectToId) {
+        Object* obj = Object::resolve(handle);
+        if (!obj || obj->isMarkedForDeath()) {
+            toRemove.push_back(handle);
         }
     }
 
     std::vector<uint32_t> idsToRemove;
-    for (Object* obj : toRemove) {
-        auto it = objectToId.find(obj);
+    for (ObjectHandle handle : toRemove) {
+        auto it = objectToId.find(handle);
         if (it != objectToId.end()) {
             uint32_t id = it->second;
             idsToRemove.push_back(id);
@@ -1170,6 +1192,7 @@ void HostManager::CleanupObjectIds() {
         std::lock_guard<std::mutex> stateLock(stateTrackingMutex);
         for (uint32_t id : idsToRemove) {
             lastSentState.erase(id);
+            lastBodyState.erase(id);
         }
     }
 }
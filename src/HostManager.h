@@ -237,13 +237,19 @@ private:
     std::mutex clientsMutex;
 
     // Object ID tracking
-    std::unordered_map<Object*, uint32_t> objectToId;
-    std::unordered_map<uint32_t, Object*> idToObject;
+    std::unordered_map<ObjectHandle, uint32_t> objectToId;
+    std::unordered_map<uint32_t, ObjectHandle> idToObject;
     uint32_t nextObjectId;
     std::mutex objectIdsMutex;
 
     // Object state tracking for change detection
     std::unordered_map<uint32_t, std::string> lastSentState;  // Key: objectId, Value: last serialized state
+    // Serialized body state per objectId and the BodyMotionTracker stamp it was taken at
+    struct CachedBodyState {
+        std::string serialized;
+        uint32_t motionStamp = 0;
+    };
+    std::unordered_map<uint32_t, CachedBodyState> lastBodyState;
     std::mutex stateTrackingMutex;
 
     // Sync timing
@@ -17,6 +17,9 @@ InputManager::InputManager() {
     // Initialize controller handles to nullptr
     controllers.fill(nullptr);
     
+    replayActive = false;
+    replayActiveSources = 0;
+    
     // Initialize raw device state
     keyboardState = nullptr;
     for (auto& controllerState : controllerRawStates) {
@@ -290,7 +293,8 @@ float InputManager::getInputValue(int inputSource, GameAction action) const {
 
 float InputManager::getInputValue(int inputSource, GameAction action, const std::string& configName) const {
     // If config name is empty, use the pre-computed value (backward compatibility)
-    if (configName.empty()) {
+    // Replayed input has no raw device state to re-map, so it always uses the recorded values
+    if (configName.empty() || replayActive) {
         return getInputValue(inputSource, action);
     }
     
@@ -334,6 +338,11 @@ const InputConfig* InputManager::getNamedConfig(const std::string& configName) c
 }
 
 bool InputManager::isInputSourceActive(int inputSource) const {
+    if (replayActive) {
+        int index = sourceToIndex(inputSource);
+        return index >= 0 && index < static_cast<int>(inputStates.size()) && (replayActiveSources & (1u << index)) != 0;
+    }
+    
     if (inputSource == INPUT_SOURCE_KEYBOARD) {
         return true; // Keyboard is always active
     }
@@ -346,6 +355,27 @@ bool InputManager::isInputSourceActive(int inputSource) const {
            SDL_GameControllerGetAttached(controllers[inputSource]);
 }
 
+uint8_t InputManager::getActiveSourceMask() const {
+    uint8_t mask = 0;
+    for (int source = INPUT_SOURCE_KEYBOARD; source < 4; ++source) {
+        if (isInputSourceActive(source)) {
+            mask |= static_cast<uint8_t>(1u << sourceToIndex(source));
+        }
+    }
+    return mask;
+}
+
+void InputManager::setReplayState(const InputStateTable& states, uint8_t activeSourceMask) {
+    inputStates = states;
+    replayActiveSources = activeSourceMask;
+    replayActive = true;
+}
+
+void InputManager::clearReplayState() {
+    replayActive = false;
+    replayActiveSources = 0;
+}
+
 int InputManager::getNumControllers() const {
     int count = 0;
     for (int i = 0; i < 4; ++i) {
@@ -32,6 +32,9 @@ class InputConfig;
 
 class InputManager {
 public:
+    // Per-source action states: index 0 is the keyboard, 1-4 are controllers 0-3
+    using InputStateTable = std::array<std::array<float, static_cast<size_t>(GameAction::NUM_ACTIONS)>, 5>;
+    
     static InputManager& getInstance();
     
     // Initialize input system
@@ -98,6 +101,15 @@ public:
     bool wasMouseButtonPressedThisFrame(Uint8 button) const;
     bool wasMouseButtonReleasedThisFrame(Uint8 button) const;
     
+    // Snapshot of the current per-source states and active sources (bit N = state index N)
+    const InputStateTable& getInputStates() const { return inputStates; }
+    uint8_t getActiveSourceMask() const;
+    
+    // Input replay: states and active sources come from a recording instead of devices
+    // (named configs resolve to the recorded default-config values while this is set)
+    void setReplayState(const InputStateTable& states, uint8_t activeSourceMask);
+    void clearReplayState();
+    
 private:
     InputManager();
     ~InputManager();
@@ -116,7 +128,11 @@ private:
     // Input state storage
     // First index: input source (-1 for keyboard is mapped to 0, controllers are 1+)
     // Second index: GameAction enum
-    std::array<std::array<float, static_cast<size_t>(GameAction::NUM_ACTIONS)>, 5> inputStates;
+    InputStateTable inputStates;
+    
+    // Replay override (see setReplayState)
+    bool replayActive;
+    uint8_t replayActiveSources;
     
     // Raw device state storage (for on-demand computation with named configs)
     const Uint8* keyboardState; // Raw keyboard state (updated each frame)
@@ -0,0 +1,281 @@
+#include "InputRecorder.h"
+#include "Engine.h"
+#include "PlayerManager.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+namespace {
+constexpr int kRecordingVersion = 1;
+
+bool isAllZero(const InputRecorder::ActionValues& values) {
+    for (float value : values) {
+        if (value != 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+nlohmann::json valuesToJson(const InputRecorder::ActionValues& values) {
+    return nlohmann::json(std::vector<float>(values.begin(), values.end()));
+}
+
+void valuesFromJson(const nlohmann::json& data, InputRecorder::ActionValues& values) {
+    values.fill(0.0f);
+    if (!data.is_array()) {
+        return;
+    }
+    for (size_t i = 0; i < values.size() && i < data.size(); ++i) {
+        values[i] = data[i].get<float>();
+    }
+}
+}
+
+InputRecorder& InputRecorder::getInstance() {
+    static InputRecorder instance;
+    return instance;
+}
+
+bool InputRecorder::startRecording(const std::string& path) {
+    if (mode == Mode::Replaying) {
+        std::cerr << "InputRecorder: Cannot record while replaying" << std::endl;
+        return false;
+    }
+    mode = Mode::Recording;
+    outputPath = path;
+    capturing = false;
+    frames.clear();
+    std::cout << "InputRecorder: Recording armed, capture starts at the next level load (" << path << ")" << std::endl;
+    return true;
+}
+
+bool InputRecorder::loadReplay(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "InputRecorder: Could not open recording " << path << std::endl;
+        return false;
+    }
+
+    nlohmann::json data;
+    try {
+        file >> data;
+    } catch (const nlohmann::json::exception& e) {
+        std::cerr << "InputRecorder: JSON parsing error in " << path << ": " << e.what() << std::endl;
+        return false;
+    }
+
+    if (data.value("version", 0) != kRecordingVersion) {
+        std::cerr << "InputRecorder: Unsupported recording version in " << path << std::endl;
+        return false;
+    }
+
+    levelPath = data.value("level", "");
+    seed = data.value("seed", 0u);
+    fixedStepHz = data.value("fixedStepHz", 0.0f);
+    maxCatchUpSteps = data.value("maxCatchUpSteps", 5);
+
+    frames.clear();
+    if (data.contains("frames") && data["frames"].is_array()) {
+        frames.reserve(data["frames"].size());
+        for (const auto& frameData : data["frames"]) {
+            FrameInput frame;
+            frame.delta = frameData.value("dt", 0.0f);
+            frame.activeSources = frameData.value("active", static_cast<uint8_t>(1));
+            for (auto& source : frame.sources) {
+                source.fill(0.0f);
+            }
+            if (frameData.contains("sources")) {
+                for (const auto& [key, values] : frameData["sources"].items()) {
+                    int index = std::stoi(key);
+                    if (index >= 0 && index < static_cast<int>(frame.sources.size())) {
+                        ActionValues parsed;
+                        valuesFromJson(values, parsed);
+                        frame.sources[index] = parsed;
+                    }
+                }
+            }
+            if (frameData.contains("players")) {
+                for (const auto& [key, values] : frameData["players"].items()) {
+                    ActionValues parsed;
+                    valuesFromJson(values, parsed);
+                    frame.players.emplace_back(std::stoi(key), parsed);
+                }
+            }
+            frames.push_back(std::move(frame));
+        }
+    }
+
+    if (levelPath.empty() || frames.empty()) {
+        std::cerr << "InputRecorder: Recording " << path << " has no level or no frames" << std::endl;
+        return false;
+    }
+
+    mode = Mode::Replaying;
+    replayCursor = 0;
+    replayFrame = 0;
+    inFrame = false;
+    std::cout << "InputRecorder: Loaded " << frames.size() << " frames of " << levelPath << " from " << path << std::endl;
+    return true;
+}
+
+void InputRecorder::onLevelLoad(Engine& engine, const std::string& path, bool queuedByGameplay) {
+    if (mode == Mode::Off || queuedByGameplay) {
+        return;
+    }
+
+    if (mode == Mode::Replaying) {
+        engine.setRandomSeed(seed);
+        return;
+    }
+
+    // A direct load restarts the capture so the recording always begins at a level load
+    levelPath = path;
+    seed = std::random_device{}();
+    fixedStepHz = engine.isFixedTimestep() ? 1.0f / engine.getSimulationStep() : 0.0f;
+    maxCatchUpSteps = engine.getMaxCatchUpSteps();
+    engine.setRandomSeed(seed);
+    frames.clear();
+    capturing = true;
+
+    // Loaded mid-frame (from a menu): the rest of this frame's update is part of the recording
+    if (inFrame) {
+        FrameInput frame;
+        frame.delta = currentDelta;
+        captureLocalInput(frame);
+        frames.push_back(std::move(frame));
+    }
+}
+
+bool InputRecorder::beginFrame(float& frameDelta) {
+    inFrame = true;
+
+    if (mode == Mode::Replaying) {
+        if (replayCursor >= frames.size()) {
+            return false;
+        }
+        frameDelta = frames[replayCursor].delta;
+        return true;
+    }
+
+    currentDelta = frameDelta;
+    if (mode == Mode::Recording && capturing) {
+        FrameInput frame;
+        frame.delta = frameDelta;
+        frames.push_back(std::move(frame));
+    }
+    return true;
+}
+
+void InputRecorder::syncLocalInput() {
+    if (mode == Mode::Replaying) {
+        if (replayCursor < frames.size()) {
+            const FrameInput& frame = frames[replayCursor];
+            InputManager::getInstance().setReplayState(frame.sources, frame.activeSources);
+        }
+        // Advance here rather than in beginFrame so getReplayedPlayerInput sees this frame during update
+        replayFrame = replayCursor++;
+        return;
+    }
+
+    if (mode == Mode::Recording && capturing && !frames.empty()) {
+        captureLocalInput(frames.back());
+    }
+}
+
+void InputRecorder::captureLocalInput(FrameInput& frame) const {
+    InputManager& inputManager = InputManager::getInstance();
+    frame.sources = inputManager.getInputStates();
+    frame.activeSources = inputManager.getActiveSourceMask();
+
+    // Resolved per-player values cover local devices with per-player configs and
+    // network input that HostManager delivered via setNetworkInput
+    frame.players.clear();
+    PlayerManager& playerManager = PlayerManager::getInstance();
+    for (int playerId : playerManager.getAssignedPlayerIds()) {
+        ActionValues values;
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = playerManager.getInputValue(playerId, static_cast<GameAction>(i));
+        }
+        if (!isAllZero(values)) {
+            frame.players.emplace_back(playerId, values);
+        }
+    }
+}
+
+const InputRecorder::ActionValues& InputRecorder::getReplayedPlayerInput(int playerId) const {
+    static const ActionValues noInput{};
+    if (mode != Mode::Replaying || replayFrame >= frames.size()) {
+        return noInput;
+    }
+    for (const auto& [id, values] : frames[replayFrame].players) {
+        if (id == playerId) {
+            return values;
+        }
+    }
+    return noInput;
+}
+
+bool InputRecorder::finish() {
+    if (mode == Mode::Replaying) {
+        std::cout << "InputRecorder: Replayed " << std::min(replayCursor, frames.size()) << " of "
+                  << frames.size() << " frames" << std::endl;
+        InputManager::getInstance().clearReplayState();
+        mode = Mode::Off;
+        return true;
+    }
+
+    if (mode != Mode::Recording) {
+        return false;
+    }
+    mode = Mode::Off;
+
+    if (!capturing || frames.empty()) {
+        std::cerr << "InputRecorder: No level was loaded while recording, nothing written" << std::endl;
+        return false;
+    }
+
+    nlohmann::json frameArray = nlohmann::json::array();
+    for (const FrameInput& frame : frames) {
+        nlohmann::json frameData = {{"dt", frame.delta}, {"active", frame.activeSources}};
+        nlohmann::json sources = nlohmann::json::object();
+        for (size_t i = 0; i < frame.sources.size(); ++i) {
+            if (!isAllZero(frame.sources[i])) {
+                sources[std::to_string(i)] = valuesToJson(frame.sources[i]);
+            }
+        }
+        if (!sources.empty()) {
+            frameData["sources"] = sources;
+        }
+        if (!frame.players.empty()) {
+            nlohmann::json players = nlohmann::json::object();
+            for (const auto& [playerId, values] : frame.players) {
+                players[std::to_string(playerId)] = valuesToJson(values);
+            }
+            frameData["players"] = players;
+        }
+        frameArray.push_back(std::move(frameData));
+    }
+
+    nlohmann::json data = {
+        {"version", kRecordingVersion},
+        {"level", levelPath},
+        {"seed", seed},
+        {"fixedStepHz", fixedStepHz},
+        {"maxCatchUpSteps", maxCatchUpSteps},
+        {"frames", frameArray}
+    };
+
+    std::ofstream file(outputPath);
+    if (!file.is_open()) {
+        std::cerr << "InputRecorder: Failed to open " << outputPath << " for writing" << std::endl;
+        return false;
+    }
+    file << data.dump();
+    std::cout << "InputRecorder: Wrote " << frames.size() << " frames of " << levelPath << " to " << outputPath << std::endl;
+    return true;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "InputManager.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Engine;
+
+// Records the inputs a session actually consumed (per-frame delta, per-source action
+// states and the per-player values PlayerManager resolved, which include network input
+// delivered through PlayerManager::setNetworkInput) and plays them back in place of live
+// devices so the same level can be re-simulated frame-for-frame.
+//
+// A recording starts at the most recent level loaded directly (command line, menus or
+// loadGame). Levels queued by gameplay (LevelWinComponent) are part of the recording and
+// are reproduced by the simulation itself. Mouse state is not recorded.
+class InputRecorder {
+public:
+    using ActionValues = std::array<float, static_cast<size_t>(GameAction::NUM_ACTIONS)>;
+
+    static InputRecorder& getInstance();
+
+    // Arm recording; frames are captured from the next direct level load and written by finish()
+    bool startRecording(const std::string& path);
+
+    // Load a recording for playback; the caller loads getLevelPath() before running
+    bool loadReplay(const std::string& path);
+
+    bool isRecording() const { return mode == Mode::Recording; }
+    bool isReplaying() const { return mode == Mode::Replaying; }
+
+    const std::string& getLevelPath() const { return levelPath; }
+    float getFixedStepHz() const { return fixedStepHz; }
+    int getMaxCatchUpSteps() const { return maxCatchUpSteps; }
+
+    // Called by Engine::loadFile before objects are created (reseeds the engine's RNG stream)
+    void onLevelLoad(Engine& engine, const std::string& path, bool queuedByGameplay);
+
+    // Start of a main-loop frame. Replay substitutes the recorded delta and returns false
+    // once every recorded frame has been played
+    bool beginFrame(float& frameDelta);
+
+    // After InputManager::update(): capture local input (recording) or overwrite it (replay)
+    void syncLocalInput();
+
+    // Replay only: recorded values for a player this frame (zeros if the player had no input)
+    const ActionValues& getReplayedPlayerInput(int playerId) const;
+
+    // Write the recording to disk (recording) / report completion (replay)
+    bool finish();
+
+private:
+    InputRecorder() = default;
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    enum class Mode {
+        Off,
+        Recording,
+        Replaying
+    };
+
+    struct FrameInput {
+        float delta = 0.0f;
+        InputManager::InputStateTable sources{};
+        uint8_t activeSources = 0;
+        std::vector<std::pair<int, ActionValues>> players;
+    };
+
+    void captureLocalInput(FrameInput& frame) const;
+
+    Mode mode = Mode::Off;
+    std::string outputPath;
+    std::string levelPath;
+    uint32_t seed = 0;
+    float fixedStepHz = 0.0f;
+    int maxCatchUpSteps = 5;
+
+    bool capturing = false;
+    bool inFrame = false;
+    float currentDelta = 0.0f;
+    std::vector<FrameInput> frames;
+    size_t replayCursor = 0;
+    size_t replayFrame = 0;
+};
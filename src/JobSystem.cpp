@@ -0,0 +1,292 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+
+namespace {
+// Set while a thread runs a job: nested parallelFor calls run inline, and runOrDefer
+// appends to the job's deferred list
+thread_local bool insideJob = false;
+thread_local std::vector<std::function<void()>>* deferTarget = nullptr;
+thread_local unsigned threadIndex = 0;
+
+// Chunks per thread when the caller doesn't pick a grain, so stealing can even out uneven work
+constexpr size_t kChunksPerThread = 4;
+}
+
+JobSystem& JobSystem::getInstance() {
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::~JobSystem() {
+    stop();
+}
+
+void JobSystem::start(unsigned workerCount) {
+    stop();
+    if (workerCount == 0) {
+        return;
+    }
+
+    stopping = false;
+    queues.clear();
+    for (unsigned i = 0; i <= workerCount; ++i) {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (unsigned i = 0; i < workerCount; ++i) {
+        workers.emplace_back([this, i]() { workerLoop(i + 1); });
+    }
+}
+
+void JobSystem::stop() {
+    if (workers.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+    queues.clear();
+}
+
+void JobSystem::parallelFor(size_t count, size_t grain, const std::function<void(size_t)>& body) {
+    run(count, grain, body, nullptr);
+}
+
+void JobSystem::parallelForDeferred(size_t count, size_t grain, const std::function<void(size_t)>& body) {
+    if (insideJob) {
+        // Nested pass: mutations go to the enclosing pass's apply phase
+        run(count, grain, body, nullptr);
+        return;
+    }
+
+    std::vector<DeferredList> deferred;
+    run(count, grain, body, &deferred);
+
+    // Apply phase: chunks cover ascending index ranges, so this is index order
+    for (DeferredList& list : deferred) {
+        for (auto& mutation : list) {
+            mutation();
+        }
+    }
+}
+
+void JobSystem::runOrDefer(std::function<void()> mutation) {
+    if (deferTarget) {
+        deferTarget->push_back(std::move(mutation));
+    } else {
+        mutation();
+    }
+}
+
+bool JobSystem::isInParallelPhase() {
+    return deferTarget != nullptr;
+}
+
+unsigned JobSystem::getThreadIndex() {
+    return threadIndex;
+}
+
+JobSystem::Task* JobSystem::submit(size_t count, size_t minRange, RangeTask body) {
+    if (count == 0) {
+        return nullptr;
+    }
+    if (workers.empty()) {
+        body(0, count, threadIndex);
+        return nullptr;
+    }
+
+    Task* task = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(taskMutex);
+        if (freeTasks.empty()) {
+            tasks.push_back(std::make_unique<Task>());
+            task = tasks.back().get();
+        } else {
+            task = freeTasks.back();
+            freeTasks.pop_back();
+        }
+    }
+
+    size_t threads = workers.size() + 1;
+    size_t grain = std::max<size_t>({1, minRange, count / (threads * kChunksPerThread)});
+    size_t jobCount = (count + grain - 1) / grain;
+    task->body = std::move(body);
+    task->remaining.store(jobCount, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        queuedJobs += jobCount;
+    }
+    // Worker queues only: the caller keeps going (Box2D's solver runs its own share
+    // alongside the tasks it enqueues) and picks up leftovers in wait()
+    for (size_t j = 0; j < jobCount; ++j) {
+        Job job;
+        job.task = task;
+        job.begin = j * grain;
+        job.end = std::min(count, (j + 1) * grain);
+        WorkQueue& queue = *queues[1 + j % workers.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(job);
+    }
+    wake.notify_all();
+    return task;
+}
+
+void JobSystem::wait(Task* task) {
+    if (!task) {
+        return;
+    }
+    while (task->remaining.load(std::memory_order_acquire) > 0) {
+        if (!runOneJob(threadIndex)) {
+            std::this_thread::yield();
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(taskMutex);
+        task->body = nullptr;
+        freeTasks.push_back(task);
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        std::swap(error, firstError);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void JobSystem::run(size_t count, size_t grain, const std::function<void(size_t)>& body,
+                    std::vector<DeferredList>* deferred) {
+    if (count == 0) {
+        return;
+    }
+
+    size_t threads = workers.size() + 1;
+    if (grain == 0) {
+        grain = std::max<size_t>(1, count / (threads * kChunksPerThread));
+    }
+    size_t jobCount = (count + grain - 1) / grain;
+    if (deferred) {
+        deferred->resize(jobCount);
+    }
+
+    // Serial fallback: no workers, a single chunk, or a job starting a nested pass
+    if (workers.empty() || jobCount == 1 || insideJob) {
+        for (size_t j = 0; j < jobCount; ++j) {
+            Job job{&body, j * grain, std::min(count, (j + 1) * grain), deferred ? &(*deferred)[j] : nullptr};
+            execute(job);
+        }
+    } else {
+        pendingJobs += jobCount;
+        {
+            // Counted before pushing so a thread popping early never takes the count below zero
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            queuedJobs += jobCount;
+        }
+        for (size_t j = 0; j < jobCount; ++j) {
+            Job job{&body, j * grain, std::min(count, (j + 1) * grain), deferred ? &(*deferred)[j] : nullptr};
+            WorkQueue& queue = *queues[j % threads];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back(job);
+        }
+        wake.notify_all();
+
+        while (pendingJobs.load(std::memory_order_acquire) > 0) {
+            if (!runOneJob(0)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        std::swap(error, firstError);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void JobSystem::workerLoop(size_t queueIndex) {
+    threadIndex = static_cast<unsigned>(queueIndex);
+    while (true) {
+        if (runOneJob(queueIndex)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wake.wait(lock, [this]() { return stopping.load() || queuedJobs.load() > 0; });
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+bool JobSystem::runOneJob(size_t queueIndex) {
+    Job job;
+    bool found = false;
+
+    // Own queue from the back (most recently pushed), then steal from the front of the others
+    {
+        WorkQueue& own = *queues[queueIndex];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = own.jobs.back();
+            own.jobs.pop_back();
+            found = true;
+        }
+    }
+    for (size_t offset = 1; !found && offset < queues.size(); ++offset) {
+        WorkQueue& victim = *queues[(queueIndex + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            found = true;
+        }
+    }
+    if (!found) {
+        return false;
+    }
+
+    queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    execute(job);
+    if (job.task) {
+        job.task->remaining.fetch_sub(1, std::memory_order_acq_rel);
+    } else {
+        pendingJobs.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    return true;
+}
+
+void JobSystem::execute(const Job& job) {
+    bool wasInsideJob = insideJob;
+    DeferredList* previousTarget = deferTarget;
+    insideJob = true;
+    if (job.deferred) {
+        deferTarget = job.deferred;
+    }
+    try {
+        if (job.task) {
+            job.task->body(job.begin, job.end, threadIndex);
+        } else {
+            for (size_t i = job.begin; i < job.end; ++i) {
+                (*job.body)(i);
+            }
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!firstError) {
+            firstError = std::current_exception();
+        }
+    }
+    insideJob = wasInsideJob;
+    deferTarget = previousTarget;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Work-stealing job scheduler for the parallel component update phase. parallelFor splits
+ * an index range into chunks spread over per-thread queues; each thread pops from the back
+ * of its own queue and steals from the front of the others when it runs dry. The calling
+ * thread works too, and returns once every chunk has run.
+ *
+ * Code running in a parallelForDeferred pass routes mutations of shared state (Box2D
+ * writes, spawns, markForDeath, use) through runOrDefer. They're applied on the calling
+ * thread after the pass, in index order, so results don't depend on scheduling.
+ *
+ * submit/wait expose the same queues to task systems that split their own work (Box2D's
+ * enqueueTask/finishTask): a submitted task runs on the workers while the caller carries
+ * on, and wait() helps drain the queues until it's done.
+ */
+class JobSystem {
+public:
+    static JobSystem& getInstance();
+
+    // Start workerCount worker threads (0 = run everything on the calling thread)
+    void start(unsigned workerCount);
+    void stop();
+
+    unsigned getWorkerCount() const { return static_cast<unsigned>(workers.size()); }
+    bool isParallel() const { return !workers.empty(); }
+
+    // Run body(i) for every i in [0, count); grain is the chunk size (0 = pick one)
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t)>& body);
+
+    // parallelFor whose runOrDefer calls are queued and applied in index order afterwards
+    void parallelForDeferred(size_t count, size_t grain, const std::function<void(size_t)>& body);
+
+    // Inside a parallelForDeferred pass: queue mutation for the apply phase; otherwise run it now
+    static void runOrDefer(std::function<void()> mutation);
+    static bool isInParallelPhase();
+
+    // body(begin, end, threadIndex) over [0, count) in chunks of at least minRange, queued on
+    // the workers. Returns nullptr when there are no workers and it already ran inline;
+    // otherwise the task must be passed to wait()
+    using RangeTask = std::function<void(size_t begin, size_t end, unsigned threadIndex)>;
+    struct Task {
+        RangeTask body;
+        std::atomic<size_t> remaining{0};  // chunks not finished yet
+    };
+    Task* submit(size_t count, size_t minRange, RangeTask body);
+    void wait(Task* task);
+
+    // 0 on the thread that started the pool, 1..getWorkerCount() on the workers
+    static unsigned getThreadIndex();
+
+private:
+    using DeferredList = std::vector<std::function<void()>>;
+
+    struct Job {
+        const std::function<void(size_t)>* body = nullptr;
+        size_t begin = 0;
+        size_t end = 0;
+        DeferredList* deferred = nullptr;
+        Task* task = nullptr;  // set for submit() chunks instead of body
+    };
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    JobSystem() = default;
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    void run(size_t count, size_t grain, const std::function<void(size_t)>& body, std::vector<DeferredList>* deferred);
+    void workerLoop(size_t queueIndex);
+    bool runOneJob(size_t queueIndex);
+    void execute(const Job& job);
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WorkQueue>> queues;  // [0] belongs to the calling thread
+
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    std::atomic<size_t> queuedJobs{0};   // sitting in a queue
+    std::atomic<size_t> pendingJobs{0};  // parallelFor jobs queued or running
+    std::atomic<bool> stopping{false};
+
+    // Finished tasks are reused so a physics step doesn't allocate one per callback
+    std::mutex taskMutex;
+    std::vector<std::unique_ptr<Task>> tasks;
+    std::vector<Task*> freeTasks;
+
+    std::mutex errorMutex;
+    std::exception_ptr firstError;
+};
@@ -0,0 +1,510 @@
+#include "LevelFormat.h"
+
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+constexpr char kMagic[4] = {'L', 'V', 'L', 'B'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kNoString = 0xFFFFFFFFu;
+constexpr uint32_t kNoComponents = 0xFFFFFFFFu;
+constexpr size_t kHeaderSize = 64;
+constexpr int kMaxDepth = 64;
+
+enum Flags : uint32_t {
+    kHasOrder = 1u << 0,
+    kHasObjects = 1u << 1,
+    kSaveFile = 1u << 2,
+};
+
+enum Tag : uint8_t {
+    kNull = 0,
+    kFalse,
+    kTrue,
+    kInt,
+    kUint,
+    kDouble,
+    kString,
+    kArray,
+    kObject,
+};
+
+// Header field offsets
+constexpr size_t kVersionOffset = 4;
+constexpr size_t kKindOffset = 8;
+constexpr size_t kFlagsOffset = 12;
+constexpr size_t kOrderOffset = 16;
+constexpr size_t kStringCountOffset = 20;
+constexpr size_t kStringTableOffset = 24;
+constexpr size_t kGlobalsOffset = 28;
+constexpr size_t kBackgroundOffset = 32;
+constexpr size_t kObjectCountOffset = 36;
+constexpr size_t kObjectTableOffset = 40;
+constexpr size_t kFrameBudgetOffset = 44;  // zero in files written before it existed
+constexpr size_t kSourceSizeOffset = 48;
+constexpr size_t kSourceHashOffset = 56;
+
+uint64_t readLE(const uint8_t* data, size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+class Writer {
+public:
+    Writer() : out(kHeaderSize, 0) {
+        std::memcpy(out.data(), kMagic, sizeof(kMagic));
+        patchU32(kVersionOffset, kVersion);
+    }
+
+    size_t position() const { return out.size(); }
+
+    void putU8(uint8_t value) { out.push_back(value); }
+
+    void putU32(uint32_t value) { putLE(value, 4); }
+
+    void putU64(uint64_t value) { putLE(value, 8); }
+
+    void patchU32(size_t offset, uint32_t value) {
+        for (size_t i = 0; i < 4; ++i) {
+            out[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+    }
+
+    void patchU64(size_t offset, uint64_t value) {
+        for (size_t i = 0; i < 8; ++i) {
+            out[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+    }
+
+    uint32_t intern(const std::string& text) {
+        auto it = stringIndex.find(text);
+        if (it != stringIndex.end()) {
+            return it->second;
+        }
+        uint32_t index = static_cast<uint32_t>(strings.size());
+        strings.push_back(text);
+        stringIndex.emplace(text, index);
+        return index;
+    }
+
+    void putValue(const nlohmann::json& value, int depth = 0) {
+        if (depth > kMaxDepth) {
+            throw std::runtime_error("values nested too deeply");
+        }
+        switch (value.type()) {
+            case nlohmann::json::value_t::null:
+            case nlohmann::json::value_t::discarded:
+                putU8(kNull);
+                break;
+            case nlohmann::json::value_t::boolean:
+                putU8(value.get<bool>() ? kTrue : kFalse);
+                break;
+            case nlohmann::json::value_t::number_integer:
+                putU8(kInt);
+                putU64(static_cast<uint64_t>(value.get<int64_t>()));
+                break;
+            case nlohmann::json::value_t::number_unsigned:
+                putU8(kUint);
+                putU64(value.get<uint64_t>());
+                break;
+            case nlohmann::json::value_t::number_float: {
+                double number = value.get<double>();
+                uint64_t bits;
+                std::memcpy(&bits, &number, sizeof(bits));
+                putU8(kDouble);
+                putU64(bits);
+                break;
+            }
+            case nlohmann::json::value_t::string:
+                putU8(kString);
+                putU32(intern(value.get_ref<const std::string&>()));
+                break;
+            case nlohmann::json::value_t::array:
+                putU8(kArray);
+                putU32(static_cast<uint32_t>(value.size()));
+                for (const auto& element : value) {
+                    putValue(element, depth + 1);
+                }
+                break;
+            case nlohmann::json::value_t::object:
+                putU8(kObject);
+                putU32(static_cast<uint32_t>(value.size()));
+                for (const auto& [key, element] : value.items()) {
+                    putU32(intern(key));
+                    putValue(element, depth + 1);
+                }
+                break;
+            default:
+                throw std::runtime_error("unsupported value type (binary)");
+        }
+    }
+
+    void putObjectRecord(const std::string* key, const nlohmann::json& entry) {
+        if (!entry.is_object()) {
+            throw std::runtime_error("object entries must be JSON objects");
+        }
+
+        nlohmann::json extra = nlohmann::json::object();
+        uint32_t nameIndex = kNoString;
+        uint32_t templateIndex = kNoString;
+        const nlohmann::json* components = nullptr;
+        for (const auto& [field, value] : entry.items()) {
+            if (field == "name" && value.is_string()) {
+                nameIndex = intern(value.get_ref<const std::string&>());
+            } else if (field == "template" && value.is_string()) {
+                templateIndex = intern(value.get_ref<const std::string&>());
+            } else if (field == "components" && value.is_array()) {
+                components = &value;
+            } else {
+                extra[field] = value;
+            }
+        }
+
+        putU32(key ? intern(*key) : kNoString);
+        putU32(nameIndex);
+        putU32(templateIndex);
+        putU32(components ? static_cast<uint32_t>(components->size()) : kNoComponents);
+        if (components) {
+            for (const auto& component : *components) {
+                auto typeIt = component.is_object() ? component.find("type") : component.end();
+                if (!component.is_object() || typeIt == component.end() || !typeIt->is_string()) {
+                    throw std::runtime_error("components must be objects with a string \"type\"");
+                }
+                nlohmann::json fields = component;
+                fields.erase("type");
+                putU32(intern(typeIt->get_ref<const std::string&>()));
+                putValue(fields);
+            }
+        }
+        putValue(extra);
+    }
+
+    std::vector<uint8_t> finish() {
+        patchU32(kStringCountOffset, static_cast<uint32_t>(strings.size()));
+        patchU32(kStringTableOffset, static_cast<uint32_t>(position()));
+        uint32_t offset = 0;
+        for (const std::string& text : strings) {
+            putU32(offset);
+            putU32(static_cast<uint32_t>(text.size()));
+            offset += static_cast<uint32_t>(text.size());
+        }
+        for (const std::string& text : strings) {
+            out.insert(out.end(), text.begin(), text.end());
+        }
+        if (out.size() > 0xFFFFFFFFu) {
+            throw std::runtime_error("compiled file exceeds 4 GB");
+        }
+        return std::move(out);
+    }
+
+private:
+    void putLE(uint64_t value, size_t bytes) {
+        for (size_t i = 0; i < bytes; ++i) {
+            out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    std::vector<uint8_t> out;
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, uint32_t> stringIndex;
+};
+
+std::runtime_error corrupt(const std::string& path) {
+    return std::runtime_error("corrupt compiled level " + path);
+}
+}
+
+namespace LevelFormat {
+
+std::string binaryPathFor(const std::string& sourcePath) {
+    std::filesystem::path binaryPath(sourcePath);
+    binaryPath.replace_extension(".lvlb");
+    return binaryPath.string();
+}
+
+uint64_t hashBytes(const uint8_t* data, size_t size) {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::vector<uint8_t> compile(const nlohmann::json& document, Kind kind, uint64_t sourceSize, uint64_t sourceHash) {
+    if (!document.is_object()) {
+        throw std::runtime_error("document must be a JSON object");
+    }
+
+    Writer writer;
+    writer.patchU32(kKindOffset, static_cast<uint32_t>(kind));
+    writer.patchU64(kSourceSizeOffset, sourceSize);
+    writer.patchU64(kSourceHashOffset, sourceHash);
+
+    uint32_t flags = 0;
+    std::vector<std::pair<const std::string*, const nlohmann::json*>> entries;
+    if (kind == Kind::Level) {
+        if (document.contains("metadata")) {
+            flags |= kSaveFile;
+        }
+        auto orderIt = document.find("order");
+        if (orderIt != document.end() && orderIt->is_number_integer()) {
+            flags |= kHasOrder;
+            writer.patchU32(kOrderOffset, static_cast<uint32_t>(orderIt->get<int32_t>()));
+        }
+        auto globalsIt = document.find("globalValues");
+        if (globalsIt != document.end() && globalsIt->is_object()) {
+            writer.patchU32(kGlobalsOffset, static_cast<uint32_t>(writer.position()));
+            writer.putValue(*globalsIt);
+        }
+        auto backgroundIt = document.find("background");
+        if (backgroundIt != document.end()) {
+            writer.patchU32(kBackgroundOffset, static_cast<uint32_t>(writer.position()));
+            writer.putValue(*backgroundIt);
+        }
+        auto frameBudgetIt = document.find("frameBudget");
+        if (frameBudgetIt != document.end() && frameBudgetIt->is_object()) {
+            writer.patchU32(kFrameBudgetOffset, static_cast<uint32_t>(writer.position()));
+            writer.putValue(*frameBudgetIt);
+        }
+        auto objectsIt = document.find("objects");
+        if (objectsIt != document.end() && objectsIt->is_array()) {
+            flags |= kHasObjects;
+            for (const auto& entry : *objectsIt) {
+                entries.emplace_back(nullptr, &entry);
+            }
+        }
+    } else {
+        const nlohmann::json* templates = &document;
+        if (document.contains("templates") && document["templates"].is_object()) {
+            templates = &document["templates"];
+        }
+        flags |= kHasObjects;
+        for (auto it = templates->begin(); it != templates->end(); ++it) {
+            entries.emplace_back(&it.key(), &it.value());
+        }
+    }
+    writer.patchU32(kFlagsOffset, flags);
+
+    // Object table, then the records it points at
+    size_t table = writer.position();
+    writer.patchU32(kObjectCountOffset, static_cast<uint32_t>(entries.size()));
+    writer.patchU32(kObjectTableOffset, static_cast<uint32_t>(table));
+    for (size_t i = 0; i < entries.size(); ++i) {
+        writer.putU32(0);
+    }
+    for (size_t i = 0; i < entries.size(); ++i) {
+        writer.patchU32(table + i * 4, static_cast<uint32_t>(writer.position()));
+        writer.putObjectRecord(entries[i].first, *entries[i].second);
+    }
+    return writer.finish();
+}
+
+}
+
+bool BinaryLevel::openFor(const std::string& sourcePath, LevelFormat::Kind kind) {
+    path = LevelFormat::binaryPathFor(sourcePath);
+    if (!file.open(path)) {
+        return false;
+    }
+
+    const uint8_t* data = file.data();
+    if (file.size() < kHeaderSize || std::memcmp(data, kMagic, sizeof(kMagic)) != 0 ||
+        readU32(kVersionOffset) != kVersion || readU32(kKindOffset) != static_cast<uint32_t>(kind)) {
+        std::cerr << "Warning: Ignoring " << path << " (not a compatible compiled level)" << std::endl;
+        file.close();
+        return false;
+    }
+
+    // Only use the compiled file if it was built from the source's current contents
+    MappedFile source;
+    if (source.open(sourcePath)) {
+        uint64_t sourceSize = readLE(data + kSourceSizeOffset, 8);
+        uint64_t sourceHash = readLE(data + kSourceHashOffset, 8);
+        if (source.size() != sourceSize || LevelFormat::hashBytes(source.data(), source.size()) != sourceHash) {
+            std::cout << "Compiled level " << path << " is out of date, loading " << sourcePath << std::endl;
+            file.close();
+            return false;
+        }
+    }
+
+    flags = readU32(kFlagsOffset);
+    order = static_cast<int32_t>(readU32(kOrderOffset));
+    stringCount = readU32(kStringCountOffset);
+    stringTableOffset = readU32(kStringTableOffset);
+    globalsOffset = readU32(kGlobalsOffset);
+    backgroundOffset = readU32(kBackgroundOffset);
+    frameBudgetOffset = readU32(kFrameBudgetOffset);
+    objectCount = readU32(kObjectCountOffset);
+    objectTableOffset = readU32(kObjectTableOffset);
+    if (stringTableOffset + static_cast<uint64_t>(stringCount) * 8 > file.size() ||
+        objectTableOffset + static_cast<uint64_t>(objectCount) * 4 > file.size()) {
+        std::cerr << "Warning: Ignoring " << path << " (truncated)" << std::endl;
+        file.close();
+        return false;
+    }
+    return true;
+}
+
+bool BinaryLevel::isSaveFile() const {
+    return (flags & kSaveFile) != 0;
+}
+
+bool BinaryLevel::hasOrder() const {
+    return (flags & kHasOrder) != 0;
+}
+
+int BinaryLevel::getOrder() const {
+    return order;
+}
+
+bool BinaryLevel::hasObjects() const {
+    return (flags & kHasObjects) != 0;
+}
+
+nlohmann::json BinaryLevel::getGlobalValues() const {
+    size_t offset = globalsOffset;
+    return offset ? readValue(offset) : nlohmann::json();
+}
+
+nlohmann::json BinaryLevel::getBackground() const {
+    size_t offset = backgroundOffset;
+    return offset ? readValue(offset) : nlohmann::json();
+}
+
+nlohmann::json BinaryLevel::getFrameBudget() const {
+    size_t offset = frameBudgetOffset;
+    return offset ? readValue(offset) : nlohmann::json();
+}
+
+nlohmann::json BinaryLevel::getObject(size_t index) const {
+    size_t offset = objectOffset(index) + 4;  // skip the key
+    uint32_t nameIndex = readU32(offset);
+    uint32_t templateIndex = readU32(offset + 4);
+    uint32_t componentCount = readU32(offset + 8);
+    offset += 12;
+
+    nlohmann::json entry = nlohmann::json::object();
+    if (nameIndex != kNoString) {
+        entry["name"] = std::string(getString(nameIndex));
+    }
+    if (templateIndex != kNoString) {
+        entry["template"] = std::string(getString(templateIndex));
+    }
+    if (componentCount != kNoComponents) {
+        nlohmann::json& components = entry["components"] = nlohmann::json::array();
+        for (uint32_t i = 0; i < componentCount; ++i) {
+            std::string_view typeName = getString(readU32(offset));
+            offset += 4;
+            nlohmann::json component = readValue(offset);
+            component["type"] = std::string(typeName);
+            components.push_back(std::move(component));
+        }
+    }
+    nlohmann::json extra = readValue(offset);
+    if (extra.is_object()) {
+        for (auto& [field, value] : extra.items()) {
+            entry[field] = std::move(value);
+        }
+    }
+    return entry;
+}
+
+std::string BinaryLevel::getObjectKey(size_t index) const {
+    uint32_t keyIndex = readU32(objectOffset(index));
+    return keyIndex == kNoString ? std::string() : std::string(getString(keyIndex));
+}
+
+std::string_view BinaryLevel::getString(uint32_t index) const {
+    if (index >= stringCount) {
+        throw corrupt(path);
+    }
+    size_t entry = stringTableOffset + static_cast<size_t>(index) * 8;
+    uint64_t begin = stringTableOffset + static_cast<uint64_t>(stringCount) * 8 + readU32(entry);
+    uint64_t length = readU32(entry + 4);
+    if (begin + length > file.size()) {
+        throw corrupt(path);
+    }
+    return std::string_view(reinterpret_cast<const char*>(file.data() + begin), static_cast<size_t>(length));
+}
+
+uint32_t BinaryLevel::readU32(size_t offset) const {
+    if (offset + 4 > file.size()) {
+        throw corrupt(path);
+    }
+    return static_cast<uint32_t>(readLE(file.data() + offset, 4));
+}
+
+nlohmann::json BinaryLevel::readValue(size_t& offset, int depth) const {
+    if (offset >= file.size() || depth > kMaxDepth) {
+        throw corrupt(path);
+    }
+    uint8_t tag = file.data()[offset++];
+    switch (tag) {
+        case kNull:
+            return nullptr;
+        case kFalse:
+            return false;
+        case kTrue:
+            return true;
+        case kInt:
+        case kUint:
+        case kDouble: {
+            if (offset + 8 > file.size()) {
+                throw corrupt(path);
+            }
+            uint64_t bits = readLE(file.data() + offset, 8);
+            offset += 8;
+            if (tag == kInt) {
+                return static_cast<int64_t>(bits);
+            }
+            if (tag == kUint) {
+                return bits;
+            }
+            double number;
+            std::memcpy(&number, &bits, sizeof(number));
+            return number;
+        }
+        case kString: {
+            std::string_view text = getString(readU32(offset));
+            offset += 4;
+            return std::string(text);
+        }
+        case kArray: {
+            uint32_t count = readU32(offset);
+            offset += 4;
+            nlohmann::json array = nlohmann::json::array();
+            for (uint32_t i = 0; i < count; ++i) {
+                array.push_back(readValue(offset, depth + 1));
+            }
+            return array;
+        }
+        case kObject: {
+            uint32_t count = readU32(offset);
+            offset += 4;
+            nlohmann::json object = nlohmann::json::object();
+            for (uint32_t i = 0; i < count; ++i) {
+                std::string key(getString(readU32(offset)));
+                offset += 4;
+                object[key] = readValue(offset, depth + 1);
+            }
+            return object;
+        }
+        default:
+            throw corrupt(path);
+    }
+}
+
+size_t BinaryLevel::objectOffset(size_t index) const {
+    if (index >= objectCount) {
+        throw std::out_of_range("object index out of range");
+    }
+    return readU32(objectTableOffset + index * 4);
+}
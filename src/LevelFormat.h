@@ -0,0 +1,87 @@
+#pragma once
+
+#include "MappedFile.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Compiled binary form of level, save and object template files (".lvlb" next to the
+// ".json"), written by the level_compiler tool. Layout, all integers little-endian:
+//
+//   header        magic "LVLB", version, kind, flags, order, section offsets and counts,
+//                 size and FNV-1a hash of the JSON source it was compiled from
+//   string table  every key and string value once: (offset, length) pairs, then the bytes
+//   globals       tagged value (level "globalValues")
+//   background    tagged value (level "background" block, layers as written)
+//   frame budget  tagged value (level "frameBudget" block)
+//   object table  offsets of object records: key/name/template string indices, typed
+//                 component records (type string index + field object), other keys
+//
+// Values are tagged (null, bool, int, uint, double, string index, array, object) so
+// components get exactly the JSON types they were authored with.
+namespace LevelFormat {
+
+enum class Kind : uint32_t {
+    Level = 1,      // level or save file: "objects" array
+    Templates = 2,  // objectData.json: template name -> object definition
+};
+
+// ".lvlb" path that shadows a ".json" source
+std::string binaryPathFor(const std::string& sourcePath);
+
+uint64_t hashBytes(const uint8_t* data, size_t size);
+
+// Compile a parsed source document; throws std::runtime_error for input the format can't
+// represent faithfully (the JSON is used instead)
+std::vector<uint8_t> compile(const nlohmann::json& document, Kind kind, uint64_t sourceSize, uint64_t sourceHash);
+
+}
+
+// Memory-mapped compiled file. Sections are decoded straight from the mapping; only the
+// piece asked for (one object, the background block) is turned into JSON.
+class BinaryLevel {
+public:
+    // Map the compiled file for sourcePath if it exists, is valid and was compiled from the
+    // source's current contents (or the source is missing)
+    bool openFor(const std::string& sourcePath, LevelFormat::Kind kind);
+
+    const std::string& getPath() const { return path; }
+    bool isSaveFile() const;
+    bool hasOrder() const;
+    int getOrder() const;
+    bool hasObjects() const;
+
+    // null when absent
+    nlohmann::json getGlobalValues() const;
+    nlohmann::json getBackground() const;
+    nlohmann::json getFrameBudget() const;
+
+    size_t getObjectCount() const { return objectCount; }
+    // Object entry as written in the source (name, template, components, other keys)
+    nlohmann::json getObject(size_t index) const;
+    // Template name for Kind::Templates files
+    std::string getObjectKey(size_t index) const;
+
+private:
+    std::string_view getString(uint32_t index) const;
+    uint32_t readU32(size_t offset) const;
+    nlohmann::json readValue(size_t& offset, int depth = 0) const;
+    size_t objectOffset(size_t index) const;
+
+    std::string path;
+    MappedFile file;
+    uint32_t flags = 0;
+    int32_t order = 0;
+    uint32_t stringCount = 0;
+    size_t stringTableOffset = 0;
+    size_t globalsOffset = 0;
+    size_t backgroundOffset = 0;
+    size_t frameBudgetOffset = 0;
+    size_t objectCount = 0;
+    size_t objectTableOffset = 0;
+};
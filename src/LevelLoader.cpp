@@ -0,0 +1,445 @@
+#include "LevelLoader.h"
+#include "Engine.h"
+#include "LevelFormat.h"
+#include "SaveManager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+#include <thread>
+
+namespace {
+std::filesystem::file_time_type modifiedTime(const std::string& path) {
+    std::error_code ec;
+    auto time = std::filesystem::last_write_time(path, ec);
+    return ec ? std::filesystem::file_time_type{} : time;
+}
+
+bool isCancelled(const std::atomic<bool>* cancelled) {
+    return cancelled && cancelled->load(std::memory_order_relaxed);
+}
+
+// Path a next-level request's scan settled on, once it's done ("" if it failed)
+bool readyPath(const std::shared_future<std::string>& nextPath, std::string& path) {
+    if (!nextPath.valid() || nextPath.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready) {
+        return false;
+    }
+    try {
+        path = nextPath.get();
+    } catch (const std::exception&) {
+        path.clear();
+    }
+    return true;
+}
+
+void readCompiledLevel(PreparedLevel& level, const BinaryLevel& binary, const ObjectTemplateSet& templates,
+                       const std::atomic<bool>* cancelled) {
+    if (binary.isSaveFile() && !binary.hasObjects()) {
+        level.error = "Error: Save file does not contain level data (objects array)";
+        return;
+    }
+
+    level.levelData = nlohmann::json::object();
+    nlohmann::json background = binary.getBackground();
+    if (!background.is_null()) {
+        level.levelData["background"] = std::move(background);
+    }
+    nlohmann::json frameBudget = binary.getFrameBudget();
+    if (!frameBudget.is_null()) {
+        level.levelData["frameBudget"] = std::move(frameBudget);
+    }
+    level.globalValues = binary.getGlobalValues();
+    level.order = binary.hasOrder() ? binary.getOrder() : 0;
+
+    // Entries are decoded one at a time from the mapping, never as a whole-file document
+    level.hasObjects = binary.hasObjects();
+    level.objects.reserve(binary.getObjectCount());
+    for (size_t i = 0; i < binary.getObjectCount() && !isCancelled(cancelled); ++i) {
+        level.objects.push_back(templates.compileObject(binary.getObject(i)));
+    }
+    level.binaryPath = binary.getPath();
+    level.binaryModified = modifiedTime(binary.getPath());
+    std::cout << "Compiled level " << binary.getPath() << " mapped successfully" << std::endl;
+}
+}
+
+std::shared_ptr<const ObjectTemplateSet> ObjectTemplateSet::load(const std::string& path) {
+    auto set = std::make_shared<ObjectTemplateSet>();
+    set->path = path;
+    set->modified = modifiedTime(path);
+
+    BinaryLevel binary;
+    if (binary.openFor(path, LevelFormat::Kind::Templates)) {
+        try {
+            for (size_t i = 0; i < binary.getObjectCount(); ++i) {
+                std::string name = binary.getObjectKey(i);
+                nlohmann::json templateData = binary.getObject(i);
+                set->prototypes.emplace(name, ObjectPrototype(templateData));
+                set->templates[name] = std::move(templateData);
+            }
+            set->binaryPath = binary.getPath();
+            set->binaryModified = modifiedTime(binary.getPath());
+            return set;
+        } catch (const std::exception& e) {
+            std::cerr << "Warning: " << e.what() << ", loading " << path << std::endl;
+            set->templates.clear();
+            set->prototypes.clear();
+        }
+    }
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Warning: Could not open object template file " << path << std::endl;
+        return nullptr;
+    }
+
+    try {
+        nlohmann::json data;
+        file >> data;
+        const nlohmann::json* templatesSection = &data;
+        if (data.contains("templates") && data["templates"].is_object()) {
+            templatesSection = &data["templates"];
+        }
+
+        if (!templatesSection->is_object()) {
+            std::cerr << "Warning: Template file '" << path << "' must contain an object of templates" << std::endl;
+            return nullptr;
+        }
+
+        for (const auto& [name, templateData] : templatesSection->items()) {
+            set->templates[name] = templateData;
+            set->prototypes.emplace(name, ObjectPrototype(templateData));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Warning: Failed to parse object template file '" << path << "': " << e.what() << std::endl;
+        return nullptr;
+    }
+    return set;
+}
+
+bool ObjectTemplateSet::isStale() const {
+    return path.empty() || modifiedTime(path) != modified ||
+           (!binaryPath.empty() && modifiedTime(binaryPath) != binaryModified);
+}
+
+nlohmann::json ObjectTemplateSet::buildObjectDefinition(const nlohmann::json& objectData) const {
+    if (!objectData.is_object()) {
+        return objectData;
+    }
+
+    auto templateIt = objectData.find("template");
+    if (templateIt == objectData.end() || !templateIt->is_string()) {
+        return objectData;
+    }
+
+    const std::string templateName = templateIt->get<std::string>();
+    auto found = templates.find(templateName);
+    if (found == templates.end()) {
+        std::cerr << "Warning: Object template '" << templateName << "' not found" << std::endl;
+        nlohmann::json fallback = objectData;
+        fallback.erase("template");
+        return fallback;
+    }
+
+    nlohmann::json merged = Engine::mergeObjectDefinitions(found->second, objectData);
+    merged.erase("template");
+    return merged;
+}
+
+ObjectPrototype ObjectTemplateSet::compileObject(const nlohmann::json& objectData) const {
+    if (objectData.is_object()) {
+        auto templateIt = objectData.find("template");
+        if (templateIt != objectData.end() && templateIt->is_string()) {
+            if (const ObjectPrototype* base = findPrototype(templateIt->get_ref<const std::string&>())) {
+                return ObjectPrototype(*base, objectData);
+            }
+        }
+    }
+
+    // Untemplated entries, or an unknown template (buildObjectDefinition warns and strips it)
+    return ObjectPrototype(buildObjectDefinition(objectData));
+}
+
+const ObjectPrototype* ObjectTemplateSet::findPrototype(const std::string& templateName) const {
+    auto found = prototypes.find(templateName);
+    return found == prototypes.end() ? nullptr : &found->second;
+}
+
+bool PreparedLevel::isStale() const {
+    return modifiedTime(path) != modified ||
+           (!binaryPath.empty() && modifiedTime(binaryPath) != binaryModified) ||
+           (templates && templates->isStale());
+}
+
+LevelLoader::~LevelLoader() {
+    clear();
+}
+
+std::unique_ptr<PreparedLevel> LevelLoader::prepare(const std::string& path,
+                                                    std::shared_ptr<const ObjectTemplateSet> templates,
+                                                    const std::atomic<bool>* cancelled) {
+    if (isCancelled(cancelled)) {
+        return nullptr;
+    }
+    if (!templates || templates->isStale()) {
+        if (auto reloaded = ObjectTemplateSet::load(kObjectTemplatePath)) {
+            templates = std::move(reloaded);
+        } else if (!templates) {
+            templates = std::make_shared<const ObjectTemplateSet>();
+        }
+    }
+
+    auto level = std::make_unique<PreparedLevel>();
+    level->path = path;
+    level->modified = modifiedTime(path);
+    level->templates = templates;
+
+    BinaryLevel binary;
+    if (binary.openFor(path, LevelFormat::Kind::Level)) {
+        try {
+            readCompiledLevel(*level, binary, *templates, cancelled);
+            return isCancelled(cancelled) ? nullptr : std::move(level);
+        } catch (const std::exception& e) {
+            std::cerr << "Warning: " << e.what() << ", loading " << path << std::endl;
+            level = std::make_unique<PreparedLevel>();
+            level->path = path;
+            level->modified = modifiedTime(path);
+            level->templates = templates;
+        }
+    }
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        level->error = "Error: Could not open file " + path;
+        return level;
+    }
+
+    nlohmann::json j;
+    try {
+        file >> j;
+        file.close();
+        std::cout << "JSON file parsed successfully" << std::endl;
+    } catch (const nlohmann::json::exception& e) {
+        level->error = std::string("JSON parsing error: ") + e.what();
+        return level;
+    }
+
+    // Check if this is a save file (has metadata)
+    // If so, extract just the level data (background + objects)
+    nlohmann::json& levelData = level->levelData;
+    if (j.contains("metadata")) {
+        levelData = nlohmann::json::object();
+        if (j.contains("background")) {
+            levelData["background"] = j["background"];
+        }
+        if (j.contains("objects")) {
+            levelData["objects"] = j["objects"];
+        }
+
+        // If save file has no level data, it's invalid for loading
+        if (!levelData.contains("objects") || !levelData["objects"].is_array()) {
+            level->error = "Error: Save file does not contain level data (objects array)";
+            return level;
+        }
+    } else {
+        levelData = j;
+    }
+
+    if (j.contains("globalValues") && j["globalValues"].is_object()) {
+        level->globalValues = j["globalValues"];
+    }
+    if (j.contains("order") && j["order"].is_number_integer()) {
+        level->order = j["order"].get<int>();
+    }
+
+    auto objectsIt = levelData.find("objects");
+    level->hasObjects = objectsIt != levelData.end() && objectsIt->is_array();
+    if (level->hasObjects) {
+        level->objects.reserve(objectsIt->size());
+        for (const auto& objectData : *objectsIt) {
+            if (isCancelled(cancelled)) {
+                return nullptr;
+            }
+            level->objects.push_back(templates->compileObject(objectData));
+        }
+        levelData.erase(objectsIt);
+    }
+    return level;
+}
+
+void LevelLoader::request(const std::string& path, std::shared_ptr<const ObjectTemplateSet> templates) {
+    if (path.empty() || isRequested(path)) {
+        return;
+    }
+    Request request;
+    request.path = path;
+    launch(std::move(request), [path, templates](const std::atomic<bool>& cancelled) {
+        return prepare(path, templates, &cancelled);
+    });
+}
+
+void LevelLoader::requestNextLevel(int afterOrder, std::shared_ptr<const ObjectTemplateSet> templates) {
+    // The scan's answer is published before the level is prepared, so findNextLevelPath
+    // doesn't wait for the whole level
+    auto pathPromise = std::make_shared<std::promise<std::string>>();
+    Request request;
+    request.nextLevel = true;
+    request.afterOrder = afterOrder;
+    request.nextPath = pathPromise->get_future().share();
+    launch(std::move(request),
+           [afterOrder, templates, pathPromise](const std::atomic<bool>& cancelled) -> std::unique_ptr<PreparedLevel> {
+               std::string path = SaveManager::findNextLevelPath(afterOrder);
+               pathPromise->set_value(path);
+               if (path.empty()) {
+                   return nullptr;
+               }
+               return prepare(path, templates, &cancelled);
+           });
+}
+
+std::string LevelLoader::findNextLevelPath(int afterOrder) {
+    for (const Request& request : requests) {
+        if (!request.nextLevel || request.afterOrder != afterOrder || !request.nextPath.valid()) {
+            continue;
+        }
+        // Blocks only while the worker's scan is still running
+        try {
+            return request.nextPath.get();
+        } catch (const std::exception&) {
+            break;
+        }
+    }
+    return SaveManager::findNextLevelPath(afterOrder);
+}
+
+bool LevelLoader::isRequested(const std::string& path) const {
+    for (const Request& request : requests) {
+        if (request.path == path) {
+            return true;
+        }
+        if (request.path.empty() && request.future.valid()) {
+            std::string nextPath;
+            if (!readyPath(request.nextPath, nextPath) || nextPath == path) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::unique_ptr<PreparedLevel> LevelLoader::take(const std::string& path, bool wait) {
+    reapRetired();
+    for (Request& request : requests) {
+        resolve(request, wait && request.path.empty());
+    }
+
+    auto it = std::find_if(requests.begin(), requests.end(),
+                           [&path](const Request& request) { return request.path == path; });
+    if (it == requests.end()) {
+        return nullptr;
+    }
+    resolve(*it, wait);
+    if (it->future.valid()) {
+        return nullptr;  // still being prepared
+    }
+
+    std::unique_ptr<PreparedLevel> level = std::move(it->result);
+    retire(*it);
+    requests.erase(it);
+    if (level && level->isStale()) {
+        std::cout << "LevelLoader: " << path << " changed since it was preloaded, reloading" << std::endl;
+        return nullptr;
+    }
+    return level;
+}
+
+void LevelLoader::clear() {
+    // Cancel everything first so the workers wind down together, then wait for them
+    for (std::vector<Request>* list : {&requests, &retired}) {
+        for (Request& request : *list) {
+            if (request.cancelled) {
+                request.cancelled->store(true);
+            }
+        }
+    }
+    for (std::vector<Request>* list : {&requests, &retired}) {
+        for (Request& request : *list) {
+            if (request.worker.joinable()) {
+                request.worker.join();
+            }
+        }
+        list->clear();
+    }
+}
+
+void LevelLoader::launch(Request request,
+                         std::function<std::unique_ptr<PreparedLevel>(const std::atomic<bool>&)> work) {
+    reapRetired();
+
+    // Finished next-level requests that resolved to nothing, and the oldest requests past the
+    // cap, are dropped
+    for (auto it = requests.begin(); it != requests.end();) {
+        resolve(*it, false);
+        if (it->path.empty() && !it->future.valid()) {
+            retire(*it);
+            it = requests.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (requests.size() >= kMaxRequests) {
+        retire(requests.front());
+        requests.erase(requests.begin());
+    }
+
+    request.cancelled = std::make_shared<std::atomic<bool>>(false);
+    std::packaged_task<std::unique_ptr<PreparedLevel>()> task(
+        [work = std::move(work), cancelled = request.cancelled]() { return work(*cancelled); });
+    request.future = task.get_future();
+    request.worker = std::thread(std::move(task));
+    requests.push_back(std::move(request));
+}
+
+void LevelLoader::resolve(Request& request, bool wait) {
+    // A next-level request is known by its path as soon as the scan is done
+    if (request.path.empty()) {
+        readyPath(request.nextPath, request.path);
+    }
+    if (!request.future.valid()) {
+        return;
+    }
+    if (!wait && request.future.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready) {
+        return;
+    }
+    request.result = request.future.get();
+    if (request.path.empty() && request.result) {
+        request.path = request.result->path;
+    }
+}
+
+void LevelLoader::retire(Request& request) {
+    if (request.cancelled) {
+        request.cancelled->store(true);
+    }
+    if (!request.worker.joinable()) {
+        return;
+    }
+    if (!request.future.valid() || request.future.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
+        request.worker.join();  // done or about to return
+        return;
+    }
+    retired.push_back(std::move(request));
+}
+
+void LevelLoader::reapRetired() {
+    for (auto it = retired.begin(); it != retired.end();) {
+        if (it->future.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready) {
+            it->worker.join();
+            it = retired.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "ObjectPrototype.h"
+
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Object templates from assets/objectData.json with their compiled prototypes. Sets are
+// immutable once loaded, so a level being prepared on a worker thread can hold on to one
+// while the main thread keeps using it. Engine reloads only when the file changes.
+class ObjectTemplateSet {
+public:
+    // nullptr if the file can't be read or parsed (callers keep their previous set)
+    static std::shared_ptr<const ObjectTemplateSet> load(const std::string& path);
+
+    // File was modified (or removed) since this set was loaded
+    bool isStale() const;
+
+    // Resolve "template" in a level/spawner entry into a full object definition
+    nlohmann::json buildObjectDefinition(const nlohmann::json& objectData) const;
+
+    // Typed prototype for a level/spawner entry (template prototype plus the entry's overrides)
+    ObjectPrototype compileObject(const nlohmann::json& objectData) const;
+
+    const ObjectPrototype* findPrototype(const std::string& templateName) const;
+
+private:
+    std::string path;
+    std::filesystem::file_time_type modified{};
+    std::string binaryPath;  // compiled objectData.lvlb it was read from, if any
+    std::filesystem::file_time_type binaryModified{};
+    std::unordered_map<std::string, nlohmann::json> templates;
+    std::unordered_map<std::string, ObjectPrototype> prototypes;
+};
+
+// A level file parsed and compiled off the main thread; Engine::commitLevel turns it into
+// objects. Holds no engine state, so it can be built on any thread.
+struct PreparedLevel {
+    std::string path;
+    std::filesystem::file_time_type modified{};
+    std::string binaryPath;  // compiled .lvlb it was read from, if any
+    std::filesystem::file_time_type binaryModified{};
+    std::string error;                 // set when the file can't be loaded
+    nlohmann::json levelData;          // background, frameBudget (and the rest of the file, minus objects)
+    nlohmann::json globalValues;
+    bool hasObjects = false;
+    int order = 0;
+    std::vector<ObjectPrototype> objects;
+    std::shared_ptr<const ObjectTemplateSet> templates;
+
+    // Level or template file changed since this was prepared
+    bool isStale() const;
+};
+
+// Prepares levels on background threads: the level queued by gameplay, and the level a
+// LevelWinComponent is expected to load next so its transition doesn't parse or scan
+// anything. Workers are joined, never detached: clear() cancels and joins them all, so none
+// outlives the engine.
+class LevelLoader {
+public:
+    static constexpr const char* kObjectTemplatePath = "assets/objectData.json";
+
+    ~LevelLoader();
+
+    // Parse and compile a level (any thread), from its compiled .lvlb when that is up to
+    // date. templates is reused unless missing or stale. Returns nullptr once cancelled is set
+    static std::unique_ptr<PreparedLevel> prepare(const std::string& path,
+                                                  std::shared_ptr<const ObjectTemplateSet> templates,
+                                                  const std::atomic<bool>* cancelled = nullptr);
+
+    // Start preparing path on a worker thread (no-op if it's already requested)
+    void request(const std::string& path, std::shared_ptr<const ObjectTemplateSet> templates);
+
+    // Start preparing the level with the lowest order above afterOrder; the level scan runs
+    // on the worker too
+    void requestNextLevel(int afterOrder, std::shared_ptr<const ObjectTemplateSet> templates);
+
+    // Level with the lowest order above afterOrder ("" if none): the path a next-level request
+    // resolved (waiting for its scan if needed), else SaveManager::findNextLevelPath
+    std::string findNextLevelPath(int afterOrder);
+
+    // path has been requested, or a next-level request that may turn out to be path is still running
+    bool isRequested(const std::string& path) const;
+
+    // Take the prepared level for path; without wait, returns nullptr while it's still being
+    // prepared. Stale or unrequested levels yield nullptr
+    std::unique_ptr<PreparedLevel> take(const std::string& path, bool wait);
+
+    // Forget all requests: workers still preparing are cancelled and joined
+    void clear();
+
+private:
+    struct Request {
+        std::string path;  // empty until a next-level request resolves
+        bool nextLevel = false;
+        int afterOrder = 0;
+        std::shared_future<std::string> nextPath;  // next-level requests, set before preparing
+        std::future<std::unique_ptr<PreparedLevel>> future;
+        std::unique_ptr<PreparedLevel> result;
+        std::shared_ptr<std::atomic<bool>> cancelled;
+        std::thread worker;
+    };
+
+    static constexpr size_t kMaxRequests = 3;
+
+    void launch(Request request, std::function<std::unique_ptr<PreparedLevel>(const std::atomic<bool>&)> work);
+    static void resolve(Request& request, bool wait);
+    // Cancel a request's worker; it's joined here if done, else by reapRetired or clear
+    void retire(Request& request);
+    void reapRetired();
+
+    std::vector<Request> requests;
+    std::vector<Request> retired;  // dropped while their workers were still running
+};
@@ -0,0 +1,99 @@
+#include "NameIndex.h"
+#include "Object.h"
+
+#include <algorithm>
+
+void NameIndex::add(Object& object) {
+    const ObjectHandle handle = object.getHandle();
+    if (handle.isNull()) {
+        return;
+    }
+    byName[object.getName()].push_back(handle);
+    ++version;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    for (auto& [key, cached] : cachedMatches) {
+        if (cached.matcher.matches(object.getName())) {
+            cached.handles.push_back(handle);
+        }
+    }
+}
+
+void NameIndex::remove(Object& object) {
+    removeNamed(object, object.getName());
+}
+
+void NameIndex::rename(Object& object, const std::string& oldName) {
+    removeNamed(object, oldName);
+    add(object);
+}
+
+void NameIndex::clear() {
+    byName.clear();
+    ++version;
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cachedMatches.clear();
+}
+
+const std::vector<ObjectHandle>& NameIndex::find(const std::string& name) const {
+    static const std::vector<ObjectHandle> none;
+    auto it = byName.find(name);
+    return it == byName.end() ? none : it->second;
+}
+
+Object* NameIndex::findFirst(const std::string& name) const {
+    for (ObjectHandle handle : find(name)) {
+        if (Object* object = Object::resolve(handle)) {
+            return object;
+        }
+    }
+    return nullptr;
+}
+
+const std::vector<ObjectHandle>& NameIndex::match(const NameMatcher& matcher,
+                                                  const std::vector<std::unique_ptr<Object>>& worldObjects) {
+    // Entries are never erased outside clear(), so the returned list stays put while other
+    // threads add entries for their own matchers
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto found = cachedMatches.find(matcher.getKey());
+    if (found != cachedMatches.end()) {
+        return found->second.handles;
+    }
+
+    CachedMatch& cached = cachedMatches[matcher.getKey()];
+    cached.matcher = matcher;
+    for (const auto& object : worldObjects) {
+        if (object && object->isInWorld() && matcher.matches(object->getName())) {
+            cached.handles.push_back(object->getHandle());
+        }
+    }
+    return cached.handles;
+}
+
+void NameIndex::eraseHandle(std::vector<ObjectHandle>& handles, ObjectHandle handle) {
+    // Order-preserving, so lists keep following the object order
+    auto it = std::find(handles.begin(), handles.end(), handle);
+    if (it != handles.end()) {
+        handles.erase(it);
+    }
+}
+
+void NameIndex::removeNamed(Object& object, const std::string& name) {
+    const ObjectHandle handle = object.getHandle();
+    auto bucket = byName.find(name);
+    if (handle.isNull() || bucket == byName.end()) {
+        return;
+    }
+    eraseHandle(bucket->second, handle);
+    ++version;
+    if (bucket->second.empty()) {
+        byName.erase(bucket);
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    for (auto& [key, cached] : cachedMatches) {
+        if (cached.matcher.matches(name)) {
+            eraseHandle(cached.handles, handle);
+        }
+    }
+}
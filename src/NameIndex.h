@@ -0,0 +1,56 @@
+#pragma once
+
+#include "NameMatcher.h"
+#include "ObjectHandle.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Object;
+
+/**
+ * Name -> objects index over the objects in Engine's object list. Objects enter and leave
+ * it through Object::setInWorld, setName, parkInPool and the destructor, so every path that
+ * adds or drops objects keeps it current. Lists are in the order objects entered the world,
+ * which matches Engine's object order.
+ *
+ * match() caches the objects for each compiled NameMatcher and keeps those lists current
+ * as objects come and go. It may be called from the parallel update phase; add/remove
+ * only happen on the main thread outside it.
+ */
+class NameIndex {
+public:
+    void add(Object& object);
+    void remove(Object& object);
+    void rename(Object& object, const std::string& oldName);
+    void clear();
+
+    // Bumped whenever an object enters, leaves or is renamed
+    uint64_t getVersion() const { return version; }
+
+    // Objects named exactly name
+    const std::vector<ObjectHandle>& find(const std::string& name) const;
+    Object* findFirst(const std::string& name) const;
+
+    // Objects matching matcher; the first call for a matcher scans worldObjects
+    const std::vector<ObjectHandle>& match(const NameMatcher& matcher,
+                                           const std::vector<std::unique_ptr<Object>>& worldObjects);
+
+private:
+    struct CachedMatch {
+        NameMatcher matcher;
+        std::vector<ObjectHandle> handles;
+    };
+
+    static void eraseHandle(std::vector<ObjectHandle>& handles, ObjectHandle handle);
+    void removeNamed(Object& object, const std::string& name);
+
+    std::unordered_map<std::string, std::vector<ObjectHandle>> byName;
+    std::unordered_map<std::string, CachedMatch> cachedMatches;  // keyed by NameMatcher::getKey
+    std::mutex cacheMutex;
+    uint64_t version = 0;
+};
@@ -0,0 +1,234 @@
+#include "NameMatcher.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace {
+char lowerAscii(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+bool isRegexSyntax(char c) {
+    return std::strchr("^$\\.*+?()[]{}|", c) != nullptr && c != '\0';
+}
+
+bool isQuantifier(char c) {
+    return c == '*' || c == '+' || c == '?' || c == '{';
+}
+
+bool isLineBreak(char c) {
+    return c == '\n' || c == '\r';
+}
+
+// Case-insensitive compare of name[offset, offset + lowered.size()) against lowered
+bool equalsNoCaseAt(const std::string& name, size_t offset, const std::string& lowered) {
+    if (offset + lowered.size() > name.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < lowered.size(); ++i) {
+        if (lowerAscii(name[offset + i]) != lowered[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+}
+
+NameMatcher NameMatcher::compile(const std::vector<std::string>& names, bool useRegex) {
+    NameMatcher matcher;
+    matcher.key = useRegex ? "regex" : "exact";
+    for (const std::string& name : names) {
+        matcher.key += '\x1f';
+        matcher.key += name;
+
+        if (!useRegex) {
+            matcher.exactNames.insert(name);
+            continue;
+        }
+        bool valid = true;
+        Alternative alternative = compilePattern(name, valid);
+        if (valid) {
+            matcher.alternatives.push_back(std::move(alternative));
+        }
+    }
+    return matcher;
+}
+
+bool NameMatcher::matches(const std::string& name) const {
+    if (!exactNames.empty() && exactNames.count(name) > 0) {
+        return true;
+    }
+    for (const Alternative& alternative : alternatives) {
+        if (matchesAlternative(alternative, name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+NameMatcher::Alternative NameMatcher::compilePattern(const std::string& pattern, bool& valid) {
+    Alternative alternative;
+    valid = true;
+
+    auto compileRegex = [&pattern, &valid]() -> std::shared_ptr<const std::regex> {
+        try {
+            return std::make_shared<const std::regex>(pattern, std::regex::ECMAScript | std::regex::icase);
+        } catch (const std::regex_error& e) {
+            std::cerr << "[NameMatcher] Invalid regex pattern '" << pattern << "': " << e.what() << std::endl;
+            valid = false;
+            return nullptr;
+        }
+    };
+
+    // Reduce the pattern to literals, '.' and '.*' between optional anchors; anything
+    // else (classes, groups, alternation, other quantifiers) keeps the real regex
+    size_t begin = 0;
+    size_t end = pattern.size();
+    const bool anchoredStart = end > 0 && pattern[0] == '^';
+    if (anchoredStart) {
+        begin = 1;
+    }
+    bool anchoredEnd = false;
+    if (end > begin && pattern[end - 1] == '$') {
+        size_t backslashes = 0;
+        for (size_t i = end - 1; i > begin && pattern[i - 1] == '\\'; --i) {
+            ++backslashes;
+        }
+        anchoredEnd = backslashes % 2 == 0;
+        if (anchoredEnd) {
+            --end;
+        }
+    }
+
+    std::vector<GlobStep> steps;
+    bool hasWildcard = false;
+    bool simple = true;
+    for (size_t i = begin; i < end && simple; ++i) {
+        char c = pattern[i];
+        const char next = i + 1 < end ? pattern[i + 1] : '\0';
+        if (c == '.') {
+            hasWildcard = true;
+            if (next == '*' || next == '+') {
+                if (next == '+') {
+                    steps.push_back({GlobStep::AnyOne, 0});
+                }
+                steps.push_back({GlobStep::AnySequence, 0});
+                ++i;
+                if (i + 1 < end && pattern[i + 1] == '?') {
+                    ++i;  // lazy form matches the same names
+                }
+            } else if (isQuantifier(next)) {
+                simple = false;
+            } else {
+                steps.push_back({GlobStep::AnyOne, 0});
+            }
+            continue;
+        }
+        if (c == '\\') {
+            if (next == '\0' || !isRegexSyntax(next)) {
+                simple = false;  // character class escape, backreference, ...
+                continue;
+            }
+            c = next;
+            ++i;
+        } else if (isRegexSyntax(c) || isLineBreak(c)) {
+            simple = false;
+            continue;
+        }
+        if (i + 1 < end && isQuantifier(pattern[i + 1])) {
+            simple = false;
+            continue;
+        }
+        steps.push_back({GlobStep::Literal, lowerAscii(c)});
+    }
+
+    if (!simple) {
+        alternative.kind = Kind::Regex;
+        alternative.regex = compileRegex();
+        return alternative;
+    }
+
+    if (!hasWildcard) {
+        for (const GlobStep& step : steps) {
+            alternative.text += step.ch;
+        }
+        if (anchoredStart && anchoredEnd) {
+            alternative.kind = Kind::ExactNoCase;
+        } else if (anchoredStart) {
+            alternative.kind = Kind::Prefix;
+        } else if (anchoredEnd) {
+            alternative.kind = Kind::Suffix;
+        } else {
+            alternative.kind = Kind::Contains;
+        }
+        return alternative;
+    }
+
+    // Unanchored ends behave like a leading/trailing '.*'
+    alternative.kind = Kind::Glob;
+    if (!anchoredStart) {
+        alternative.glob.push_back({GlobStep::AnySequence, 0});
+    }
+    alternative.glob.insert(alternative.glob.end(), steps.begin(), steps.end());
+    if (!anchoredEnd) {
+        alternative.glob.push_back({GlobStep::AnySequence, 0});
+    }
+    // '.' never matches a line break, which the glob walk doesn't model; such names use the regex
+    alternative.regex = compileRegex();
+    return alternative;
+}
+
+bool NameMatcher::matchesAlternative(const Alternative& alternative, const std::string& name) {
+    switch (alternative.kind) {
+        case Kind::ExactNoCase:
+            return name.size() == alternative.text.size() && equalsNoCaseAt(name, 0, alternative.text);
+        case Kind::Prefix:
+            return equalsNoCaseAt(name, 0, alternative.text);
+        case Kind::Suffix:
+            return name.size() >= alternative.text.size() &&
+                   equalsNoCaseAt(name, name.size() - alternative.text.size(), alternative.text);
+        case Kind::Contains:
+            for (size_t offset = 0; offset + alternative.text.size() <= name.size(); ++offset) {
+                if (equalsNoCaseAt(name, offset, alternative.text)) {
+                    return true;
+                }
+            }
+            return false;
+        case Kind::Regex:
+            return alternative.regex && std::regex_search(name, *alternative.regex);
+        case Kind::Glob:
+            break;
+    }
+
+    for (char c : name) {
+        if (isLineBreak(c)) {
+            return alternative.regex && std::regex_search(name, *alternative.regex);
+        }
+    }
+
+    // Wildcard walk, backtracking to the most recent '.*' on a mismatch
+    const std::vector<GlobStep>& steps = alternative.glob;
+    size_t n = 0;
+    size_t p = 0;
+    size_t starStep = steps.size();
+    size_t starName = 0;
+    while (n < name.size()) {
+        if (p < steps.size() && steps[p].type == GlobStep::AnySequence) {
+            starStep = p++;
+            starName = n;
+        } else if (p < steps.size() &&
+                   (steps[p].type == GlobStep::AnyOne || steps[p].ch == lowerAscii(name[n]))) {
+            ++p;
+            ++n;
+        } else if (starStep != steps.size()) {
+            p = starStep + 1;
+            n = ++starName;
+        } else {
+            return false;
+        }
+    }
+    while (p < steps.size() && steps[p].type == GlobStep::AnySequence) {
+        ++p;
+    }
+    return p == steps.size();
+}
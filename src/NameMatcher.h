@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <regex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Compiled object-name filter: any of a list of names or patterns. Exact lists match names
+ * case-sensitively. Pattern lists keep the semantics of std::regex_search with
+ * ECMAScript | icase, but patterns that are only literals, anchors, '.' and '.*' compile
+ * to a case-insensitive exact/prefix/suffix/substring compare or a glob, so std::regex is
+ * only built for patterns that really need it.
+ */
+class NameMatcher {
+public:
+    NameMatcher() = default;  // matches nothing
+
+    // useRegex picks pattern semantics; invalid regexes are reported and skipped
+    static NameMatcher compile(const std::vector<std::string>& names, bool useRegex);
+
+    bool matches(const std::string& name) const;
+    bool empty() const { return exactNames.empty() && alternatives.empty(); }
+
+    // Identifies the name list and mode, for caching matches per pattern
+    const std::string& getKey() const { return key; }
+
+private:
+    enum class Kind { ExactNoCase, Prefix, Suffix, Contains, Glob, Regex };
+
+    struct GlobStep {
+        enum Type : char { Literal, AnyOne, AnySequence } type = Literal;
+        char ch = 0;  // lowercased, for Literal
+    };
+
+    struct Alternative {
+        Kind kind = Kind::ExactNoCase;
+        std::string text;  // lowercased literal for the exact/prefix/suffix/substring kinds
+        std::vector<GlobStep> glob;
+        std::shared_ptr<const std::regex> regex;
+    };
+
+    static Alternative compilePattern(const std::string& pattern, bool& valid);
+    static bool matchesAlternative(const Alternative& alternative, const std::string& name);
+
+    std::unordered_set<std::string> exactNames;
+    std::vector<Alternative> alternatives;
+    std::string key;
+};
@@ -1,18 +1,24 @@
 #include "Object.h"
 #include "Engine.h"
+#include "ObjectPrototype.h"
 #include "components/Component.h"
 #include "components/BodyComponent.h"
 #include "components/ComponentLibrary.h"
+#include "FrameProfiler.h"
+#include "TickScheduler.h"
+#include <algorithm>
 #include <iostream>
 
 Engine* Object::engineInstance = nullptr;
-std::unordered_set<Object*> Object::liveObjects;
 
 Object::Object() {
-    liveObjects.insert(this);
+    if (engineInstance) {
+        handle = engineInstance->getObjectSlots().allocate(this);
+    }
 }
 
 Object::~Object() {
+    setInWorld(false);
     if (!markedForDeath) {
         for (auto& component : components) {
             if (component) {
@@ -20,9 +26,12 @@ Object::~Object() {
             }
         }
     }
-    componentMap.clear();
+    componentSlots.fill(nullptr);
+    frameComponents.clear();
     components.clear();
-    liveObjects.erase(this);
+    if (engineInstance && !handle.isNull()) {
+        engineInstance->getObjectSlots().release(handle);
+    }
 }
 
 void Object::setEngine(Engine* engine) {
@@ -33,24 +42,98 @@ Engine* Object::getEngine() {
     return engineInstance;
 }
 
-bool Object::isAlive(const Object* object) {
-    if (object == nullptr) {
-        return false;
+void Object::setName(const std::string& n) {
+    if (n == name) {
+        return;
+    }
+    std::string oldName = std::move(name);
+    name = n;
+    if (inWorld && engineInstance) {
+        engineInstance->getNameIndex().rename(*this, oldName);
+    }
+}
+
+void Object::setInWorld(bool value) {
+    if (value == inWorld) {
+        return;
+    }
+    inWorld = value;
+    setSimulationLod(false, true, 0.0f);
+    if (engineInstance) {
+        if (value) {
+            engineInstance->getNameIndex().add(*this);
+        } else {
+            engineInstance->getNameIndex().remove(*this);
+        }
+        engineInstance->getMotionTracker().markMoved(handle);
+    }
+
+    // Components updated on their own cadence are scheduled only while in the world
+    if (frameComponents.size() != components.size()) {
+        TickScheduler& scheduler = TickScheduler::getInstance();
+        for (auto& component : components) {
+            if (value) {
+                scheduler.add(*this, *component);
+            } else {
+                scheduler.remove(*component);
+            }
+        }
+    }
+}
+
+Object* Object::resolve(ObjectHandle handle) {
+    if (!engineInstance || handle.isNull()) {
+        return nullptr;
     }
-    return liveObjects.find(const_cast<Object*>(object)) != liveObjects.end();
+    return engineInstance->getObjectSlots().resolve(handle);
 }
 
 void Object::update(float deltaTime) {
-    if (markedForDeath) {
+    if (markedForDeath || skipsSimulationStep()) {
         return;
     }
+    deltaTime = getStepDeltaTime(deltaTime);
 
-    // Update all components
-    for (auto& component : components) {
+    // Per-component-type timing only while profiling, so the normal path stays a plain loop
+    FrameProfiler& profiler = FrameProfiler::getInstance();
+    if (profiler.isEnabled()) {
+        for (Component* component : frameComponents) {
+            uint64_t start = FrameProfiler::now();
+            component->update(deltaTime);
+            profiler.recordComponentUpdate(*component, FrameProfiler::now() - start);
+        }
+        return;
+    }
+
+    // Update every component that runs each step (TickScheduler runs the others)
+    for (Component* component : frameComponents) {
         component->update(deltaTime);
     }
 }
 
+void Object::updatePhase(float deltaTime, bool parallelSafe) {
+    if (markedForDeath || skipsSimulationStep()) {
+        return;
+    }
+    deltaTime = getStepDeltaTime(deltaTime);
+
+    // The profiler isn't thread-safe, so only the serial phase is timed per component
+    FrameProfiler& profiler = FrameProfiler::getInstance();
+    bool profile = !parallelSafe && profiler.isEnabled();
+    for (Component* component : frameComponents) {
+        if (component->isParallelSafe() != parallelSafe) {
+            continue;
+        }
+        if (profile) {
+            uint64_t start = FrameProfiler::now();
+            component->update(deltaTime);
+            profiler.recordComponentUpdate(*component, FrameProfiler::now() - start);
+        } else {
+            component->update(deltaTime);
+        }
+    }
+}
+
 void Object::render(SDL_Renderer* renderer) {
     if (markedForDeath) {
         return;
@@ -62,6 +145,14 @@ void Object::render(SDL_Renderer* renderer) {
     }
 }
 
+float Object::getDrawOverhang() const {
+    float overhang = 0.0f;
+    for (const auto& component : components) {
+        overhang = std::max(overhang, component->getDrawOverhang());
+    }
+    return overhang;
+}
+
 void Object::use(Object& instigator) {
     if (markedForDeath) {
         return;
@@ -96,12 +187,18 @@ nlohmann::json Object::toJson() const {
 void Object::fromJson(const nlohmann::json& data) {
     // Load name if it exists
     if (data.contains("name")) {
-        name = data["name"].get<std::string>();
+        setName(data["name"].get<std::string>());
     }
     
     // Clear existing components
+    if (inWorld) {
+        for (auto& component : components) {
+            TickScheduler::getInstance().remove(*component);
+        }
+    }
+    frameComponents.clear();
     components.clear();
-    componentMap.clear();
+    componentSlots.fill(nullptr);
     
     if (!data.contains("components")) {
         return;
@@ -121,13 +218,8 @@ void Object::fromJson(const nlohmann::json& data) {
             // Use the component library to create the component
             auto component = library.createComponent(typeName, *this, componentData);
             
-            // Add to our component lists
-            Component* ptr = component.get();
-            components.push_back(std::move(component));
-            
-            // Get the type_index from the library and populate componentMap
-            std::type_index typeIdx = library.getTypeIndex(typeName);
-            componentMap[typeIdx] = ptr;
+            // Add to our component lists, filling the slot for its type ID
+            attachComponent(std::move(component), library.getTypeId(typeName));
         } catch (const std::exception& e) {
             // Component type not registered or other error
             // Skip this component
@@ -136,6 +228,23 @@ void Object::fromJson(const nlohmann::json& data) {
     }
 }
 
+void Object::attachComponent(ComponentPtr component, uint16_t typeId) {
+    if (!component) {
+        return;
+    }
+    componentSlots[typeId] = component.get();
+    trackTickRate(*component);
+    components.push_back(std::move(component));
+}
+
+void Object::trackTickRate(Component& component) {
+    if (component.getTickRate() == Component::TickRate::EveryFrame) {
+        frameComponents.push_back(&component);
+    } else if (inWorld) {
+        TickScheduler::getInstance().add(*this, component);
+    }
+}
+
 void Object::markForDeath() {
     if (markedForDeath) {
         return;
@@ -151,4 +260,43 @@ void Object::markForDeath() {
 
 bool Object::isMarkedForDeath() const {
     return markedForDeath;
+}
+
+void Object::parkInPool() {
+    markedForDeath = true;
+    setInWorld(false);
+    for (auto& component : components) {
+        component->onPooled();
+    }
+    if (engineInstance && !handle.isNull()) {
+        engineInstance->getObjectSlots().release(handle);
+    }
+    handle = ObjectHandle{};
+}
+
+void Object::leavePool() {
+    if (engineInstance) {
+        handle = engineInstance->getObjectSlots().allocate(this);
+    }
+    markedForDeath = false;
+    for (auto& component : components) {
+        component->onUnpooled();
+    }
+}
+
+bool Object::resetToPrototype(const ObjectPrototype& prototype) {
+    name = prototype.getName();
+
+    // Components must line up one-to-one with the prototype's entries
+    const auto& entries = prototype.getComponents();
+    if (entries.size() != components.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (componentSlots[entries[i].typeId] != components[i].get() ||
+            !prototype.resetComponent(*components[i], i)) {
+            return false;
+        }
+    }
+    return true;
 }
\ No newline at end of file
@@ -2,15 +2,17 @@
 #define OBJECT_H
 
 #include <SDL.h>
+#include <array>
 #include <vector>
 #include <memory>
-#include <typeindex>
-#include <unordered_map>
-#include <unordered_set>
 #include <nlohmann/json.hpp>
+#include "ObjectHandle.h"
+#include "components/ComponentPool.h"
+#include "components/ComponentTypeId.h"
 
 class Component;
 class Engine;
+class ObjectPrototype;
 
 class Object {
     public:
@@ -18,66 +20,106 @@ class Object {
         virtual ~Object();
         
         void update(float deltaTime = 1.0f / 60.0f);
+        // Update only the components whose isParallelSafe() matches (Engine's parallel/serial phases)
+        void updatePhase(float deltaTime, bool parallelSafe);
         void render(SDL_Renderer* renderer);
         void use(Object& instigator);
         
         // Name management
-        void setName(const std::string& n) { name = n; }
+        void setName(const std::string& n);
         const std::string& getName() const { return name; }
         
         // Component management
         template<typename T, typename... Args>
         T* addComponent(Args&&... args) {
-            auto component = std::make_unique<T>(*this, std::forward<Args>(args)...);
-            T* ptr = component.get();
+            ComponentPtr component = makeComponent<T>(*this, std::forward<Args>(args)...);
+            T* ptr = static_cast<T*>(component.get());
             components.push_back(std::move(component));
-            componentMap[std::type_index(typeid(T))] = ptr;
+            componentSlots[componentTypeId<T>()] = ptr;
+            trackTickRate(*ptr);
             return ptr;
         }
         
+        // Lookups are a single indexed load into the slot table
         template<typename T>
         T* getComponent() {
-            auto it = componentMap.find(std::type_index(typeid(T)));
-            if (it != componentMap.end()) {
-                return static_cast<T*>(it->second);
-            }
-            return nullptr;
+            return static_cast<T*>(componentSlots[componentTypeId<T>()]);
         }
         
         template<typename T>
         const T* getComponent() const {
-            auto it = componentMap.find(std::type_index(typeid(T)));
-            if (it != componentMap.end()) {
-                return static_cast<T*>(it->second);
-            }
-            return nullptr;
+            return static_cast<const T*>(componentSlots[componentTypeId<T>()]);
         }
 
         template<typename T>
         bool hasComponent() const {
-            return componentMap.find(std::type_index(typeid(T))) != componentMap.end();
+            return componentSlots[componentTypeId<T>()] != nullptr;
         }
         
         // Serialization
         nlohmann::json toJson() const;
         void fromJson(const nlohmann::json& data);
         
+        // Add a component created by a factory (type ID from ComponentLibrary)
+        void attachComponent(ComponentPtr component, uint16_t typeId);
+        
         // Static method to set/get Engine instance
         static void setEngine(Engine* engine);
         static Engine* getEngine();
-        static bool isAlive(const Object* object);
+        
+        // Generational handle for holding on to this object across frames
+        ObjectHandle getHandle() const { return handle; }
+        static Object* resolve(ObjectHandle handle);  // nullptr once the object is destroyed
+        static bool isAlive(ObjectHandle handle) { return resolve(handle) != nullptr; }
 
         // Lifecycle management
         void markForDeath();
         bool isMarkedForDeath() const;
         
+        // Set by Engine once the object is in its object list (pooled updates skip queued objects);
+        // while set, the object is listed in the engine's name index
+        void setInWorld(bool value);
+        bool isInWorld() const { return inWorld; }
+
+        // Simulation LOD (SimulationLod): while dormant, components that run every step run
+        // only on the steps it picks, with the time gathered since they last ran
+        void setSimulationLod(bool dormant, bool runsThisStep, float deltaTime) {
+            lodDormant = dormant;
+            lodRunsThisStep = runsThisStep;
+            lodDeltaTime = deltaTime;
+        }
+        bool skipsSimulationStep() const { return lodDormant && !lodRunsThisStep; }
+        float getStepDeltaTime(float deltaTime) const { return lodDormant ? lodDeltaTime : deltaTime; }
+
+        // Largest Component::getDrawOverhang of the components
+        float getDrawOverhang() const;
+
+        // Object pooling (ObjectPool): prefab this object was built from, -1 if not pooled
+        void setPoolPrefab(int prefab) { poolPrefab = prefab; }
+        int getPoolPrefab() const { return poolPrefab; }
+        // Retire the handle and put components to sleep without running death hooks
+        void parkInPool();
+        // Come back to life with a fresh handle
+        void leavePool();
+        // Return every component to the prototype's state (false if any can't)
+        bool resetToPrototype(const ObjectPrototype& prototype);
+        
     private:
+        // Lists EveryFrame components for the update loops; the rest go through TickScheduler
+        void trackTickRate(Component& component);
+
         std::string name;
-        std::vector<std::unique_ptr<Component>> components;
-        std::unordered_map<std::type_index, Component*> componentMap;
+        std::vector<ComponentPtr> components;
+        std::vector<Component*> frameComponents;  // getTickRate() == EveryFrame, in component order
+        std::array<Component*, kMaxComponentTypes> componentSlots{};  // indexed by componentTypeId<T>()
         static Engine* engineInstance;
-        static std::unordered_set<Object*> liveObjects;
+        ObjectHandle handle;
         bool markedForDeath = false;
+        bool inWorld = false;
+        int poolPrefab = -1;
+        bool lodDormant = false;
+        bool lodRunsThisStep = true;
+        float lodDeltaTime = 0.0f;
 };
 
 #endif // OBJECT_H
\ No newline at end of file
@@ -0,0 +1,31 @@
+#include "ObjectHandle.h"
+
+ObjectHandle ObjectSlotTable::allocate(Object* object) {
+    uint32_t index;
+    if (!freeSlots.empty()) {
+        index = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        index = static_cast<uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+    Slot& slot = slots[index];
+    slot.object = object;
+    return ObjectHandle{index, slot.generation};
+}
+
+void ObjectSlotTable::release(ObjectHandle handle) {
+    if (handle.index >= slots.size()) {
+        return;
+    }
+    Slot& slot = slots[handle.index];
+    if (slot.generation != handle.generation) {
+        return;
+    }
+    slot.object = nullptr;
+    // Skip 0 on wrap-around so a recycled slot never hands out the null generation
+    if (++slot.generation == 0) {
+        slot.generation = 1;
+    }
+    freeSlots.push_back(handle.index);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class Object;
+
+// Weak reference to an Object: a slot index plus the generation the slot had when the
+// object was created. Resolving a handle after its object is destroyed yields nullptr,
+// even if a new object reuses the slot (or the old object's address).
+struct ObjectHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;  // 0 is never issued, so a default handle is null
+
+    bool isNull() const { return generation == 0; }
+
+    bool operator==(const ObjectHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const ObjectHandle& other) const { return !(*this == other); }
+};
+
+namespace std {
+template<>
+struct hash<ObjectHandle> {
+    size_t operator()(const ObjectHandle& handle) const noexcept {
+        return std::hash<uint64_t>()((static_cast<uint64_t>(handle.generation) << 32) | handle.index);
+    }
+};
+}
+
+// Slot array owned by Engine. Slots are recycled through a free list; each release bumps
+// the slot's generation so outstanding handles to the old object stop resolving.
+class ObjectSlotTable {
+public:
+    ObjectHandle allocate(Object* object);
+    void release(ObjectHandle handle);
+
+    Object* resolve(ObjectHandle handle) const {
+        if (handle.index >= slots.size()) {
+            return nullptr;
+        }
+        const Slot& slot = slots[handle.index];
+        return slot.generation == handle.generation ? slot.object : nullptr;
+    }
+
+    size_t liveCount() const { return slots.size() - freeSlots.size(); }
+
+private:
+    struct Slot {
+        Object* object = nullptr;
+        uint32_t generation = 1;
+    };
+
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+};
@@ -0,0 +1,125 @@
+#include "ObjectPool.h"
+#include "Object.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+// Parked instances kept per prefab; deaths beyond this are destroyed normally
+constexpr size_t kMaxParkedPerPrefab = 64;
+}
+
+ObjectPool::ObjectPool() = default;
+
+ObjectPool::~ObjectPool() = default;
+
+ObjectPool::PrefabId ObjectPool::registerPrefab(const nlohmann::json& definition, size_t reserve) {
+    std::string key = definition.dump();
+    auto it = prefabsByDefinition.find(key);
+    if (it != prefabsByDefinition.end()) {
+        Prefab& prefab = prefabs[it->second];
+        prefab.reserve = std::max(prefab.reserve, std::min(reserve, kMaxParkedPerPrefab));
+        return it->second;
+    }
+
+    PrefabId id = static_cast<PrefabId>(prefabs.size());
+    Prefab& prefab = prefabs.emplace_back(definition);
+    prefab.reserve = std::min(reserve, kMaxParkedPerPrefab);
+    prefabsByDefinition.emplace(std::move(key), id);
+    return id;
+}
+
+ObjectPool::PrefabId ObjectPool::registerSpriteEffect(const std::string& spriteName, bool loop, size_t reserve) {
+    nlohmann::json sprite;
+    sprite["type"] = "SpriteComponent";
+    sprite["spriteName"] = spriteName;
+    sprite["animating"] = true;
+    sprite["looping"] = loop;
+
+    nlohmann::json definition;
+    definition["name"] = spriteName;
+    definition["components"] = nlohmann::json::array({sprite});
+    return registerPrefab(definition, reserve);
+}
+
+std::unique_ptr<Object> ObjectPool::acquire(PrefabId prefab) {
+    if (prefab < 0 || prefab >= static_cast<PrefabId>(prefabs.size())) {
+        return nullptr;
+    }
+
+    auto& parked = prefabs[prefab].parked;
+    if (parked.empty()) {
+        return build(prefab);
+    }
+
+    std::unique_ptr<Object> object = std::move(parked.back());
+    parked.pop_back();
+    object->leavePool();
+    return object;
+}
+
+bool ObjectPool::recycle(std::unique_ptr<Object>& object) {
+    if (!object) {
+        return false;
+    }
+    PrefabId id = object->getPoolPrefab();
+    if (id < 0 || id >= static_cast<PrefabId>(prefabs.size())) {
+        return false;
+    }
+    Prefab& prefab = prefabs[id];
+    if (!prefab.recyclable || prefab.parked.size() >= kMaxParkedPerPrefab) {
+        return false;
+    }
+    park(prefab, object);
+    return true;
+}
+
+void ObjectPool::prewarm() {
+    size_t built = 0;
+    // Index loop: building an instance can register further prefabs (e.g. its explosion)
+    for (size_t i = 0; i < prefabs.size(); ++i) {
+        while (prefabs[i].recyclable && prefabs[i].parked.size() < prefabs[i].reserve) {
+            std::unique_ptr<Object> object = build(static_cast<PrefabId>(i));
+            park(prefabs[i], object);
+            if (prefabs[i].recyclable) {
+                ++built;
+            }
+        }
+    }
+    if (built > 0) {
+        std::cout << "ObjectPool: Prewarmed " << built << " objects across " << prefabs.size() << " prefabs" << std::endl;
+    }
+}
+
+void ObjectPool::clear() {
+    prefabs.clear();
+    prefabsByDefinition.clear();
+}
+
+size_t ObjectPool::getParkedCount() const {
+    size_t count = 0;
+    for (const Prefab& prefab : prefabs) {
+        count += prefab.parked.size();
+    }
+    return count;
+}
+
+std::unique_ptr<Object> ObjectPool::build(PrefabId prefab) const {
+    auto object = std::make_unique<Object>();
+    prefabs[prefab].prototype.instantiateCopy(*object);
+    object->setPoolPrefab(prefab);
+    return object;
+}
+
+void ObjectPool::park(Prefab& prefab, std::unique_ptr<Object>& object) {
+    // Park first so an object that can't be reset is destroyed without death side effects
+    object->parkInPool();
+    if (!object->resetToPrototype(prefab.prototype)) {
+        std::cerr << "ObjectPool: Prefab '" << prefab.prototype.getName()
+                  << "' has components that can't be reset, instances won't be recycled" << std::endl;
+        prefab.recyclable = false;
+        object.reset();
+        return;
+    }
+    prefab.parked.push_back(std::move(object));
+}
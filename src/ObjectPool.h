@@ -0,0 +1,65 @@
+#pragma once
+
+#include "ObjectPrototype.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Object;
+
+// Recycles objects that are spawned and destroyed in bursts (spawner output, explosions,
+// weapon hit effects). A prefab is a resolved object definition compiled to an
+// ObjectPrototype: dead instances are reset to it and parked (bodies disabled, handles
+// retired) instead of being destroyed, and acquire() hands them out again with a fresh
+// handle. Prefabs whose components can't be reset fall back to normal destruction.
+class ObjectPool {
+public:
+    using PrefabId = int;
+    static constexpr PrefabId kInvalidPrefab = -1;
+
+    ObjectPool();
+    ~ObjectPool();
+
+    // Register a prefab (identical definitions share one); reserve is how many instances
+    // prewarm() builds ahead of time
+    PrefabId registerPrefab(const nlohmann::json& definition, size_t reserve = 0);
+
+    // One-shot animated sprite (explosions, hit effects); callers set size/position/loops
+    PrefabId registerSpriteEffect(const std::string& spriteName, bool loop, size_t reserve = 0);
+
+    // Parked instance or a freshly built one, ready for Engine::queueObject (nullptr for unknown prefabs)
+    std::unique_ptr<Object> acquire(PrefabId prefab);
+
+    // Take a dead object back (false: not from a recyclable prefab, the caller destroys it)
+    bool recycle(std::unique_ptr<Object>& object);
+
+    // Build parked instances up to each prefab's reserve (Engine::loadFile, after level objects)
+    void prewarm();
+
+    // Drop all prefabs and parked objects (level change, physics world teardown)
+    void clear();
+
+    size_t getParkedCount() const;
+
+private:
+    struct Prefab {
+        explicit Prefab(const nlohmann::json& definition) : prototype(definition) {}
+
+        ObjectPrototype prototype;
+        size_t reserve = 0;
+        bool recyclable = true;
+        std::vector<std::unique_ptr<Object>> parked;
+    };
+
+    std::unique_ptr<Object> build(PrefabId prefab) const;
+    void park(Prefab& prefab, std::unique_ptr<Object>& object);
+
+    std::deque<Prefab> prefabs;  // stable addresses: building an instance can register more prefabs
+    std::unordered_map<std::string, PrefabId> prefabsByDefinition;
+};
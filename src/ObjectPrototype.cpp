@@ -0,0 +1,146 @@
+#include "ObjectPrototype.h"
+#include "Engine.h"
+#include "Object.h"
+
+#include <iostream>
+
+// One component per entry with a typed copy, parsed from the entry's data, on an owner that
+// never enters the world; components go before their owner
+struct ObjectPrototype::Seeds {
+    std::unique_ptr<Object> owner;
+    std::vector<ComponentPtr> components;  // by entry; null where there's no typed copy
+};
+
+ObjectPrototype::ObjectPrototype(const nlohmann::json& definition) {
+    if (!definition.is_object()) {
+        return;
+    }
+    if (definition.contains("name") && definition["name"].is_string()) {
+        name = definition["name"].get<std::string>();
+    }
+    if (!definition.contains("components") || !definition["components"].is_array()) {
+        return;
+    }
+
+    components.reserve(definition["components"].size());
+    for (const auto& componentData : definition["components"]) {
+        appendComponent(componentData);
+    }
+}
+
+ObjectPrototype::ObjectPrototype(const ObjectPrototype& base, const nlohmann::json& overrides)
+    : name(base.name), components(base.components) {
+    if (!overrides.is_object()) {
+        return;
+    }
+    if (overrides.contains("name") && overrides["name"].is_string()) {
+        name = overrides["name"].get<std::string>();
+    }
+    auto overrideComponents = overrides.find("components");
+    if (overrideComponents == overrides.end() || !overrideComponents->is_array()) {
+        return;
+    }
+
+    // Components added by overrides start after the base's; later ones of a type win, as in
+    // Engine::mergeObjectDefinitions
+    for (const auto& componentOverride : *overrideComponents) {
+        auto typeIt = componentOverride.is_object() ? componentOverride.find("type") : componentOverride.end();
+        if (!componentOverride.is_object() || typeIt == componentOverride.end() || !typeIt->is_string()) {
+            continue;  // untyped entries never become components
+        }
+        const std::string& typeName = typeIt->get_ref<const std::string&>();
+
+        bool merged = false;
+        for (size_t i = components.size(); i-- > 0;) {
+            if (components[i].typeName == typeName) {
+                Engine::mergeComponentData(components[i].data, componentOverride);
+                merged = true;
+                break;
+            }
+        }
+        if (!merged) {
+            appendComponent(componentOverride);
+        }
+    }
+}
+
+bool ObjectPrototype::appendComponent(const nlohmann::json& componentData) {
+    if (!componentData.is_object() || !componentData.contains("type") || !componentData["type"].is_string()) {
+        return false;
+    }
+
+    ComponentLibrary& library = ComponentLibrary::getInstance();
+    ComponentEntry entry;
+    entry.typeName = componentData["type"].get<std::string>();
+    entry.factory = library.findFactory(entry.typeName);
+    if (!entry.factory) {
+        std::cerr << "Warning: Failed to create component '" << entry.typeName
+                  << "': Component type not registered" << std::endl;
+        return false;
+    }
+    entry.typeId = library.getTypeId(entry.typeName);
+    entry.typedCopy = library.findTypedCopy(entry.typeName);
+    entry.data = componentData;
+    components.push_back(std::move(entry));
+    return true;
+}
+
+void ObjectPrototype::instantiate(Object& object) const {
+    object.setName(name);
+    for (const ComponentEntry& entry : components) {
+        attachComponent(object, entry, nullptr);
+    }
+}
+
+void ObjectPrototype::instantiateCopy(Object& object) const {
+    const Seeds& built = getSeeds();
+    object.setName(name);
+    for (size_t i = 0; i < components.size(); ++i) {
+        attachComponent(object, components[i], built.components[i].get());
+    }
+}
+
+bool ObjectPrototype::resetComponent(Component& component, size_t index) const {
+    const ComponentEntry& entry = components[index];
+    if (entry.typedCopy) {
+        if (const Component* seed = getSeeds().components[index].get()) {
+            entry.typedCopy->reset(component, *seed);
+            return true;
+        }
+    }
+    return component.resetToPrototype(entry.data);
+}
+
+void ObjectPrototype::attachComponent(Object& object, const ComponentEntry& entry, const Component* seed) const {
+    try {
+        if (seed) {
+            object.attachComponent(entry.typedCopy->copy(object, *seed), entry.typeId);
+        } else {
+            object.attachComponent((*entry.factory)(object, entry.data), entry.typeId);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Warning: Failed to create component '" << entry.typeName << "': " << e.what() << std::endl;
+    }
+}
+
+const ObjectPrototype::Seeds& ObjectPrototype::getSeeds() const {
+    if (seeds) {
+        return *seeds;
+    }
+    auto built = std::make_shared<Seeds>();
+    built->owner = std::make_unique<Object>();
+    built->owner->setName(name);
+    built->components.resize(components.size());
+    for (size_t i = 0; i < components.size(); ++i) {
+        if (!components[i].typedCopy) {
+            continue;
+        }
+        try {
+            built->components[i] = (*components[i].factory)(*built->owner, components[i].data);
+        } catch (const std::exception&) {
+            // Left null: instances build this one from its data and report the error there
+        }
+    }
+    seeds = std::move(built);
+    return *seeds;
+}
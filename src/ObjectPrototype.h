@@ -0,0 +1,62 @@
+#pragma once
+
+#include "components/ComponentLibrary.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Object;
+
+// An object definition compiled once into typed component entries: factories and type IDs
+// are resolved up front, so instantiating is a direct factory call per component reading
+// the prototype's own data. Prototypes derived from a template with overrides (level
+// entries) only copy and patch the components they touch. Immutable after construction.
+//
+// The factories are still the JSON constructors, so instantiate() parses each entry's data.
+// Prototypes built over and over (ObjectPool prefabs) use instantiateCopy/resetComponent
+// instead: components whose type registered a typed copy (ComponentCopyRegistrar: sprites,
+// health, collision damage) are copied from a seed parsed once, and only the other types
+// (bodies, sounds, ...) go through their data again.
+class ObjectPrototype {
+public:
+    struct ComponentEntry {
+        std::string typeName;
+        uint16_t typeId = 0;
+        const ComponentFactory* factory = nullptr;
+        const ComponentTypedCopy* typedCopy = nullptr;  // nullptr: built from data every time
+        nlohmann::json data;
+    };
+
+    // definition is a resolved object definition ({"name", "components"}, no "template")
+    explicit ObjectPrototype(const nlohmann::json& definition);
+
+    // base plus a level entry on top: "name" replaces the base's, and each entry in
+    // "components" is merged into the component of the same type (or appended) following
+    // Engine::buildObjectDefinition's rules
+    ObjectPrototype(const ObjectPrototype& base, const nlohmann::json& overrides);
+
+    // Create the prototype's components on an empty object
+    void instantiate(Object& object) const;
+    // Same, copying typed components from seeds; main thread only (seeds are built on first use)
+    void instantiateCopy(Object& object) const;
+    // Reset an instance's component made from entry index to the prototype's state
+    bool resetComponent(Component& component, size_t index) const;
+
+    const std::string& getName() const { return name; }
+    const std::vector<ComponentEntry>& getComponents() const { return components; }
+
+private:
+    struct Seeds;
+
+    bool appendComponent(const nlohmann::json& componentData);
+    void attachComponent(Object& object, const ComponentEntry& entry, const Component* seed) const;
+    const Seeds& getSeeds() const;
+
+    std::string name;
+    std::vector<ComponentEntry> components;
+    mutable std::shared_ptr<Seeds> seeds;  // shared by copies, which have the same entries
+};
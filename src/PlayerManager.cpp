@@ -1,4 +1,5 @@
 #include "PlayerManager.h"
+#include "InputRecorder.h"
 #include <algorithm>
 #include <iostream>
 
@@ -106,6 +107,14 @@ void PlayerManager::unassignPlayer(int playerId) {
 }
 
 float PlayerManager::getInputValue(int playerId, GameAction action, const std::string& configName) const {
+    // Replay supplies the values this player resolved to when the session was recorded
+    InputRecorder& recorder = InputRecorder::getInstance();
+    if (recorder.isReplaying()) {
+        size_t actionIndex = static_cast<size_t>(action);
+        const InputRecorder::ActionValues& values = recorder.getReplayedPlayerInput(playerId);
+        return actionIndex < values.size() ? values[actionIndex] : 0.0f;
+    }
+
     std::lock_guard<std::mutex> lock(playersMutex);
     
     auto it = players.find(playerId);
@@ -203,6 +212,11 @@ std::string PlayerManager::getPlayerNetworkId(int playerId) const {
 
 void PlayerManager::setNetworkInput(int playerId, float moveUp, float moveDown, float moveLeft, float moveRight,
                                     float actionWalk, float actionInteract, float actionThrow) {
+    // Live network input must not perturb a replay (recorded values already include it)
+    if (InputRecorder::getInstance().isReplaying()) {
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(playersMutex);
     
     auto it = players.find(playerId);
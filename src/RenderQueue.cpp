@@ -0,0 +1,228 @@
+#include "RenderQueue.h"
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+// How many batches back a quad may look for one with its texture
+constexpr size_t kMaxLookback = 32;
+
+bool overlaps(const SDL_FRect& a, const SDL_FRect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+SDL_FRect unite(const SDL_FRect& a, const SDL_FRect& b) {
+    const float minX = std::min(a.x, b.x);
+    const float minY = std::min(a.y, b.y);
+    const float maxX = std::max(a.x + a.w, b.x + b.w);
+    const float maxY = std::max(a.y + a.h, b.y + b.h);
+    return {minX, minY, maxX - minX, maxY - minY};
+}
+}
+
+RenderQueue& RenderQueue::getInstance() {
+    static RenderQueue instance;
+    return instance;
+}
+
+void RenderQueue::submit(SDL_Texture* texture, const SDL_Rect& src, const SDL_FRect& dst, float angleDegrees,
+                         SDL_RendererFlip flip, SDL_Color tint, int layer) {
+    if (!texture || dst.w <= 0.0f || dst.h <= 0.0f) {
+        return;
+    }
+    if (texture != sizedTexture) {
+        int width = 0;
+        int height = 0;
+        if (SDL_QueryTexture(texture, nullptr, nullptr, &width, &height) != 0 || width <= 0 || height <= 0) {
+            return;
+        }
+        sizedTexture = texture;
+        textureWidth = static_cast<float>(width);
+        textureHeight = static_cast<float>(height);
+    }
+
+    float u0 = static_cast<float>(src.x) / textureWidth;
+    float v0 = static_cast<float>(src.y) / textureHeight;
+    float u1 = static_cast<float>(src.x + src.w) / textureWidth;
+    float v1 = static_cast<float>(src.y + src.h) / textureHeight;
+    if (flip & SDL_FLIP_HORIZONTAL) {
+        std::swap(u0, u1);
+    }
+    if (flip & SDL_FLIP_VERTICAL) {
+        std::swap(v0, v1);
+    }
+
+    Quad& quad = quads.emplace_back();
+    quad.texture = texture;
+    quad.layer = layer;
+
+    // Corners clockwise from top-left, relative to the centre
+    const float halfW = dst.w * 0.5f;
+    const float halfH = dst.h * 0.5f;
+    const float centerX = dst.x + halfW;
+    const float centerY = dst.y + halfH;
+    const float cornerX[4] = {-halfW, halfW, halfW, -halfW};
+    const float cornerY[4] = {-halfH, -halfH, halfH, halfH};
+    const float cornerU[4] = {u0, u1, u1, u0};
+    const float cornerV[4] = {v0, v0, v1, v1};
+
+    float cosA = 1.0f;
+    float sinA = 0.0f;
+    if (angleDegrees != 0.0f) {
+        const float radians = angleDegrees * static_cast<float>(M_PI) / 180.0f;
+        cosA = std::cos(radians);
+        sinA = std::sin(radians);
+    }
+
+    float minX = centerX;
+    float minY = centerY;
+    float maxX = centerX;
+    float maxY = centerY;
+    for (int i = 0; i < 4; ++i) {
+        // Screen y points down, so this turns clockwise like SDL_RenderCopyEx
+        const float x = centerX + cornerX[i] * cosA - cornerY[i] * sinA;
+        const float y = centerY + cornerX[i] * sinA + cornerY[i] * cosA;
+        quad.vertices[i].position = {x, y};
+        quad.vertices[i].color = tint;
+        quad.vertices[i].tex_coord = {cornerU[i], cornerV[i]};
+        minX = std::min(minX, x);
+        minY = std::min(minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    }
+    quad.bounds = {minX, minY, maxX - minX, maxY - minY};
+}
+
+void RenderQueue::submitLine(float x0, float y0, float x1, float y1, float thickness, SDL_Color color, int layer) {
+    const float dx = x1 - x0;
+    const float dy = y1 - y0;
+    const float length = std::sqrt(dx * dx + dy * dy);
+    if (length <= 0.0f || thickness <= 0.0f) {
+        return;
+    }
+
+    // Offset both ends half the thickness to either side of the line
+    const float offsetX = -dy / length * thickness * 0.5f;
+    const float offsetY = dx / length * thickness * 0.5f;
+    const float cornerX[4] = {x0 + offsetX, x1 + offsetX, x1 - offsetX, x0 - offsetX};
+    const float cornerY[4] = {y0 + offsetY, y1 + offsetY, y1 - offsetY, y0 - offsetY};
+
+    Quad& quad = quads.emplace_back();
+    quad.layer = layer;
+    float minX = cornerX[0];
+    float minY = cornerY[0];
+    float maxX = cornerX[0];
+    float maxY = cornerY[0];
+    for (int i = 0; i < 4; ++i) {
+        quad.vertices[i].position = {cornerX[i], cornerY[i]};
+        quad.vertices[i].color = color;
+        quad.vertices[i].tex_coord = {0.0f, 0.0f};
+        minX = std::min(minX, cornerX[i]);
+        minY = std::min(minY, cornerY[i]);
+        maxX = std::max(maxX, cornerX[i]);
+        maxY = std::max(maxY, cornerY[i]);
+    }
+    quad.bounds = {minX, minY, maxX - minX, maxY - minY};
+}
+
+void RenderQueue::buildBatches() {
+    order.resize(quads.size());
+    for (uint32_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        return quads[a].layer < quads[b].layer;
+    });
+
+    // Each quad goes into the most recent batch with its texture, unless a later batch in
+    // the same layer covers part of it and would end up underneath
+    batches.clear();
+    quadBatch.resize(order.size());
+    size_t layerStart = 0;
+    for (size_t i = 0; i < order.size(); ++i) {
+        const Quad& quad = quads[order[i]];
+        if (i > 0 && quad.layer != quads[order[i - 1]].layer) {
+            layerStart = batches.size();
+        }
+
+        size_t target = batches.size();
+        const size_t stop = batches.size() - std::min(batches.size() - layerStart, kMaxLookback);
+        for (size_t b = batches.size(); b > stop; --b) {
+            Batch& batch = batches[b - 1];
+            if (batch.texture == quad.texture) {
+                target = b - 1;
+                break;
+            }
+            if (overlaps(batch.bounds, quad.bounds)) {
+                break;
+            }
+        }
+
+        if (target == batches.size()) {
+            Batch& batch = batches.emplace_back();
+            batch.texture = quad.texture;
+            batch.bounds = quad.bounds;
+        } else {
+            batches[target].bounds = unite(batches[target].bounds, quad.bounds);
+        }
+        ++batches[target].quadCount;
+        quadBatch[i] = static_cast<uint32_t>(target);
+    }
+
+    // Lay the vertices out batch by batch, keeping submission order inside each batch
+    uint32_t nextVertex = 0;
+    size_t largestBatch = 0;
+    for (Batch& batch : batches) {
+        batch.firstVertex = nextVertex;
+        nextVertex += batch.quadCount * 4;
+        largestBatch = std::max(largestBatch, static_cast<size_t>(batch.quadCount));
+        batch.quadCount = 0;
+    }
+    vertices.resize(nextVertex);
+    for (size_t i = 0; i < order.size(); ++i) {
+        Batch& batch = batches[quadBatch[i]];
+        std::copy(std::begin(quads[order[i]].vertices), std::end(quads[order[i]].vertices),
+                  vertices.begin() + batch.firstVertex + batch.quadCount * 4);
+        ++batch.quadCount;
+    }
+
+    for (size_t q = indices.size() / 6; q < largestBatch; ++q) {
+        const int base = static_cast<int>(q * 4);
+        indices.insert(indices.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+    }
+}
+
+void RenderQueue::flush(SDL_Renderer* renderer) {
+    if (quads.empty()) {
+        sizedTexture = nullptr;
+        return;
+    }
+    if (!renderer) {
+        clear();
+        return;
+    }
+
+    buildBatches();
+    for (const Batch& batch : batches) {
+        if (SDL_RenderGeometry(renderer, batch.texture, vertices.data() + batch.firstVertex,
+                               static_cast<int>(batch.quadCount * 4), indices.data(),
+                               static_cast<int>(batch.quadCount * 6)) != 0) {
+            std::cerr << "RenderQueue: SDL_RenderGeometry failed: " << SDL_GetError() << std::endl;
+        }
+    }
+
+    FrameProfiler& profiler = FrameProfiler::getInstance();
+    if (profiler.isEnabled()) {
+        profiler.addCounter("Sprite quads", static_cast<double>(quads.size()));
+        profiler.addCounter("Sprite batches", static_cast<double>(batches.size()));
+    }
+    clear();
+}
+
+void RenderQueue::clear() {
+    quads.clear();
+    batches.clear();
+    sizedTexture = nullptr;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Sprite draw list for the object pass. Components submit quads instead of
+ * drawing them, and Engine::render flushes the list once every object has drawn: a few
+ * SDL_RenderGeometry calls instead of one SDL_RenderCopyExF per sprite. Tint and alpha
+ * travel in the vertex colours, so there are no texture colour/alpha mod changes either.
+ *
+ * Quads draw by layer, then in submission order. Within a layer a quad joins an earlier
+ * batch with the same texture as long as no batch in between overlaps it on screen, so
+ * the result matches drawing in submission order while same-texture quads share a call.
+ * Anything drawn during the object pass has to go through here (lines included); a
+ * direct SDL draw call would land underneath every queued sprite.
+ */
+class RenderQueue {
+public:
+    static RenderQueue& getInstance();
+
+    // src in texture pixels, dst in screen pixels, rotated angleDegrees clockwise around
+    // the centre of dst (as SDL_RenderCopyExF)
+    void submit(SDL_Texture* texture, const SDL_Rect& src, const SDL_FRect& dst, float angleDegrees,
+                SDL_RendererFlip flip, SDL_Color tint, int layer = 0);
+
+    // Untextured line from (x0, y0) to (x1, y1), thickness pixels wide, drawn as a quad with
+    // the renderer's draw blend mode (like SDL_RenderDrawLineF), so it stays in order with
+    // the sprites around it
+    void submitLine(float x0, float y0, float x1, float y1, float thickness, SDL_Color color, int layer = 0);
+
+    // Draw everything queued since the last flush and empty the queue
+    void flush(SDL_Renderer* renderer);
+    void clear();
+
+    size_t size() const { return quads.size(); }
+
+private:
+    struct Quad {
+        SDL_Texture* texture = nullptr;  // nullptr: untextured (lines)
+        int layer = 0;
+        SDL_FRect bounds{};  // screen-space box around the (rotated) corners
+        SDL_Vertex vertices[4];
+    };
+
+    struct Batch {
+        SDL_Texture* texture = nullptr;
+        SDL_FRect bounds{};  // union of its quads
+        uint32_t quadCount = 0;
+        uint32_t firstVertex = 0;
+    };
+
+    RenderQueue() = default;
+    ~RenderQueue() = default;
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    void buildBatches();
+
+    std::vector<Quad> quads;
+    std::vector<uint32_t> order;        // quad indices by layer, then submission
+    std::vector<uint32_t> quadBatch;    // batch of each entry in order
+    std::vector<Batch> batches;
+    std::vector<SDL_Vertex> vertices;   // batch by batch
+    std::vector<int> indices;           // two triangles per quad, shared by every batch
+
+    // Size of the texture submitted last (consecutive sprites usually share one)
+    SDL_Texture* sizedTexture = nullptr;
+    float textureWidth = 1.0f;
+    float textureHeight = 1.0f;
+};
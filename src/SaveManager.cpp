@@ -3,12 +3,14 @@
 #include "BackgroundManager.h"
 #include "Object.h"
 #include "GlobalValueManager.h"
+#include "LevelFormat.h"
 #include <fstream>
 #include <iostream>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
 #include <filesystem>
+#include <climits>
 
 SaveManager& SaveManager::getInstance() {
     static SaveManager instance;
@@ -327,13 +329,33 @@ bool SaveManager::hasNextLevelAvailable() const {
     }
     
     // Look for a level with order > progression
+    return !findNextLevelPath(progression).empty();
+}
+
+std::string SaveManager::findNextLevelPath(int afterOrder) {
     std::string levelsDir = "assets/levels";
+    std::string nextLevelPath;
+    int lowestOrder = INT_MAX;
     
     try {
         if (std::filesystem::exists(levelsDir) && std::filesystem::is_directory(levelsDir)) {
             for (const auto& entry : std::filesystem::directory_iterator(levelsDir)) {
                 if (entry.is_regular_file() && entry.path().extension() == ".json") {
                     std::string filePath = entry.path().string();
+
+                    // The compiled level's header carries the order; no need to parse the JSON
+                    BinaryLevel binary;
+                    if (binary.openFor(filePath, LevelFormat::Kind::Level)) {
+                        if (binary.hasOrder()) {
+                            int order = binary.getOrder();
+                            if (order > afterOrder && order < lowestOrder) {
+                                lowestOrder = order;
+                                nextLevelPath = filePath;
+                            }
+                        }
+                        continue;
+                    }
+
                     std::ifstream file(filePath);
                     if (file.is_open()) {
                         nlohmann::json levelJson;
@@ -343,8 +365,11 @@ bool SaveManager::hasNextLevelAvailable() const {
                             
                             if (levelJson.contains("order") && levelJson["order"].is_number_integer()) {
                                 int order = levelJson["order"].get<int>();
-                                if (order > progression) {
-                                    return true;  // Found a level with higher order
+                                
+                                // Find level with lowest order above afterOrder
+                                if (order > afterOrder && order < lowestOrder) {
+                                    lowestOrder = order;
+                                    nextLevelPath = filePath;
                                 }
                             }
                         } catch (...) {
@@ -355,10 +380,9 @@ bool SaveManager::hasNextLevelAvailable() const {
             }
         }
     } catch (const std::filesystem::filesystem_error& e) {
-        // Filesystem error, return false
-        return false;
+        std::cerr << "SaveManager: Filesystem error: " << e.what() << std::endl;
     }
     
-    return false;  // No level found with order > progression
+    return nextLevelPath;
 }
 
@@ -58,6 +58,10 @@ public:
     // Check if there's a level with order higher than current progression
     bool hasNextLevelAvailable() const;
     
+    // Path of the level with the lowest order above afterOrder (empty if none); reads only the
+    // level files, so it's safe to call from loader threads
+    static std::string findNextLevelPath(int afterOrder);
+    
 private:
     SaveManager() = default;
     ~SaveManager() = default;
@@ -17,6 +17,13 @@ void SensorEventManager::processWorldEvents(b2WorldId worldId) {
 
     pruneInvalidEntries(contactTouches);
     pruneInvalidEntries(sensorTouches);
+    for (auto it = shapeChangeStamps.begin(); it != shapeChangeStamps.end(); ) {
+        if (!b2Shape_IsValid(b2LoadShapeId(it->first))) {
+            it = shapeChangeStamps.erase(it);
+        } else {
+            ++it;
+        }
+    }
 
     const b2ContactEvents contactEvents = b2World_GetContactEvents(worldId);
     for (int i = 0; i < contactEvents.beginCount; ++i) {
@@ -70,8 +77,11 @@ std::vector<Object*> SensorEventManager::getContactingObjects(b2ShapeId shapeId)
         return results;
     }
     results.reserve(it->second.size());
-    for (const auto& [object, count] : it->second) {
-        if (object && count > 0 && Object::isAlive(object)) {
+    for (const auto& [handle, count] : it->second) {
+        if (count <= 0) {
+            continue;
+        }
+        if (Object* object = Object::resolve(handle)) {
             results.push_back(object);
         }
     }
@@ -89,8 +99,11 @@ std::vector<Object*> SensorEventManager::getSensorOverlappingObjects(b2ShapeId s
         return results;
     }
     results.reserve(it->second.size());
-    for (const auto& [object, count] : it->second) {
-        if (object && count > 0 && Object::isAlive(object)) {
+    for (const auto& [handle, count] : it->second) {
+        if (count <= 0) {
+            continue;
+        }
+        if (Object* object = Object::resolve(handle)) {
             results.push_back(object);
         }
     }
@@ -106,8 +119,8 @@ bool SensorEventManager::hasContactWith(b2ShapeId shapeId, const Object* other)
     if (it == contactTouches.end()) {
         return false;
     }
-    auto target = it->second.find(const_cast<Object*>(other));
-    return target != it->second.end() && target->second > 0 && Object::isAlive(other);
+    auto target = it->second.find(other->getHandle());
+    return target != it->second.end() && target->second > 0;
 }
 
 bool SensorEventManager::hasSensorOverlapWith(b2ShapeId shapeId, const Object* other) const {
@@ -119,13 +132,45 @@ bool SensorEventManager::hasSensorOverlapWith(b2ShapeId shapeId, const Object* o
     if (it == sensorTouches.end()) {
         return false;
     }
-    auto target = it->second.find(const_cast<Object*>(other));
-    return target != it->second.end() && target->second > 0 && Object::isAlive(other);
+    auto target = it->second.find(other->getHandle());
+    return target != it->second.end() && target->second > 0;
+}
+
+void SensorEventManager::forgetBody(b2BodyId bodyId) {
+    if (B2_IS_NULL(bodyId) || !b2Body_IsValid(bodyId)) {
+        return;
+    }
+    int shapeCount = b2Body_GetShapeCount(bodyId);
+    if (shapeCount <= 0) {
+        return;
+    }
+    std::vector<b2ShapeId> shapes(static_cast<size_t>(shapeCount));
+    shapeCount = b2Body_GetShapes(bodyId, shapes.data(), shapeCount);
+    for (int i = 0; i < shapeCount; ++i) {
+        const uint64_t key = storeShapeId(shapes[i]);
+        if (contactTouches.erase(key) + sensorTouches.erase(key) > 0) {
+            markShapeChanged(key);
+        }
+    }
 }
 
 void SensorEventManager::clear() {
     contactTouches.clear();
     sensorTouches.clear();
+    shapeChangeStamps.clear();
+    clearStamp = ++changeCounter;
+}
+
+uint64_t SensorEventManager::getShapeChangeStamp(b2ShapeId shapeId) const {
+    if (B2_IS_NULL(shapeId)) {
+        return clearStamp;
+    }
+    auto it = shapeChangeStamps.find(storeShapeId(shapeId));
+    return it != shapeChangeStamps.end() ? it->second : clearStamp;
+}
+
+void SensorEventManager::markShapeChanged(uint64_t key) {
+    shapeChangeStamps[key] = ++changeCounter;
 }
 
 uint64_t SensorEventManager::storeShapeId(b2ShapeId shapeId) {
@@ -136,27 +181,19 @@ Object* SensorEventManager::getObjectFromShape(b2ShapeId shapeId) {
     if (B2_IS_NULL(shapeId)) {
         return nullptr;
     }
-    // Check if shape is still valid before accessing it (prevents crash when object dies)
+    // Check if shape is still valid before accessing it (prevents crash when object dies).
+    // A valid shape implies a live owner: BodyComponent destroys its body with the object
     if (!b2Shape_IsValid(shapeId)) {
         return nullptr;
     }
     if (void* userData = b2Shape_GetUserData(shapeId)) {
-        Object* object = static_cast<Object*>(userData);
-        if (object && Object::isAlive(object)) {
-            return object;
-        }
+        return static_cast<Object*>(userData);
     }
     b2BodyId bodyId = b2Shape_GetBody(shapeId);
     if (B2_IS_NULL(bodyId)) {
         return nullptr;
     }
-    if (void* bodyData = b2Body_GetUserData(bodyId)) {
-        Object* object = static_cast<Object*>(bodyData);
-        if (object && Object::isAlive(object)) {
-            return object;
-        }
-    }
-    return nullptr;
+    return static_cast<Object*>(b2Body_GetUserData(bodyId));
 }
 
 void SensorEventManager::addTouch(ShapeTouchMap& map, b2ShapeId shapeId, Object* other) {
@@ -165,7 +202,8 @@ void SensorEventManager::addTouch(ShapeTouchMap& map, b2ShapeId shapeId, Object*
     }
     const uint64_t key = storeShapeId(shapeId);
     auto& entry = map[key];
-    entry[other] += 1;
+    entry[other->getHandle()] += 1;
+    markShapeChanged(key);
 }
 
 void SensorEventManager::removeTouch(ShapeTouchMap& map, b2ShapeId shapeId, Object* other) {
@@ -180,13 +218,15 @@ void SensorEventManager::removeTouch(ShapeTouchMap& map, b2ShapeId shapeId, Obje
 
     if (other == nullptr) {
         map.erase(it);
+        markShapeChanged(key);
         return;
     }
 
-    auto objectIt = it->second.find(other);
+    auto objectIt = it->second.find(other->getHandle());
     if (objectIt == it->second.end()) {
         return;
     }
+    markShapeChanged(key);
 
     objectIt->second = std::max(0, objectIt->second - 1);
     if (objectIt->second == 0) {
@@ -208,8 +248,9 @@ void SensorEventManager::pruneInvalidEntries(ShapeTouchMap& map) {
             continue;
         }
         for (auto it = touches.begin(); it != touches.end(); ) {
-            if (!it->first || !Object::isAlive(it->first) || it->second <= 0) {
+            if (!Object::isAlive(it->first) || it->second <= 0) {
                 it = touches.erase(it);
+                markShapeChanged(key);
             } else {
                 ++it;
             }
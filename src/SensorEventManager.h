@@ -2,6 +2,8 @@
 
 #include <box2d/box2d.h>
 
+#include "ObjectHandle.h"
+
 #include <cstdint>
 #include <unordered_map>
 #include <vector>
@@ -19,21 +21,33 @@ public:
     bool hasContactWith(b2ShapeId shapeId, const Object* other) const;
     bool hasSensorOverlapWith(b2ShapeId shapeId, const Object* other) const;
 
+    // Forget every touch recorded for the body's shapes (pooled bodies being parked)
+    void forgetBody(b2BodyId bodyId);
+
     void clear();
 
+    // Change stamps for event-driven readers: the counter advances on every touch added or
+    // removed, and each shape remembers the counter value of its last change
+    uint64_t getCurrentStamp() const { return changeCounter; }
+    uint64_t getShapeChangeStamp(b2ShapeId shapeId) const;
+
 private:
-    using TouchMap = std::unordered_map<Object*, int>;
+    using TouchMap = std::unordered_map<ObjectHandle, int>;
     using ShapeTouchMap = std::unordered_map<uint64_t, TouchMap>;
 
     ShapeTouchMap contactTouches;
     ShapeTouchMap sensorTouches;
+    std::unordered_map<uint64_t, uint64_t> shapeChangeStamps;
+    uint64_t changeCounter = 0;
+    uint64_t clearStamp = 0;
 
     static uint64_t storeShapeId(b2ShapeId shapeId);
     static Object* getObjectFromShape(b2ShapeId shapeId);
 
-    static void addTouch(ShapeTouchMap& map, b2ShapeId shapeId, Object* other);
-    static void removeTouch(ShapeTouchMap& map, b2ShapeId shapeId, Object* other);
-    static void pruneInvalidEntries(ShapeTouchMap& map);
+    void addTouch(ShapeTouchMap& map, b2ShapeId shapeId, Object* other);
+    void removeTouch(ShapeTouchMap& map, b2ShapeId shapeId, Object* other);
+    void pruneInvalidEntries(ShapeTouchMap& map);
+    void markShapeChanged(uint64_t key);
 };
 
 
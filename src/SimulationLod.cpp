@@ -0,0 +1,191 @@
+#include "SimulationLod.h"
+#include "Object.h"
+#include "components/BodyComponent.h"
+#include "components/InputComponent.h"
+#include "components/ViewGrabComponent.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+void SimulationLod::configure(const nlohmann::json& json) {
+    settings = Settings{};
+    if (json.is_object()) {
+        settings.activeRadius = json.value("activeRadius", settings.activeRadius);
+        settings.wakeMargin = json.value("wakeMargin", settings.wakeMargin);
+        settings.dormantStride = json.value("dormantStride", settings.dormantStride);
+        settings.evaluateInterval = json.value("evaluateInterval", settings.evaluateInterval);
+    }
+    settings.activeRadius = std::max(settings.activeRadius, 0.0f);
+    settings.wakeMargin = std::max(settings.wakeMargin, 0.0f);
+    settings.dormantStride = std::clamp(settings.dormantStride, 1, 60);
+    settings.evaluateInterval = std::max(settings.evaluateInterval, 0.0f);
+
+    if (isEnabled()) {
+        std::cout << "SimulationLod: bodies beyond " << settings.activeRadius + settings.wakeMargin
+                  << " px of every player go dormant (components every " << settings.dormantStride
+                  << " steps)" << std::endl;
+    }
+    clear();
+}
+
+void SimulationLod::beginStep(const std::vector<std::unique_ptr<Object>>& objects, float deltaTime) {
+    ++stepCounter;
+
+    // Objects woken last step caught up on their skipped time then; back to every step
+    for (ObjectHandle handle : waking) {
+        if (Object* object = Object::resolve(handle)) {
+            object->setSimulationLod(false, true, 0.0f);
+        }
+    }
+    waking.clear();
+
+    // Destroyed and pooled objects drop out (pooling disables and re-enables the body itself)
+    for (size_t i = 0; i < dormant.size();) {
+        Object* object = Object::resolve(dormant[i].handle);
+        if (object && object->isInWorld()) {
+            ++i;
+            continue;
+        }
+        dormantSlots[dormant[i].handle.index] = 0;
+        dormant[i] = dormant.back();
+        dormant.pop_back();
+        if (i < dormant.size()) {
+            dormantSlots[dormant[i].handle.index] = static_cast<uint32_t>(i + 1);
+        }
+    }
+
+    if (!isEnabled()) {
+        if (!dormant.empty()) {
+            clear();
+        }
+        return;
+    }
+
+    evaluateTimer -= deltaTime;
+    if (evaluateTimer <= 0.0f) {
+        evaluateTimer = settings.evaluateInterval;
+        evaluate(objects, deltaTime);
+    }
+
+    // Stagger dormant objects across the stride so they don't all run on the same step
+    const uint32_t stride = static_cast<uint32_t>(settings.dormantStride);
+    for (Dormant& record : dormant) {
+        record.pendingDeltaTime += deltaTime;
+        Object* object = Object::resolve(record.handle);
+        const bool runs = (stepCounter + record.handle.index) % stride == 0;
+        object->setSimulationLod(true, runs, record.pendingDeltaTime);
+        if (runs) {
+            record.pendingDeltaTime = 0.0f;
+        }
+    }
+}
+
+void SimulationLod::evaluate(const std::vector<std::unique_ptr<Object>>& objects, float deltaTime) {
+    focus.clear();
+    for (const auto& object : objects) {
+        if (!object || object->isMarkedForDeath() ||
+            (!object->hasComponent<InputComponent>() && !object->hasComponent<ViewGrabComponent>())) {
+            continue;
+        }
+        if (BodyComponent* body = object->getComponent<BodyComponent>(); body && B2_IS_NON_NULL(body->getBodyId())) {
+            auto [x, y, angle] = body->getPosition();
+            focus.push_back({x, y});
+        }
+    }
+
+    if (focus.empty()) {
+        clear();
+        return;
+    }
+
+    const float wakeRadiusSq = settings.activeRadius * settings.activeRadius;
+    const float sleepRadius = settings.activeRadius + settings.wakeMargin;
+    const float sleepRadiusSq = sleepRadius * sleepRadius;
+    for (const auto& object : objects) {
+        if (!object || object->isMarkedForDeath() || object->getHandle().isNull()) {
+            continue;
+        }
+        BodyComponent* body = object->getComponent<BodyComponent>();
+        if (!body || B2_IS_NULL(body->getBodyId())) {
+            continue;
+        }
+
+        auto [x, y, angle] = body->getPosition();
+        float nearestSq = std::numeric_limits<float>::infinity();
+        for (const b2Vec2& point : focus) {
+            const float dx = point.x - x;
+            const float dy = point.y - y;
+            nearestSq = std::min(nearestSq, dx * dx + dy * dy);
+        }
+
+        const uint32_t slot = object->getHandle().index;
+        const uint32_t position = slot < dormantSlots.size() ? dormantSlots[slot] : 0;
+        if (position != 0) {
+            if (nearestSq < wakeRadiusSq) {
+                // Components run this step with the time they skipped while dormant
+                Dormant& record = dormant[position - 1];
+                object->setSimulationLod(true, true, record.pendingDeltaTime + deltaTime);
+                waking.push_back(record.handle);
+                wake(record);
+            }
+        } else if (nearestSq > sleepRadiusSq && !object->hasComponent<InputComponent>() &&
+                   !object->hasComponent<ViewGrabComponent>()) {
+            freeze(*object, body->getBodyId());
+        }
+    }
+}
+
+void SimulationLod::freeze(Object& object, b2BodyId bodyId) {
+    // Static bodies cost nothing at rest; disabled ones belong to the pool or game code
+    if (b2Body_GetType(bodyId) == b2_staticBody || !b2Body_IsEnabled(bodyId) || b2Body_GetJointCount(bodyId) > 0) {
+        return;
+    }
+
+    Dormant record;
+    record.handle = object.getHandle();
+    record.linearVelocity = b2Body_GetLinearVelocity(bodyId);
+    record.angularVelocity = b2Body_GetAngularVelocity(bodyId);
+    b2Body_Disable(bodyId);
+
+    if (record.handle.index >= dormantSlots.size()) {
+        dormantSlots.resize(record.handle.index + 1, 0);
+    }
+    dormant.push_back(record);
+    dormantSlots[record.handle.index] = static_cast<uint32_t>(dormant.size());
+}
+
+void SimulationLod::wake(Dormant& record) {
+    const size_t position = static_cast<size_t>(&record - dormant.data());
+    if (Object* object = Object::resolve(record.handle)) {
+        BodyComponent* body = object->getComponent<BodyComponent>();
+        if (body && B2_IS_NON_NULL(body->getBodyId()) && !b2Body_IsEnabled(body->getBodyId())) {
+            // Enabling resets the body's velocity
+            b2Body_Enable(body->getBodyId());
+            b2Body_SetLinearVelocity(body->getBodyId(), record.linearVelocity);
+            b2Body_SetAngularVelocity(body->getBodyId(), record.angularVelocity);
+        }
+    }
+
+    dormantSlots[record.handle.index] = 0;
+    if (position + 1 != dormant.size()) {
+        dormant[position] = dormant.back();
+        dormantSlots[dormant[position].handle.index] = static_cast<uint32_t>(position + 1);
+    }
+    dormant.pop_back();
+}
+
+void SimulationLod::clear() {
+    while (!dormant.empty()) {
+        waking.push_back(dormant.back().handle);
+        wake(dormant.back());
+    }
+    for (ObjectHandle handle : waking) {
+        if (Object* object = Object::resolve(handle)) {
+            object->setSimulationLod(false, true, 0.0f);
+        }
+    }
+    waking.clear();
+    dormantSlots.clear();
+    evaluateTimer = 0.0f;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "ObjectHandle.h"
+
+#include <box2d/box2d.h>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Object;
+
+/**
+ * Distance-based simulation level of detail. Objects controlled by a player
+ * (InputComponent) or framed by the camera (ViewGrabComponent) are focus points; every
+ * few steps the rest are measured against them. A dynamic or kinematic body further than
+ * activeRadius + wakeMargin pixels from every focus goes dormant:
+ *
+ *   - its Box2D body is disabled (velocity kept aside and restored on wake), so the
+ *     solver and broad-phase skip it
+ *   - its per-step components run once every dormantStride steps with the time gathered
+ *     since they last ran (Object::getStepDeltaTime); TickScheduler components keep
+ *     their own cadence
+ *
+ * It wakes once a focus comes within activeRadius. Bodies with joints stay awake, since
+ * disabling one would drop the joint for its partner too. With no focus in the world
+ * (menus, attract levels) everything stays awake.
+ *
+ * Configured by the "simulationLod" block in assets/serverData.json:
+ *   { "activeRadius": 3000, "wakeMargin": 256, "dormantStride": 8, "evaluateInterval": 0.25 }
+ * An activeRadius of 0 (the default) turns it off.
+ */
+class SimulationLod {
+public:
+    void configure(const nlohmann::json& settings);
+    bool isEnabled() const { return settings.activeRadius > 0.0f; }
+
+    // Called by Engine before each world step: re-evaluate distances when due, then tell
+    // each dormant object whether its components run this step
+    void beginStep(const std::vector<std::unique_ptr<Object>>& objects, float deltaTime);
+
+    // Wake everything (level change, LOD switched off)
+    void clear();
+
+    size_t getDormantCount() const { return dormant.size(); }
+
+private:
+    struct Settings {
+        float activeRadius = 0.0f;
+        float wakeMargin = 256.0f;
+        int dormantStride = 8;
+        float evaluateInterval = 0.25f;
+    };
+
+    struct Dormant {
+        ObjectHandle handle;
+        b2Vec2 linearVelocity = b2Vec2_zero;
+        float angularVelocity = 0.0f;
+        float pendingDeltaTime = 0.0f;
+    };
+
+    void evaluate(const std::vector<std::unique_ptr<Object>>& objects, float deltaTime);
+    void freeze(Object& object, b2BodyId bodyId);
+    void wake(Dormant& record);
+
+    Settings settings;
+    std::vector<Dormant> dormant;
+    std::vector<uint32_t> dormantSlots;  // ObjectHandle::index -> position in dormant + 1, 0 if awake
+    std::vector<ObjectHandle> waking;  // woken by the last evaluation, catching up this step
+    std::vector<b2Vec2> focus;
+    float evaluateTimer = 0.0f;
+    uint32_t stepCounter = 0;
+};
@@ -0,0 +1,398 @@
+#include "SpatialIndex.h"
+#include "BodyMotionTracker.h"
+#include "Engine.h"
+#include "Object.h"
+#include "components/BodyComponent.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// Same box PathfindingBehaviorComponent inflates for obstacles: the first fixture's size,
+// rotated with the body and centered on its position
+SpatialIndex::Bounds bodyBounds(BodyComponent& body, float x, float y, float angleDegrees) {
+    auto [width, height] = body.getFixtureSize();
+    if (width <= 0.0f) {
+        width = 32.0f;
+    }
+    if (height <= 0.0f) {
+        height = 32.0f;
+    }
+
+    float angleRad = Engine::degreesToRadians(angleDegrees);
+    float cosA = std::abs(std::cos(angleRad));
+    float sinA = std::abs(std::sin(angleRad));
+    float halfWidth = cosA * width * 0.5f + sinA * height * 0.5f;
+    float halfHeight = sinA * width * 0.5f + cosA * height * 0.5f;
+    return {x - halfWidth, y - halfHeight, x + halfWidth, y + halfHeight};
+}
+}
+
+SpatialIndex::SpatialIndex(float cellSize)
+    : cellSize(std::max(1.0f, cellSize)) {
+}
+
+void SpatialIndex::sync(const std::vector<std::unique_ptr<Object>>& objects, const BodyMotionTracker& motion) {
+    ++currentStamp;
+
+    if (!fullSyncPending) {
+        // Bodies that moved, teleported, or entered or left the world since the last step;
+        // everything else is where it was. Marks made by collision and sensor handlers after
+        // the step are picked up now rather than a step late
+        for (ObjectHandle handle : motion.getMoved()) {
+            syncHandle(handle);
+        }
+        for (ObjectHandle handle : motion.getMarked()) {
+            syncHandle(handle);
+        }
+        return;
+    }
+
+    // First sync after a clear: walk every object once
+    fullSyncPending = false;
+    for (const auto& objectPtr : objects) {
+        if (!objectPtr) {
+            continue;
+        }
+        BodyComponent* body = objectPtr->getComponent<BodyComponent>();
+        if (!body || B2_IS_NULL(body->getBodyId())) {
+            continue;
+        }
+        updateEntry(objectPtr->getHandle(), *body);
+    }
+
+    // Entries left over from before the clear
+    for (uint32_t slot = 0; slot < entries.size(); ++slot) {
+        if (entries[slot].live && entries[slot].syncStamp != currentStamp) {
+            removeEntry(slot);
+        }
+    }
+}
+
+void SpatialIndex::syncHandle(ObjectHandle handle) {
+    Object* object = Object::resolve(handle);
+    BodyComponent* body = object && object->isInWorld() ? object->getComponent<BodyComponent>() : nullptr;
+    if (body && B2_IS_NON_NULL(body->getBodyId())) {
+        updateEntry(handle, *body);
+        return;
+    }
+    // Destroyed, parked in the pool or lost its body
+    if (handle.index < entries.size() && entries[handle.index].live && entries[handle.index].handle == handle) {
+        removeEntry(handle.index);
+    }
+}
+
+void SpatialIndex::updateEntry(ObjectHandle handle, BodyComponent& body) {
+    if (handle.index >= entries.size()) {
+        entries.resize(handle.index + 1);
+    }
+    Entry& entry = entries[handle.index];
+    if (entry.live && entry.handle != handle) {
+        removeEntry(handle.index);  // slot reused by a new object since the last sync
+    }
+
+    auto [x, y, angle] = body.getPosition();
+    entry.syncStamp = currentStamp;
+    if (entry.live && entry.x == x && entry.y == y && entry.angle == angle) {
+        return;  // static or resting body, nothing to re-bin
+    }
+
+    entry.handle = handle;
+    entry.x = x;
+    entry.y = y;
+    entry.angle = angle;
+    entry.bounds = bodyBounds(body, x, y, angle);
+
+    if (!hasExtent) {
+        extent = {x, y, x, y};
+        hasExtent = true;
+    } else {
+        extent.minX = std::min(extent.minX, x);
+        extent.minY = std::min(extent.minY, y);
+        extent.maxX = std::max(extent.maxX, x);
+        extent.maxY = std::max(extent.maxY, y);
+    }
+
+    CellRange range = cellRangeFor(entry.bounds);
+    if (entry.live && !entry.large && range.minX == entry.cells.minX && range.minY == entry.cells.minY &&
+        range.maxX == entry.cells.maxX && range.maxY == entry.cells.maxY) {
+        stampCells(entry);  // moved within the same cells
+        return;
+    }
+    if (entry.live) {
+        removeCells(handle.index, entry);
+    } else {
+        entry.live = true;
+        ++liveCount;
+    }
+    entry.cells = range;
+    insertCells(handle.index, entry);
+}
+
+void SpatialIndex::clear() {
+    entries.clear();
+    cells.clear();
+    largeEntries.clear();
+    largeChangedStamp = ++currentStamp;
+    liveCount = 0;
+    hasExtent = false;
+    fullSyncPending = true;
+}
+
+template<typename Visit>
+void SpatialIndex::forEachInRange(const CellRange& range, Visit&& visit) const {
+    for (uint32_t slot : largeEntries) {
+        visit(slot, entries[slot]);
+    }
+
+    // A query much larger than the populated grid walks the cells instead of the range
+    const long long spanX = static_cast<long long>(range.maxX) - range.minX + 1;
+    const long long spanY = static_cast<long long>(range.maxY) - range.minY + 1;
+    const bool walkCells = spanX * spanY > static_cast<long long>(cells.size());
+
+    // An entry covering several cells is reported from the first cell it shares with the
+    // range, so queries need no per-call scratch state and stay safe to run concurrently
+    auto visitCell = [&](int cx, int cy, const std::vector<uint32_t>& slots) {
+        for (uint32_t slot : slots) {
+            const Entry& entry = entries[slot];
+            if (cx == std::max(entry.cells.minX, range.minX) && cy == std::max(entry.cells.minY, range.minY)) {
+                visit(slot, entry);
+            }
+        }
+    };
+
+    if (walkCells) {
+        for (const auto& [key, cell] : cells) {
+            const int cx = static_cast<int>(static_cast<uint32_t>(key >> 32));
+            const int cy = static_cast<int>(static_cast<uint32_t>(key));
+            if (cx >= range.minX && cx <= range.maxX && cy >= range.minY && cy <= range.maxY) {
+                visitCell(cx, cy, cell.slots);
+            }
+        }
+        return;
+    }
+
+    for (int cy = range.minY; cy <= range.maxY; ++cy) {
+        for (int cx = range.minX; cx <= range.maxX; ++cx) {
+            auto cell = cells.find(cellKey(cx, cy));
+            if (cell != cells.end()) {
+                visitCell(cx, cy, cell->second.slots);
+            }
+        }
+    }
+}
+
+void SpatialIndex::queryRadius(float x, float y, float radius, std::vector<Object*>& out) const {
+    if (radius < 0.0f || liveCount == 0) {
+        return;
+    }
+    const float radiusSq = radius * radius;
+    CellRange range = cellRangeFor({x - radius, y - radius, x + radius, y + radius});
+    forEachInRange(range, [&](uint32_t, const Entry& entry) {
+        const float dx = entry.x - x;
+        const float dy = entry.y - y;
+        if (dx * dx + dy * dy <= radiusSq) {
+            if (Object* object = Object::resolve(entry.handle)) {
+                out.push_back(object);
+            }
+        }
+    });
+}
+
+void SpatialIndex::queryAABB(const Bounds& area, std::vector<Object*>& out) const {
+    if (liveCount == 0) {
+        return;
+    }
+    forEachInRange(cellRangeFor(area), [&](uint32_t, const Entry& entry) {
+        if (entry.bounds.overlaps(area)) {
+            if (Object* object = Object::resolve(entry.handle)) {
+                out.push_back(object);
+            }
+        }
+    });
+}
+
+void SpatialIndex::queryPoints(const Bounds& area, std::vector<Object*>& out) const {
+    if (liveCount == 0) {
+        return;
+    }
+    forEachInRange(cellRangeFor(area), [&](uint32_t, const Entry& entry) {
+        if (entry.x >= area.minX && entry.x <= area.maxX && entry.y >= area.minY && entry.y <= area.maxY) {
+            if (Object* object = Object::resolve(entry.handle)) {
+                out.push_back(object);
+            }
+        }
+    });
+}
+
+bool SpatialIndex::changedSince(const Bounds& area, uint32_t stamp) const {
+    if (largeChangedStamp > stamp) {
+        return true;
+    }
+    const CellRange range = cellRangeFor(area);
+    const long long spanX = static_cast<long long>(range.maxX) - range.minX + 1;
+    const long long spanY = static_cast<long long>(range.maxY) - range.minY + 1;
+    if (spanX * spanY > static_cast<long long>(cells.size())) {
+        for (const auto& [key, cell] : cells) {
+            const int cx = static_cast<int>(static_cast<uint32_t>(key >> 32));
+            const int cy = static_cast<int>(static_cast<uint32_t>(key));
+            if (cell.changedStamp > stamp && cx >= range.minX && cx <= range.maxX && cy >= range.minY &&
+                cy <= range.maxY) {
+                return true;
+            }
+        }
+        return false;
+    }
+    for (int cy = range.minY; cy <= range.maxY; ++cy) {
+        for (int cx = range.minX; cx <= range.maxX; ++cx) {
+            auto cell = cells.find(cellKey(cx, cy));
+            if (cell != cells.end() && cell->second.changedStamp > stamp) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool SpatialIndex::getPosition(ObjectHandle handle, float& x, float& y) const {
+    if (handle.index >= entries.size()) {
+        return false;
+    }
+    const Entry& entry = entries[handle.index];
+    if (!entry.live || entry.handle != handle) {
+        return false;
+    }
+    x = entry.x;
+    y = entry.y;
+    return true;
+}
+
+bool SpatialIndex::getBounds(ObjectHandle handle, Bounds& bounds) const {
+    if (handle.index >= entries.size()) {
+        return false;
+    }
+    const Entry& entry = entries[handle.index];
+    if (!entry.live || entry.handle != handle) {
+        return false;
+    }
+    bounds = entry.bounds;
+    return true;
+}
+
+std::vector<Object*> SpatialIndex::nearestK(float x, float y, size_t k, float maxRadius) const {
+    if (k == 0 || liveCount == 0 || !hasExtent) {
+        return {};
+    }
+
+    // Widest radius that can still find anything: the far corner of the inserted extent
+    const float farX = std::max(std::abs(extent.minX - x), std::abs(extent.maxX - x));
+    const float farY = std::max(std::abs(extent.minY - y), std::abs(extent.maxY - y));
+    const float limit = std::min(maxRadius, std::sqrt(farX * farX + farY * farY));
+
+    // Grow the search radius until it holds k objects; the k nearest are then among them
+    std::vector<Object*> found;
+    float radius = std::min(cellSize, limit);
+    while (true) {
+        found.clear();
+        queryRadius(x, y, radius, found);
+        if (found.size() >= k || radius >= limit) {
+            break;
+        }
+        radius = std::min(radius * 2.0f, limit);
+    }
+
+    auto distanceSq = [this, x, y](Object* object) {
+        const Entry& entry = entries[object->getHandle().index];
+        const float dx = entry.x - x;
+        const float dy = entry.y - y;
+        return dx * dx + dy * dy;
+    };
+    std::sort(found.begin(), found.end(),
+              [&](Object* a, Object* b) { return distanceSq(a) < distanceSq(b); });
+    if (found.size() > k) {
+        found.resize(k);
+    }
+    return found;
+}
+
+SpatialIndex::CellRange SpatialIndex::cellRangeFor(const Bounds& bounds) const {
+    // Clamped so unbounded queries still convert to valid cell coordinates
+    auto toCell = [this](float value) {
+        return static_cast<int>(std::clamp(std::floor(value / cellSize), -1.0e9f, 1.0e9f));
+    };
+    CellRange range;
+    range.minX = toCell(bounds.minX);
+    range.minY = toCell(bounds.minY);
+    range.maxX = toCell(bounds.maxX);
+    range.maxY = toCell(bounds.maxY);
+    return range;
+}
+
+uint64_t SpatialIndex::cellKey(int x, int y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+void SpatialIndex::insertCells(uint32_t slot, Entry& entry) {
+    const long long spanX = static_cast<long long>(entry.cells.maxX) - entry.cells.minX + 1;
+    const long long spanY = static_cast<long long>(entry.cells.maxY) - entry.cells.minY + 1;
+    entry.large = spanX * spanY > kMaxCellsPerEntry;
+    if (entry.large) {
+        largeEntries.push_back(slot);
+        largeChangedStamp = currentStamp;
+        return;
+    }
+    for (int cy = entry.cells.minY; cy <= entry.cells.maxY; ++cy) {
+        for (int cx = entry.cells.minX; cx <= entry.cells.maxX; ++cx) {
+            Cell& cell = cells[cellKey(cx, cy)];
+            cell.slots.push_back(slot);
+            cell.changedStamp = currentStamp;
+        }
+    }
+}
+
+void SpatialIndex::removeCells(uint32_t slot, Entry& entry) {
+    auto eraseSlot = [slot](std::vector<uint32_t>& list) {
+        auto it = std::find(list.begin(), list.end(), slot);
+        if (it != list.end()) {
+            *it = list.back();
+            list.pop_back();
+        }
+    };
+
+    if (entry.large) {
+        eraseSlot(largeEntries);
+        largeChangedStamp = currentStamp;
+        return;
+    }
+    for (int cy = entry.cells.minY; cy <= entry.cells.maxY; ++cy) {
+        for (int cx = entry.cells.minX; cx <= entry.cells.maxX; ++cx) {
+            auto cell = cells.find(cellKey(cx, cy));
+            if (cell != cells.end()) {
+                eraseSlot(cell->second.slots);
+                cell->second.changedStamp = currentStamp;
+            }
+        }
+    }
+}
+
+void SpatialIndex::stampCells(const Entry& entry) {
+    if (entry.large) {
+        largeChangedStamp = currentStamp;
+        return;
+    }
+    for (int cy = entry.cells.minY; cy <= entry.cells.maxY; ++cy) {
+        for (int cx = entry.cells.minX; cx <= entry.cells.maxX; ++cx) {
+            auto cell = cells.find(cellKey(cx, cy));
+            if (cell != cells.end()) {
+                cell->second.changedStamp = currentStamp;
+            }
+        }
+    }
+}
+
+void SpatialIndex::removeEntry(uint32_t slot) {
+    Entry& entry = entries[slot];
+    removeCells(slot, entry);
+    entry = Entry{};
+    --liveCount;
+}
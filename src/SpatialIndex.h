@@ -0,0 +1,121 @@
+#pragma once
+
+#include "ObjectHandle.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class BodyComponent;
+class BodyMotionTracker;
+class Object;
+
+/**
+ * Uniform grid over every object with a BodyComponent, updated by Engine once per
+ * simulation step (sync) so proximity queries don't walk the whole object list. After the
+ * first sync only the objects in BodyMotionTracker's moved and marked sets are revisited.
+ * Positions and bounds are in pixels, as returned by BodyComponent::getPosition and
+ * getFixtureSize. Entries are keyed by object slot, and objects whose bounds span too many
+ * cells (ground, walls) go in a separate list that every query checks.
+ *
+ * Queries only read the grid, so components can run them from the parallel update phase.
+ */
+class SpatialIndex {
+public:
+    struct Bounds {
+        float minX = 0.0f;
+        float minY = 0.0f;
+        float maxX = 0.0f;
+        float maxY = 0.0f;
+
+        bool overlaps(const Bounds& other) const {
+            return minX <= other.maxX && maxX >= other.minX && minY <= other.maxY && maxY >= other.minY;
+        }
+    };
+
+    explicit SpatialIndex(float cellSize = kDefaultCellSize);
+
+    // Insert, move and drop entries to match the bodies in objects: all of them after a
+    // clear, otherwise the ones motion reports as moved
+    void sync(const std::vector<std::unique_ptr<Object>>& objects, const BodyMotionTracker& motion);
+    void clear();
+
+    size_t size() const { return liveCount; }
+
+    // Objects whose body position lies within radius of (x, y)
+    void queryRadius(float x, float y, float radius, std::vector<Object*>& out) const;
+
+    // Objects whose body bounds overlap area
+    void queryAABB(const Bounds& area, std::vector<Object*>& out) const;
+
+    // Objects whose body position lies inside area
+    void queryPoints(const Bounds& area, std::vector<Object*>& out) const;
+
+    // Up to k objects closest to (x, y) by body position, nearest first
+    std::vector<Object*> nearestK(float x, float y, size_t k,
+                                  float maxRadius = std::numeric_limits<float>::infinity()) const;
+
+    // Change tracking for event-driven users: sync bumps the stamp, and every cell an entry
+    // enters, leaves or moves within records the stamp of that sync
+    uint32_t getSyncStamp() const { return currentStamp; }
+    bool changedSince(const Bounds& area, uint32_t stamp) const;
+    bool getPosition(ObjectHandle handle, float& x, float& y) const;
+    bool getBounds(ObjectHandle handle, Bounds& bounds) const;
+
+    static constexpr float kDefaultCellSize = 256.0f;
+
+private:
+    struct CellRange {
+        int minX = 0;
+        int minY = 0;
+        int maxX = -1;
+        int maxY = -1;
+    };
+
+    struct Entry {
+        ObjectHandle handle;
+        float x = 0.0f;
+        float y = 0.0f;
+        float angle = 0.0f;
+        Bounds bounds;
+        CellRange cells;
+        bool large = false;
+        bool live = false;
+        uint32_t syncStamp = 0;
+    };
+
+    struct Cell {
+        std::vector<uint32_t> slots;
+        uint32_t changedStamp = 0;  // kept when the cell empties, so departures stay visible
+    };
+
+    // Entries spanning more cells than this are kept out of the grid
+    static constexpr int kMaxCellsPerEntry = 64;
+
+    CellRange cellRangeFor(const Bounds& bounds) const;
+    static uint64_t cellKey(int x, int y);
+    void insertCells(uint32_t slot, Entry& entry);
+    void removeCells(uint32_t slot, Entry& entry);
+    void stampCells(const Entry& entry);
+    void removeEntry(uint32_t slot);
+    void syncHandle(ObjectHandle handle);
+    void updateEntry(ObjectHandle handle, BodyComponent& body);
+
+    // Calls visit(slot, entry) once per entry whose cells intersect range (plus large entries)
+    template<typename Visit>
+    void forEachInRange(const CellRange& range, Visit&& visit) const;
+
+    float cellSize;
+    std::vector<Entry> entries;  // indexed by ObjectHandle::index
+    std::unordered_map<uint64_t, Cell> cells;
+    std::vector<uint32_t> largeEntries;
+    uint32_t largeChangedStamp = 0;
+    size_t liveCount = 0;
+    uint32_t currentStamp = 0;
+    Bounds extent;  // covers every position inserted since the last clear
+    bool hasExtent = false;
+    bool fullSyncPending = true;
+};
@@ -1,4 +1,7 @@
 #include "SpriteManager.h"
+#include "RenderQueue.h"
+#include "TextureAtlas.h"
+#include "TileCache.h"
 #include <SDL_image.h>
 #include <iostream>
 #include <fstream>
@@ -16,10 +19,15 @@ SpriteManager::~SpriteManager() {
 
 void SpriteManager::init(SDL_Renderer* rendererParam, const std::string& spriteDataPath) {
     renderer = rendererParam;
+    headless = (rendererParam == nullptr);
     basePath = "assets/textures/";  // Default base path for textures
     
-    if (!spriteDataPath.empty()) {
-        loadSpriteData(spriteDataPath);
+    if (headless) {
+        std::cout << "SpriteManager: No renderer, running headless (sprite data only)" << std::endl;
+    }
+    
+    if (!spriteDataPath.empty() && loadSpriteData(spriteDataPath) && !headless && atlasEnabled) {
+        buildAtlas();
     }
 }
 
@@ -46,6 +54,13 @@ bool SpriteManager::loadSpriteData(const std::string& filepath) {
         return false;
     }
 
+    if (j.contains("atlas") && j["atlas"].is_object()) {
+        const nlohmann::json& atlas = j["atlas"];
+        atlasEnabled = atlas.value("enabled", atlasEnabled);
+        atlasPageSize = atlas.value("pageSize", atlasPageSize);
+        atlasPadding = atlas.value("padding", atlasPadding);
+    }
+
     // Iterate through textures
     for (auto& [textureName, textureData] : j["textures"].items()) {
         if (!textureData.contains("sprites")) {
@@ -81,11 +96,53 @@ bool SpriteManager::loadSpriteData(const std::string& filepath) {
             sprites[spriteName] = data;
         }
     }
+    ++generation;
 
     std::cout << "SpriteManager: Loaded " << sprites.size() << " sprites from " << filepath << std::endl;
     return true;
 }
 
+void SpriteManager::buildAtlas() {
+    if (!renderer) {
+        return;
+    }
+
+    // Each file once, in a stable order so the cache key doesn't depend on hashing
+    std::vector<std::string> textureNames;
+    for (const auto& [spriteName, data] : sprites) {
+        if (textures.find(data.textureName) == textures.end()) {
+            textureNames.push_back(data.textureName);
+        }
+    }
+    std::sort(textureNames.begin(), textureNames.end());
+    textureNames.erase(std::unique(textureNames.begin(), textureNames.end()), textureNames.end());
+
+    TextureAtlas::Settings settings;
+    settings.pageSize = atlasPageSize;
+    settings.padding = atlasPadding;
+    settings.cacheDir = basePath + ".atlas/";
+    TextureAtlas::Atlas atlas = TextureAtlas::build(renderer, basePath, textureNames, settings);
+    if (atlas.pages.empty()) {
+        return;
+    }
+
+    for (size_t page = 0; page < atlas.pages.size(); ++page) {
+        textures[TextureAtlas::pageName(page)] = atlas.pages[page];
+    }
+    for (auto& [spriteName, data] : sprites) {
+        auto placement = atlas.placements.find(data.textureName);
+        if (placement == atlas.placements.end()) {
+            continue;  // too large for a page, or failed to load; loaded on its own as before
+        }
+        data.textureName = TextureAtlas::pageName(placement->second.page);
+        for (SpriteFrame& frame : data.frames) {
+            frame.x += placement->second.x;
+            frame.y += placement->second.y;
+        }
+    }
+    ++generation;
+}
+
 const SpriteData* SpriteManager::getSpriteData(const std::string& spriteName) const {
     auto it = sprites.find(spriteName);
     if (it != sprites.end()) {
@@ -101,6 +158,11 @@ SDL_Texture* SpriteManager::getTexture(const std::string& textureName) {
         return it->second;
     }
 
+    // Headless: nothing to upload to
+    if (!renderer) {
+        return nullptr;
+    }
+
     // Load the texture
     SDL_Texture* texture = loadTexture(basePath + textureName);
     if (texture) {
@@ -109,177 +171,116 @@ SDL_Texture* SpriteManager::getTexture(const std::string& textureName) {
     return texture;
 }
 
-void SpriteManager::renderSprite(const std::string& spriteName, int frame, float x, float y, 
-                                 float angle, SDL_RendererFlip flip, uint8_t alpha,
-                                 uint8_t colorR, uint8_t colorG, uint8_t colorB) {
+const SpriteData* SpriteManager::resolveSprite(const std::string& spriteName, SDL_Texture*& texture) {
+    texture = nullptr;
     if (!renderer) {
-        std::cerr << "SpriteManager: Renderer not initialized" << std::endl;
-        return;
+        if (!headless) {
+            std::cerr << "SpriteManager: Renderer not initialized" << std::endl;
+        }
+        return nullptr;
     }
 
     const SpriteData* spriteData = getSpriteData(spriteName);
     if (!spriteData) {
         std::cerr << "SpriteManager: Sprite not found: " << spriteName << std::endl;
-        return;
+        return nullptr;
     }
 
-    SDL_Texture* texture = getTexture(spriteData->textureName);
+    texture = getTexture(spriteData->textureName);
     if (!texture) {
         std::cerr << "SpriteManager: Texture not found: " << spriteData->textureName << std::endl;
-        return;
+        return nullptr;
     }
+    return spriteData;
+}
+
+void SpriteManager::queueSprite(const SpriteData& sprite, SDL_Texture* texture, int frame, float x, float y,
+                                float width, float height, float angle, SDL_RendererFlip flip, SDL_Color tint,
+                                int layer) {
+    SpriteFrame frameData = sprite.getFrame(frame);
 
-    SpriteFrame frameData = spriteData->getFrame(frame);
-    
     SDL_Rect srcRect = { frameData.x, frameData.y, frameData.w, frameData.h };
-    float width = static_cast<float>(frameData.w);
-    float height = static_cast<float>(frameData.h);
-    SDL_FRect dstRect = { x - width * 0.5f, y - height * 0.5f, width, height };
+    float clampedWidth = std::max(width, 1.0f);
+    float clampedHeight = std::max(height, 1.0f);
+    SDL_FRect dstRect = { x - clampedWidth * 0.5f, y - clampedHeight * 0.5f, clampedWidth, clampedHeight };
 
-    // Set texture alpha and color mod
-    SDL_SetTextureAlphaMod(texture, alpha);
-    SDL_SetTextureColorMod(texture, colorR, colorG, colorB);
+    RenderQueue::getInstance().submit(texture, srcRect, dstRect, angle, flip, tint, layer);
+}
 
-    // Render with rotation and flip (angle provided in degrees)
-    SDL_RenderCopyExF(renderer, texture, &srcRect, &dstRect, angle, nullptr, flip);
+void SpriteManager::queueSpriteTiled(const SpriteData& sprite, SDL_Texture* texture, int frame, float x, float y,
+                                     float width, float height, float tileWidth, float tileHeight, float angle,
+                                     SDL_RendererFlip flip, SDL_Color tint, int layer) {
+    SpriteFrame frameData = sprite.getFrame(frame);
+    
+    // Use provided tile size, or default to frame size
+    float actualTileWidth = (tileWidth > 0.0f) ? tileWidth : static_cast<float>(frameData.w);
+    float actualTileHeight = (tileHeight > 0.0f) ? tileHeight : static_cast<float>(frameData.h);
+
+    // Covered by a few pre-tiled chunks, turned as one around (x, y)
+    SDL_Rect srcRect = { frameData.x, frameData.y, frameData.w, frameData.h };
+    TileCache::getInstance().queueTiled(renderer, texture, srcRect, x, y, width, height, actualTileWidth,
+                                        actualTileHeight, angle, flip, tint, layer);
 }
 
 void SpriteManager::renderSprite(const std::string& spriteName, int frame, float x, float y, 
-                                 float width, float height, float angle, 
-                                 SDL_RendererFlip flip, uint8_t alpha,
+                                 float angle, SDL_RendererFlip flip, uint8_t alpha,
                                  uint8_t colorR, uint8_t colorG, uint8_t colorB) {
-    if (!renderer) {
-        std::cerr << "SpriteManager: Renderer not initialized" << std::endl;
+    SDL_Texture* texture = nullptr;
+    const SpriteData* spriteData = resolveSprite(spriteName, texture);
+    if (!spriteData) {
         return;
     }
 
-    const SpriteData* spriteData = getSpriteData(spriteName);
-    if (!spriteData) {
-        std::cerr << "SpriteManager: Sprite not found: " << spriteName << std::endl;
+    // Natural size of the frame
+    SpriteFrame frameData = spriteData->getFrame(frame);
+    if (frameData.w <= 0 || frameData.h <= 0) {
         return;
     }
+    queueSprite(*spriteData, texture, frame, x, y, static_cast<float>(frameData.w), static_cast<float>(frameData.h),
+                angle, flip, SDL_Color{colorR, colorG, colorB, alpha});
+}
 
-    SDL_Texture* texture = getTexture(spriteData->textureName);
-    if (!texture) {
-        std::cerr << "SpriteManager: Texture not found: " << spriteData->textureName << std::endl;
+void SpriteManager::renderSprite(const std::string& spriteName, int frame, float x, float y, 
+                                 float width, float height, float angle, 
+                                 SDL_RendererFlip flip, uint8_t alpha,
+                                 uint8_t colorR, uint8_t colorG, uint8_t colorB) {
+    SDL_Texture* texture = nullptr;
+    const SpriteData* spriteData = resolveSprite(spriteName, texture);
+    if (!spriteData) {
         return;
     }
-
-    SpriteFrame frameData = spriteData->getFrame(frame);
-    
-    SDL_Rect srcRect = { frameData.x, frameData.y, frameData.w, frameData.h };
-    float clampedWidth = std::max(width, 1.0f);
-    float clampedHeight = std::max(height, 1.0f);
-    SDL_FRect dstRect = { x - clampedWidth * 0.5f, y - clampedHeight * 0.5f, clampedWidth, clampedHeight };
-
-    // Set texture alpha and color mod
-    SDL_SetTextureAlphaMod(texture, alpha);
-    SDL_SetTextureColorMod(texture, colorR, colorG, colorB);
-
-    // Render with rotation and flip (angle provided in degrees)
-    SDL_RenderCopyExF(renderer, texture, &srcRect, &dstRect, angle, nullptr, flip);
+    queueSprite(*spriteData, texture, frame, x, y, width, height, angle, flip, SDL_Color{colorR, colorG, colorB, alpha});
 }
 
 void SpriteManager::renderSpriteTiled(const std::string& spriteName, int frame, float x, float y,
                                      float width, float height, float tileWidth, float tileHeight,
                                      float angle, SDL_RendererFlip flip, uint8_t alpha,
                                      uint8_t colorR, uint8_t colorG, uint8_t colorB) {
-    if (!renderer) {
-        std::cerr << "SpriteManager: Renderer not initialized" << std::endl;
-        return;
-    }
-
-    const SpriteData* spriteData = getSpriteData(spriteName);
+    SDL_Texture* texture = nullptr;
+    const SpriteData* spriteData = resolveSprite(spriteName, texture);
     if (!spriteData) {
-        std::cerr << "SpriteManager: Sprite not found: " << spriteName << std::endl;
-        return;
-    }
-
-    SDL_Texture* texture = getTexture(spriteData->textureName);
-    if (!texture) {
-        std::cerr << "SpriteManager: Texture not found: " << spriteData->textureName << std::endl;
         return;
     }
-
-    SpriteFrame frameData = spriteData->getFrame(frame);
-    
-    // Use provided tile size, or default to frame size
-    float actualTileWidth = (tileWidth > 0.0f) ? tileWidth : static_cast<float>(frameData.w);
-    float actualTileHeight = (tileHeight > 0.0f) ? tileHeight : static_cast<float>(frameData.h);
-    
-    // Set texture alpha and color mod
-    SDL_SetTextureAlphaMod(texture, alpha);
-    SDL_SetTextureColorMod(texture, colorR, colorG, colorB);
-    
-    float clampedWidth = std::max(width, 1.0f);
-    float clampedHeight = std::max(height, 1.0f);
-    float clampedTileWidth = std::max(actualTileWidth, 1.0f);
-    float clampedTileHeight = std::max(actualTileHeight, 1.0f);
-
-    int tilesX = static_cast<int>(std::ceil(clampedWidth / clampedTileWidth));
-    int tilesY = static_cast<int>(std::ceil(clampedHeight / clampedTileHeight));
-    tilesX = std::max(tilesX, 1);
-    tilesY = std::max(tilesY, 1);
-    
-    // Calculate top-left corner to center the entire tiled area
-    float startX = x - clampedWidth * 0.5f;
-    float startY = y - clampedHeight * 0.5f;
-    
-    SDL_Rect srcRect = { frameData.x, frameData.y, frameData.w, frameData.h };
-    
-    // Render each tile
-    for (int tileY = 0; tileY < tilesY; ++tileY) {
-        for (int tileX = 0; tileX < tilesX; ++tileX) {
-            float dstX = startX + (static_cast<float>(tileX) * clampedTileWidth);
-            float dstY = startY + (static_cast<float>(tileY) * clampedTileHeight);
-            
-            // Clip the last tile if it goes beyond the desired size
-            float dstW = clampedTileWidth;
-            float dstH = clampedTileHeight;
-            
-            if (dstX + dstW > startX + clampedWidth) {
-                dstW = (startX + clampedWidth) - dstX;
-            }
-            if (dstY + dstH > startY + clampedHeight) {
-                dstH = (startY + clampedHeight) - dstY;
-            }
-            
-            SDL_FRect dstRect = { dstX, dstY, dstW, dstH };
-            SDL_Rect tileSrcRect = srcRect;
-
-            if (dstW < clampedTileWidth) {
-                float widthRatio = dstW / clampedTileWidth;
-                int adjustedWidth = static_cast<int>(std::round(static_cast<float>(frameData.w) * widthRatio));
-                tileSrcRect.w = std::clamp(adjustedWidth, 1, frameData.w);
-            }
-
-            if (dstH < clampedTileHeight) {
-                float heightRatio = dstH / clampedTileHeight;
-                int adjustedHeight = static_cast<int>(std::round(static_cast<float>(frameData.h) * heightRatio));
-                tileSrcRect.h = std::clamp(adjustedHeight, 1, frameData.h);
-            }
-            
-            // For rotation, we'd need to rotate the entire tiled area as one
-            // For now, tiled sprites don't support rotation (can be added if needed)
-            if (angle != 0.0f) {
-                std::cerr << "Warning: Tiled sprites don't currently support rotation" << std::endl;
-            }
-            
-            SDL_RenderCopyExF(renderer, texture, &tileSrcRect, &dstRect, 0, nullptr, flip);
-        }
-    }
+    queueSpriteTiled(*spriteData, texture, frame, x, y, width, height, tileWidth, tileHeight, angle, flip,
+                     SDL_Color{colorR, colorG, colorB, alpha});
 }
 
 void SpriteManager::unloadTexture(const std::string& textureName) {
     auto it = textures.find(textureName);
     if (it != textures.end()) {
+        TileCache::getInstance().invalidate(it->second);
         SDL_DestroyTexture(it->second);
         textures.erase(it);
+        ++generation;
         std::cout << "SpriteManager: Unloaded texture: " << textureName << std::endl;
     }
 }
 
 void SpriteManager::unloadAll() {
+    // Queued quads and baked tile chunks may point at the textures about to go
+    RenderQueue::getInstance().clear();
+    TileCache::getInstance().clear();
+
     // Unload all textures
     for (auto& [name, texture] : textures) {
         SDL_DestroyTexture(texture);
@@ -288,6 +289,7 @@ void SpriteManager::unloadAll() {
     
     // Clear sprite data
     sprites.clear();
+    ++generation;
     
     std::cout << "SpriteManager: All sprites and textures unloaded" << std::endl;
 }
@@ -38,18 +38,43 @@ public:
     // Get singleton instance
     static SpriteManager& getInstance();
     
-    // Initialize with renderer and load sprite data
+    // Initialize with renderer and load sprite data (a null renderer runs headless: data only, draws are no-ops)
     void init(SDL_Renderer* renderer, const std::string& spriteDataPath = "assets/spriteData.json");
     
+    bool isHeadless() const { return headless; }
+    
     // Load sprite data from JSON file
     bool loadSpriteData(const std::string& filepath);
     
+    // Pack every texture the loaded sprites use into atlas pages (TextureAtlas) and point the
+    // sprites at them; init does this unless the sprite data's "atlas" block disables it
+    void buildAtlas();
+    
     // Get sprite data by name
     const SpriteData* getSpriteData(const std::string& spriteName) const;
     
     // Get texture by name
     SDL_Texture* getTexture(const std::string& textureName);
     
+    // Sprite data and its texture in one lookup, for callers that cache them between draws.
+    // Both stay valid while getGeneration() is unchanged (it moves on every load and unload)
+    const SpriteData* resolveSprite(const std::string& spriteName, SDL_Texture*& texture);
+    uint32_t getGeneration() const { return generation; }
+    
+    // Queue a resolved sprite frame on RenderQueue, centered on position (angle in degrees)
+    void queueSprite(const SpriteData& sprite, SDL_Texture* texture, int frame, float x, float y,
+                     float width, float height, float angle, SDL_RendererFlip flip, SDL_Color tint,
+                     int layer = 0);
+    
+    // Queue a resolved sprite frame repeated over width x height instead of stretched, through
+    // TileCache chunks turned as one around the centre
+    void queueSpriteTiled(const SpriteData& sprite, SDL_Texture* texture, int frame, float x, float y,
+                          float width, float height, float tileWidth, float tileHeight, float angle,
+                          SDL_RendererFlip flip, SDL_Color tint, int layer = 0);
+    
+    // The render functions below queue on RenderQueue too; Engine::render draws the queue
+    // after the object pass
+    
     // Render a sprite frame (angle in degrees, centered on position)
     void renderSprite(const std::string& spriteName, int frame, float x, float y, 
                      float angle = 0.0f, SDL_RendererFlip flip = SDL_FLIP_NONE, 
@@ -85,9 +110,16 @@ private:
     SpriteManager& operator=(const SpriteManager&) = delete;
     
     SDL_Renderer* renderer = nullptr;
+    bool headless = false;
     std::unordered_map<std::string, SpriteData> sprites;
     std::unordered_map<std::string, SDL_Texture*> textures;
     std::string basePath;  // Base path for texture files
+    uint32_t generation = 1;  // bumped whenever sprites or textures are loaded or unloaded
+    
+    // From the sprite data's optional "atlas" block: { "enabled": true, "pageSize": 2048, "padding": 2 }
+    bool atlasEnabled = true;
+    int atlasPageSize = 2048;
+    int atlasPadding = 2;
     
     // Helper to load a texture from file
     SDL_Texture* loadTexture(const std::string& filepath);
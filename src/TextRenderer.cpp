@@ -0,0 +1,298 @@
+#include "TextRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+constexpr int kPageSize = 512;
+constexpr int kGlyphPadding = 1;
+constexpr size_t kMaxLabels = 256;
+
+// Next codepoint of UTF-8 text at i; malformed bytes come out as U+FFFD
+uint32_t nextCodepoint(const std::string& text, size_t& i) {
+    const unsigned char lead = static_cast<unsigned char>(text[i++]);
+    if (lead < 0x80) {
+        return lead;
+    }
+    int extra = lead >= 0xF0 ? 3 : (lead >= 0xE0 ? 2 : (lead >= 0xC0 ? 1 : 0));
+    if (extra == 0) {
+        return 0xFFFD;
+    }
+    uint32_t codepoint = lead & (0x3F >> extra);
+    while (extra-- > 0 && i < text.size() && (static_cast<unsigned char>(text[i]) & 0xC0) == 0x80) {
+        codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[i++]) & 0x3F);
+    }
+    return codepoint;
+}
+}
+
+TextRenderer& TextRenderer::getInstance() {
+    static TextRenderer instance;
+    return instance;
+}
+
+void TextRenderer::init(SDL_Renderer* rendererParam) {
+    renderer = rendererParam;
+}
+
+void TextRenderer::shutdown() {
+    for (Label& label : labels) {
+        SDL_DestroyTexture(label.texture);
+    }
+    labels.clear();
+    labelIndex.clear();
+
+    for (auto& [font, atlas] : atlases) {
+        for (SDL_Texture* page : atlas->pages) {
+            SDL_DestroyTexture(page);
+        }
+    }
+    atlases.clear();
+
+    for (auto& [key, font] : fonts) {
+        if (font) {
+            TTF_CloseFont(font);
+        }
+    }
+    fonts.clear();
+    renderer = nullptr;
+}
+
+TTF_Font* TextRenderer::getFont(const std::string& path, int pointSize) {
+    if (!TTF_WasInit()) {
+        return nullptr;
+    }
+    const std::string key = path + "@" + std::to_string(pointSize);
+    auto it = fonts.find(key);
+    if (it != fonts.end()) {
+        return it->second;
+    }
+
+    TTF_Font* font = TTF_OpenFont(path.c_str(), pointSize);
+    if (!font) {
+        std::cerr << "TextRenderer: Failed to load font '" << path << "' at " << pointSize << "pt: " << TTF_GetError()
+                  << std::endl;
+    }
+    fonts.emplace(key, font);
+    return font;
+}
+
+TextRenderer::GlyphAtlas& TextRenderer::atlasFor(TTF_Font* font) {
+    auto& atlas = atlases[font];
+    if (!atlas) {
+        atlas = std::make_unique<GlyphAtlas>();
+    }
+    return *atlas;
+}
+
+bool TextRenderer::addPage(GlyphAtlas& atlas) {
+    SDL_Texture* page = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, kPageSize, kPageSize);
+    if (!page) {
+        std::cerr << "TextRenderer: Failed to create glyph page: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    // Clear it, so the padding between glyphs stays transparent
+    const std::vector<uint32_t> blank(static_cast<size_t>(kPageSize) * kPageSize, 0);
+    SDL_UpdateTexture(page, nullptr, blank.data(), kPageSize * static_cast<int>(sizeof(uint32_t)));
+    SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+
+    atlas.pages.push_back(page);
+    atlas.cursorX = 0;
+    atlas.cursorY = 0;
+    atlas.rowHeight = 0;
+    return true;
+}
+
+const TextRenderer::Glyph& TextRenderer::glyphFor(TTF_Font* font, GlyphAtlas& atlas, uint32_t codepoint) {
+    auto it = atlas.glyphs.find(codepoint);
+    if (it != atlas.glyphs.end()) {
+        return it->second;
+    }
+
+    Glyph glyph;
+    const uint32_t drawn = TTF_GlyphIsProvided32(font, codepoint) ? codepoint : static_cast<uint32_t>('?');
+    int minX = 0, maxX = 0, minY = 0, maxY = 0, advance = 0;
+    if (TTF_GlyphMetrics32(font, drawn, &minX, &maxX, &minY, &maxY, &advance) == 0) {
+        glyph.advance = advance;
+    }
+
+    // Whitespace only advances the pen
+    SDL_Surface* surface = nullptr;
+    if (renderer && maxX > minX) {
+        surface = TTF_RenderGlyph32_Blended(font, drawn, SDL_Color{255, 255, 255, 255});
+    }
+    if (surface && surface->format->format != SDL_PIXELFORMAT_ARGB8888) {
+        SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+        SDL_FreeSurface(surface);
+        surface = converted;
+    }
+    if (surface && surface->w <= kPageSize && surface->h <= kPageSize) {
+        // Shelf packing: next row when the glyph doesn't fit, next page when the rows run out
+        bool fits = !atlas.pages.empty();
+        if (fits && atlas.cursorX + surface->w > kPageSize) {
+            atlas.cursorX = 0;
+            atlas.cursorY += atlas.rowHeight + kGlyphPadding;
+            atlas.rowHeight = 0;
+        }
+        if (fits && atlas.cursorY + surface->h > kPageSize) {
+            fits = false;
+        }
+        if (fits || addPage(atlas)) {
+            glyph.page = static_cast<int>(atlas.pages.size()) - 1;
+            glyph.rect = {atlas.cursorX, atlas.cursorY, surface->w, surface->h};
+            glyph.offsetX = std::min(minX, 0);
+            SDL_UpdateTexture(atlas.pages.back(), &glyph.rect, surface->pixels, surface->pitch);
+            atlas.cursorX += surface->w + kGlyphPadding;
+            atlas.rowHeight = std::max(atlas.rowHeight, surface->h);
+        }
+    }
+    SDL_FreeSurface(surface);
+
+    return atlas.glyphs.emplace(codepoint, glyph).first->second;
+}
+
+SDL_Point TextRenderer::measureText(TTF_Font* font, const std::string& text) {
+    if (!font) {
+        return {0, 0};
+    }
+    GlyphAtlas& atlas = atlasFor(font);
+    int width = 0;
+    uint32_t previous = 0;
+    for (size_t i = 0; i < text.size();) {
+        const uint32_t codepoint = nextCodepoint(text, i);
+        if (previous) {
+            width += TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+        }
+        width += glyphFor(font, atlas, codepoint).advance;
+        previous = codepoint;
+    }
+    return {width, TTF_FontHeight(font)};
+}
+
+SDL_Point TextRenderer::drawText(TTF_Font* font, const std::string& text, float x, float y, SDL_Color color) {
+    if (!renderer || !font || text.empty()) {
+        return measureText(font, text);
+    }
+    GlyphAtlas& atlas = atlasFor(font);
+
+    // Lay the glyphs out, then draw them page by page
+    struct Placed {
+        const Glyph* glyph;
+        float x;
+    };
+    std::vector<Placed> placed;
+    placed.reserve(text.size());
+    const float left = std::round(x);
+    const float top = std::round(y);
+    int penX = 0;
+    uint32_t previous = 0;
+    int lastPage = -1;
+    bool severalPages = false;
+    for (size_t i = 0; i < text.size();) {
+        const uint32_t codepoint = nextCodepoint(text, i);
+        if (previous) {
+            penX += TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+        }
+        const Glyph& glyph = glyphFor(font, atlas, codepoint);
+        if (glyph.page >= 0) {
+            placed.push_back({&glyph, left + static_cast<float>(penX + glyph.offsetX)});
+            severalPages = severalPages || (lastPage >= 0 && glyph.page != lastPage);
+            lastPage = glyph.page;
+        }
+        penX += glyph.advance;
+        previous = codepoint;
+    }
+
+    const float pageSize = static_cast<float>(kPageSize);
+    for (int page = severalPages ? 0 : lastPage; page >= 0 && page < static_cast<int>(atlas.pages.size()); ++page) {
+        vertices.clear();
+        indices.clear();
+        for (const Placed& entry : placed) {
+            if (entry.glyph->page != page) {
+                continue;
+            }
+            const SDL_Rect& rect = entry.glyph->rect;
+            const float u0 = static_cast<float>(rect.x) / pageSize;
+            const float v0 = static_cast<float>(rect.y) / pageSize;
+            const float u1 = static_cast<float>(rect.x + rect.w) / pageSize;
+            const float v1 = static_cast<float>(rect.y + rect.h) / pageSize;
+            const float right = entry.x + static_cast<float>(rect.w);
+            const float bottom = top + static_cast<float>(rect.h);
+            const int base = static_cast<int>(vertices.size());
+            vertices.push_back({{entry.x, top}, color, {u0, v0}});
+            vertices.push_back({{right, top}, color, {u1, v0}});
+            vertices.push_back({{right, bottom}, color, {u1, v1}});
+            vertices.push_back({{entry.x, bottom}, color, {u0, v1}});
+            indices.insert(indices.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+        }
+        if (!vertices.empty()) {
+            SDL_RenderGeometry(renderer, atlas.pages[page], vertices.data(), static_cast<int>(vertices.size()),
+                               indices.data(), static_cast<int>(indices.size()));
+        }
+        if (!severalPages) {
+            break;
+        }
+    }
+    return {penX, TTF_FontHeight(font)};
+}
+
+const TextRenderer::Label* TextRenderer::labelFor(TTF_Font* font, const std::string& text) {
+    if (!font || text.empty()) {
+        return nullptr;
+    }
+    std::string key = std::to_string(reinterpret_cast<uintptr_t>(font)) + "\n" + text;
+    auto it = labelIndex.find(key);
+    if (it != labelIndex.end()) {
+        labels.splice(labels.begin(), labels, it->second);
+        return &labels.front();
+    }
+    if (!renderer) {
+        return nullptr;
+    }
+
+    // Rendered white; drawLabel tints it
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text.c_str(), SDL_Color{255, 255, 255, 255});
+    if (!surface) {
+        std::cerr << "TextRenderer: Failed to render '" << text << "': " << TTF_GetError() << std::endl;
+        return nullptr;
+    }
+    Label label;
+    label.texture = SDL_CreateTextureFromSurface(renderer, surface);
+    label.width = surface->w;
+    label.height = surface->h;
+    SDL_FreeSurface(surface);
+    if (!label.texture) {
+        std::cerr << "TextRenderer: Failed to create texture for '" << text << "': " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(label.texture, SDL_BLENDMODE_BLEND);
+    label.key = std::move(key);
+
+    labels.push_front(std::move(label));
+    labelIndex[labels.front().key] = labels.begin();
+    while (labels.size() > kMaxLabels) {
+        SDL_DestroyTexture(labels.back().texture);
+        labelIndex.erase(labels.back().key);
+        labels.pop_back();
+    }
+    return &labels.front();
+}
+
+SDL_Point TextRenderer::measureLabel(TTF_Font* font, const std::string& text) {
+    const Label* label = labelFor(font, text);
+    return label ? SDL_Point{label->width, label->height} : SDL_Point{0, 0};
+}
+
+SDL_Point TextRenderer::drawLabel(TTF_Font* font, const std::string& text, float x, float y, SDL_Color color) {
+    const Label* label = labelFor(font, text);
+    if (!label) {
+        return {0, 0};
+    }
+    SDL_SetTextureColorMod(label->texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(label->texture, color.a);
+    const SDL_Rect destination = {static_cast<int>(std::round(x)), static_cast<int>(std::round(y)), label->width,
+                                  label->height};
+    SDL_RenderCopy(renderer, label->texture, nullptr, &destination);
+    return {label->width, label->height};
+}
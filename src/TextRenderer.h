@@ -0,0 +1,93 @@
+#pragma once
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Shared text drawing for the HUD, menus and debug labels.
+ *
+ * Fonts are opened once per path and size and owned here, so callers never close them.
+ * Text comes in two flavours:
+ *
+ *   - drawText: strings that change (health, counters, values). Glyphs are rasterized
+ *     once into atlas pages per font and the string is drawn as quads, one
+ *     SDL_RenderGeometry call per page touched.
+ *   - drawLabel: strings that repeat frame to frame (names, titles, menu items). The
+ *     whole string is rendered once, like TTF_RenderUTF8_Blended, and kept in an LRU
+ *     cache; colours are applied when drawing, so one entry serves every colour.
+ */
+class TextRenderer {
+public:
+    static TextRenderer& getInstance();
+
+    // renderer may be nullptr (headless): fonts still open, nothing draws
+    void init(SDL_Renderer* renderer);
+    // Closes the fonts and frees every texture; call before the renderer and TTF go away
+    void shutdown();
+
+    // nullptr if SDL_ttf isn't initialized or the font can't be opened (reported once)
+    TTF_Font* getFont(const std::string& path, int pointSize);
+
+    // Size drawText gives text
+    SDL_Point measureText(TTF_Font* font, const std::string& text);
+    // Size drawLabel gives text (renders and caches it)
+    SDL_Point measureLabel(TTF_Font* font, const std::string& text);
+
+    // Draw with the top-left corner at (x, y); both return the size drawn
+    SDL_Point drawText(TTF_Font* font, const std::string& text, float x, float y, SDL_Color color);
+    SDL_Point drawLabel(TTF_Font* font, const std::string& text, float x, float y, SDL_Color color);
+
+    size_t getCachedLabelCount() const { return labels.size(); }
+
+private:
+    struct Glyph {
+        int page = -1;    // -1: nothing to draw (space, missing)
+        SDL_Rect rect{};  // on the page
+        int offsetX = 0;  // from the pen position to rect's left edge
+        int advance = 0;
+    };
+
+    struct GlyphAtlas {
+        std::vector<SDL_Texture*> pages;
+        std::unordered_map<uint32_t, Glyph> glyphs;
+        int cursorX = 0;
+        int cursorY = 0;
+        int rowHeight = 0;
+    };
+
+    struct Label {
+        std::string key;
+        SDL_Texture* texture = nullptr;
+        int width = 0;
+        int height = 0;
+    };
+
+    TextRenderer() = default;
+    ~TextRenderer() = default;
+    TextRenderer(const TextRenderer&) = delete;
+    TextRenderer& operator=(const TextRenderer&) = delete;
+
+    GlyphAtlas& atlasFor(TTF_Font* font);
+    const Glyph& glyphFor(TTF_Font* font, GlyphAtlas& atlas, uint32_t codepoint);
+    bool addPage(GlyphAtlas& atlas);
+    const Label* labelFor(TTF_Font* font, const std::string& text);
+
+    SDL_Renderer* renderer = nullptr;
+    std::unordered_map<std::string, TTF_Font*> fonts;  // by "path@size"; nullptr if it failed
+    std::unordered_map<TTF_Font*, std::unique_ptr<GlyphAtlas>> atlases;
+
+    // Most recently used first
+    std::list<Label> labels;
+    std::unordered_map<std::string, std::list<Label>::iterator> labelIndex;
+
+    std::vector<SDL_Vertex> vertices;  // scratch for drawText
+    std::vector<int> indices;
+};
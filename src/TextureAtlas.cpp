@@ -0,0 +1,276 @@
+#include "TextureAtlas.h"
+#include "LevelFormat.h"
+
+#include <SDL_image.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+
+namespace {
+constexpr int kCacheVersion = 1;
+constexpr const char* kManifestName = "atlas.json";
+
+struct Source {
+    std::string name;
+    SDL_Surface* surface = nullptr;
+    TextureAtlas::Placement placement;
+};
+
+SDL_Surface* loadRGBA(const std::string& path) {
+    SDL_Surface* surface = IMG_Load(path.c_str());
+    if (!surface) {
+        std::cerr << "TextureAtlas: Failed to load image: " << path << " - " << IMG_GetError() << std::endl;
+        return nullptr;
+    }
+    if (surface->format->format != SDL_PIXELFORMAT_RGBA32) {
+        SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(surface);
+        surface = converted;
+    }
+    return surface;
+}
+
+SDL_Texture* makeTexture(SDL_Renderer* renderer, SDL_Surface* surface) {
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (texture) {
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    }
+    return texture;
+}
+
+// Sources, their file sizes and times, and the settings that shape the pages
+uint64_t cacheKey(const std::string& textureDir, const std::vector<std::string>& textureNames,
+                  const TextureAtlas::Settings& settings) {
+    std::string key = std::to_string(kCacheVersion) + "|" + std::to_string(settings.pageSize) + "|" +
+                      std::to_string(settings.padding);
+    for (const std::string& name : textureNames) {
+        std::error_code error;
+        const std::filesystem::path path(textureDir + name);
+        const auto size = std::filesystem::file_size(path, error);
+        const auto time = std::filesystem::last_write_time(path, error);
+        key += "|" + name + ":" + std::to_string(error ? 0 : size) + ":" +
+               std::to_string(error ? 0 : time.time_since_epoch().count());
+    }
+    return LevelFormat::hashBytes(reinterpret_cast<const uint8_t*>(key.data()), key.size());
+}
+
+bool loadCache(SDL_Renderer* renderer, const std::string& cacheDir, uint64_t key, TextureAtlas::Atlas& atlas) {
+    std::ifstream file(cacheDir + kManifestName);
+    if (!file.is_open()) {
+        return false;
+    }
+    nlohmann::json manifest;
+    try {
+        file >> manifest;
+    } catch (const nlohmann::json::exception&) {
+        return false;
+    }
+    if (manifest.value("key", std::string()) != std::to_string(key) || !manifest.contains("pages") ||
+        !manifest.contains("placements")) {
+        return false;
+    }
+
+    for (const auto& pageFile : manifest["pages"]) {
+        SDL_Surface* surface = loadRGBA(cacheDir + pageFile.get<std::string>());
+        SDL_Texture* texture = surface ? makeTexture(renderer, surface) : nullptr;
+        SDL_FreeSurface(surface);
+        if (!texture) {
+            for (SDL_Texture* page : atlas.pages) {
+                SDL_DestroyTexture(page);
+            }
+            atlas.pages.clear();
+            return false;
+        }
+        atlas.pages.push_back(texture);
+    }
+    for (auto& [name, entry] : manifest["placements"].items()) {
+        atlas.placements[name] = {entry.value("page", 0), entry.value("x", 0), entry.value("y", 0)};
+    }
+    atlas.fromCache = true;
+    return true;
+}
+
+void saveCache(const std::string& cacheDir, uint64_t key, const std::vector<SDL_Surface*>& pages,
+               const std::vector<Source>& sources) {
+    std::error_code error;
+    std::filesystem::create_directories(cacheDir, error);
+
+    nlohmann::json manifest;
+    manifest["key"] = std::to_string(key);
+    manifest["pages"] = nlohmann::json::array();
+    for (size_t i = 0; i < pages.size(); ++i) {
+        std::string pageFile = "page" + std::to_string(i) + ".png";
+        if (IMG_SavePNG(pages[i], (cacheDir + pageFile).c_str()) != 0) {
+            std::cerr << "TextureAtlas: Could not write " << cacheDir << pageFile << " - " << IMG_GetError() << std::endl;
+            return;
+        }
+        manifest["pages"].push_back(pageFile);
+    }
+    manifest["placements"] = nlohmann::json::object();
+    for (const Source& source : sources) {
+        if (source.surface) {
+            manifest["placements"][source.name] = {
+                {"page", source.placement.page}, {"x", source.placement.x}, {"y", source.placement.y}};
+        }
+    }
+
+    // Manifest last, so a partly written cache is never picked up
+    std::ofstream file(cacheDir + kManifestName);
+    file << manifest.dump(2);
+}
+
+// Copy source onto page at (x, y) and repeat its outermost pixels padding times outwards
+void blitPadded(SDL_Surface* source, SDL_Surface* page, int x, int y, int padding) {
+    SDL_SetSurfaceBlendMode(source, SDL_BLENDMODE_NONE);
+    SDL_Rect target = {x, y, source->w, source->h};
+    SDL_BlitSurface(source, nullptr, page, &target);
+    for (int i = 1; i <= padding; ++i) {
+        SDL_Rect top = {0, 0, source->w, 1};
+        SDL_Rect bottom = {0, source->h - 1, source->w, 1};
+        SDL_Rect left = {0, 0, 1, source->h};
+        SDL_Rect right = {source->w - 1, 0, 1, source->h};
+        SDL_Rect topTarget = {x, y - i, source->w, 1};
+        SDL_Rect bottomTarget = {x, y + source->h - 1 + i, source->w, 1};
+        SDL_Rect leftTarget = {x - i, y, 1, source->h};
+        SDL_Rect rightTarget = {x + source->w - 1 + i, y, 1, source->h};
+        SDL_BlitSurface(source, &top, page, &topTarget);
+        SDL_BlitSurface(source, &bottom, page, &bottomTarget);
+        SDL_BlitSurface(source, &left, page, &leftTarget);
+        SDL_BlitSurface(source, &right, page, &rightTarget);
+    }
+}
+}
+
+namespace TextureAtlas {
+
+std::string pageName(size_t page) {
+    return "#atlas" + std::to_string(page);
+}
+
+Atlas build(SDL_Renderer* renderer, const std::string& textureDir, const std::vector<std::string>& textureNames,
+            const Settings& requested) {
+    Atlas atlas;
+    if (!renderer || textureNames.empty()) {
+        return atlas;
+    }
+
+    Settings settings = requested;
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(renderer, &info) == 0 && info.max_texture_width > 0 && info.max_texture_height > 0) {
+        settings.pageSize = std::min({settings.pageSize, info.max_texture_width, info.max_texture_height});
+    }
+    settings.padding = std::max(settings.padding, 0);
+
+    const uint64_t key = cacheKey(textureDir, textureNames, settings);
+    if (!settings.cacheDir.empty() && loadCache(renderer, settings.cacheDir, key, atlas)) {
+        std::cout << "TextureAtlas: Loaded " << atlas.placements.size() << " textures on " << atlas.pages.size()
+                  << " cached page(s)" << std::endl;
+        return atlas;
+    }
+
+    // Only images that fit on a page with their border take part
+    std::vector<Source> sources;
+    for (const std::string& name : textureNames) {
+        Source source;
+        source.name = name;
+        source.surface = loadRGBA(textureDir + name);
+        if (source.surface && (source.surface->w + 2 * settings.padding > settings.pageSize ||
+                               source.surface->h + 2 * settings.padding > settings.pageSize)) {
+            SDL_FreeSurface(source.surface);
+            source.surface = nullptr;
+        }
+        sources.push_back(source);
+    }
+
+    // Shelf packing, tallest first: each page is filled row by row
+    std::vector<size_t> byHeight(sources.size());
+    std::iota(byHeight.begin(), byHeight.end(), 0);
+    std::stable_sort(byHeight.begin(), byHeight.end(), [&sources](size_t a, size_t b) {
+        const int heightA = sources[a].surface ? sources[a].surface->h : 0;
+        const int heightB = sources[b].surface ? sources[b].surface->h : 0;
+        return heightA > heightB;
+    });
+
+    std::vector<std::pair<int, int>> pageExtents;  // used width and height of each page
+    int shelfX = 0;
+    int shelfY = 0;
+    int shelfHeight = 0;
+    for (size_t index : byHeight) {
+        Source& source = sources[index];
+        if (!source.surface) {
+            continue;
+        }
+        const int width = source.surface->w + 2 * settings.padding;
+        const int height = source.surface->h + 2 * settings.padding;
+        if (pageExtents.empty() || shelfX + width > settings.pageSize) {
+            // Next shelf, or next page when the page is full
+            shelfY += shelfHeight;
+            shelfX = 0;
+            shelfHeight = 0;
+            if (pageExtents.empty() || shelfY + height > settings.pageSize) {
+                pageExtents.emplace_back(0, 0);
+                shelfY = 0;
+            }
+        }
+        source.placement = {static_cast<int>(pageExtents.size()) - 1, shelfX + settings.padding, shelfY + settings.padding};
+        shelfX += width;
+        shelfHeight = std::max(shelfHeight, height);
+        pageExtents.back().first = std::max(pageExtents.back().first, shelfX);
+        pageExtents.back().second = std::max(pageExtents.back().second, shelfY + shelfHeight);
+    }
+
+    std::vector<SDL_Surface*> pages;
+    for (const auto& [width, height] : pageExtents) {
+        pages.push_back(SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32));
+    }
+    bool ok = std::all_of(pages.begin(), pages.end(), [](SDL_Surface* page) { return page != nullptr; });
+    if (ok) {
+        for (const Source& source : sources) {
+            if (source.surface) {
+                blitPadded(source.surface, pages[source.placement.page], source.placement.x, source.placement.y,
+                           settings.padding);
+            }
+        }
+        for (SDL_Surface* page : pages) {
+            SDL_Texture* texture = makeTexture(renderer, page);
+            if (!texture) {
+                std::cerr << "TextureAtlas: Failed to create page texture - " << SDL_GetError() << std::endl;
+                ok = false;
+                break;
+            }
+            atlas.pages.push_back(texture);
+        }
+    }
+
+    if (ok) {
+        for (const Source& source : sources) {
+            if (source.surface) {
+                atlas.placements[source.name] = source.placement;
+            }
+        }
+        if (!settings.cacheDir.empty()) {
+            saveCache(settings.cacheDir, key, pages, sources);
+        }
+        std::cout << "TextureAtlas: Packed " << atlas.placements.size() << " of " << textureNames.size()
+                  << " textures onto " << atlas.pages.size() << " page(s)" << std::endl;
+    } else {
+        for (SDL_Texture* page : atlas.pages) {
+            SDL_DestroyTexture(page);
+        }
+        atlas.pages.clear();
+    }
+
+    for (SDL_Surface* page : pages) {
+        SDL_FreeSurface(page);
+    }
+    for (Source& source : sources) {
+        SDL_FreeSurface(source.surface);
+    }
+    return atlas;
+}
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <SDL.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Packs sprite texture files into a few atlas pages so sprites from different files can
+// share a RenderQueue batch. SpriteManager builds the atlas at startup from the textures
+// named in spriteData.json (background layers are sprites too) and remaps each sprite's
+// frames onto its page.
+//
+// Every packed image keeps a border of its own edge pixels, so filtering never pulls in a
+// neighbour. Images too big for a page stay standalone textures.
+//
+// The result is cached next to the textures (pages as PNG plus atlas.json). The cache is
+// keyed on the file names, the size and modification time of every source file and the
+// page settings, so a warm start loads the pages without decoding any sources.
+namespace TextureAtlas {
+
+struct Settings {
+    int pageSize = 2048;  // clamped to the renderer's maximum texture size
+    int padding = 2;      // extruded border around each image
+    std::string cacheDir;  // empty: don't cache
+};
+
+struct Placement {
+    int page = 0;
+    int x = 0;  // where the image's (0, 0) landed on the page
+    int y = 0;
+};
+
+struct Atlas {
+    std::vector<SDL_Texture*> pages;  // owned by the caller
+    std::unordered_map<std::string, Placement> placements;  // by texture file name
+    bool fromCache = false;
+};
+
+// Texture name SpriteManager registers page i under
+std::string pageName(size_t page);
+
+// Pack (or load from the cache) the named files under textureDir
+Atlas build(SDL_Renderer* renderer, const std::string& textureDir, const std::vector<std::string>& textureNames,
+            const Settings& settings);
+
+}
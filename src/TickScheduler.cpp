@@ -0,0 +1,197 @@
+#include "TickScheduler.h"
+#include "FrameProfiler.h"
+#include "JobSystem.h"
+#include "Object.h"
+#include "components/Component.h"
+
+#include <algorithm>
+#include <cmath>
+
+TickScheduler& TickScheduler::getInstance() {
+    static TickScheduler instance;
+    return instance;
+}
+
+void TickScheduler::add(Object& owner, Component& component) {
+    const Component::TickRate rate = component.getTickRate();
+    if (rate == Component::TickRate::EveryFrame) {
+        return;
+    }
+
+    Entry& entry = entries[&component];
+    entry = Entry{};
+    entry.owner = owner.getHandle();
+    entry.registrationId = ++nextScheduleId;
+    entry.lastRunTime = clockSeconds;
+    if (rate == Component::TickRate::Interval) {
+        entry.interval = true;
+        const double intervalMs = std::round(static_cast<double>(component.getTickInterval()) * 1000.0);
+        entry.intervalTicks = static_cast<uint64_t>(std::max(1.0, intervalMs));
+        schedule(&component, entry, currentTick + entry.intervalTicks);
+    }
+}
+
+void TickScheduler::remove(Component& component) {
+    // Wheel and wake tickets for it go stale and are dropped when they come up
+    entries.erase(&component);
+}
+
+void TickScheduler::clear() {
+    entries.clear();
+    for (auto& level : wheel) {
+        for (auto& slot : level) {
+            slot.clear();
+        }
+    }
+    std::lock_guard<std::mutex> lock(wakeMutex);
+    woken.clear();
+}
+
+void TickScheduler::wake(Component& component) {
+    std::lock_guard<std::mutex> lock(wakeMutex);
+    auto it = entries.find(&component);
+    if (it == entries.end() || it->second.wakePending) {
+        return;
+    }
+    it->second.wakePending = true;
+    woken.push_back({&component, it->second.registrationId});
+}
+
+void TickScheduler::advance(float deltaTime) {
+    clockSeconds += deltaTime;
+    targetTick = static_cast<uint64_t>(clockSeconds * 1000.0);
+
+    std::vector<Ticket> wokenNow;
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wokenNow.swap(woken);
+    }
+    for (const Ticket& ticket : wokenNow) {
+        auto it = entries.find(ticket.component);
+        if (it != entries.end() && it->second.registrationId == ticket.id) {
+            it->second.wakePending = false;
+            collectDue(ticket.component, it->second);
+        }
+    }
+
+    while (currentTick < targetTick) {
+        ++currentTick;
+        if ((currentTick & kSlotMask) == 0) {
+            cascade(1);
+        }
+        slotScratch.swap(wheel[0][currentTick & kSlotMask]);
+        for (const Ticket& ticket : slotScratch) {
+            if (Entry* entry = findScheduled(ticket)) {
+                if (entry->dueTick > currentTick) {
+                    file(ticket, entry->dueTick);  // parked at the far end of the wheel
+                } else {
+                    collectDue(ticket.component, *entry);
+                }
+            }
+        }
+        slotScratch.clear();
+    }
+
+    runDue();
+}
+
+void TickScheduler::schedule(Component* component, Entry& entry, uint64_t dueTick) {
+    entry.dueTick = dueTick;
+    entry.scheduleId = ++nextScheduleId;
+    file({component, entry.scheduleId}, dueTick);
+}
+
+void TickScheduler::file(const Ticket& ticket, uint64_t dueTick) {
+    // Level L holds entries due within 64^(L+1) ticks, slotted by the due tick's L-th digit
+    const uint64_t delta = dueTick > currentTick ? dueTick - currentTick : 0;
+    int level = 0;
+    while (level + 1 < kLevels && delta >= (1ull << (kSlotBits * (level + 1)))) {
+        ++level;
+    }
+    uint64_t tick = dueTick;
+    const uint64_t horizon = 1ull << (kSlotBits * kLevels);
+    if (delta >= horizon) {
+        tick = currentTick + horizon - 1;
+    }
+    wheel[level][(tick >> (kSlotBits * level)) & kSlotMask].push_back(ticket);
+}
+
+TickScheduler::Entry* TickScheduler::findScheduled(const Ticket& ticket) {
+    auto it = entries.find(ticket.component);
+    if (it == entries.end() || it->second.scheduleId != ticket.id) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+void TickScheduler::cascade(int level) {
+    // Runs when every lower digit of currentTick wrapped to zero: the slot for the current
+    // digit at this level now holds entries due before the lower levels wrap again
+    const uint64_t index = (currentTick >> (kSlotBits * level)) & kSlotMask;
+    if (index == 0 && level + 1 < kLevels) {
+        cascade(level + 1);
+    }
+    std::vector<Ticket> tickets;
+    tickets.swap(wheel[level][index]);
+    for (const Ticket& ticket : tickets) {
+        if (Entry* entry = findScheduled(ticket)) {
+            file(ticket, entry->dueTick);
+        }
+    }
+}
+
+void TickScheduler::collectDue(Component* component, Entry& entry) {
+    // A new schedule id retires any ticket still in the wheel, so each component runs at
+    // most once per advance, even when its interval is shorter than the step
+    entry.scheduleId = ++nextScheduleId;
+    due.push_back({component, entry.owner, static_cast<float>(clockSeconds - entry.lastRunTime)});
+    entry.lastRunTime = clockSeconds;
+    if (entry.interval) {
+        schedule(component, entry, std::max(currentTick + entry.intervalTicks, targetTick + 1));
+    }
+}
+
+void TickScheduler::runDue() {
+    if (due.empty()) {
+        return;
+    }
+
+    // Components stay valid while their owner's handle resolves; a pooled or destroyed
+    // owner leaves the world (and this scheduler) before its components go away
+    std::vector<DueUpdate> running;
+    running.swap(due);
+    auto isLive = [](const DueUpdate& update) {
+        Object* owner = Object::resolve(update.owner);
+        return owner && owner->isInWorld() && !owner->isMarkedForDeath();
+    };
+
+    // Same split as Engine's object updates: parallel-safe components on the job workers,
+    // then the rest in order
+    JobSystem& jobs = JobSystem::getInstance();
+    const bool parallel = jobs.isParallel();
+    if (parallel) {
+        jobs.parallelForDeferred(running.size(), 0, [&running, &isLive](size_t index) {
+            const DueUpdate& update = running[index];
+            if (isLive(update) && update.component->isParallelSafe()) {
+                update.component->update(update.deltaTime);
+            }
+        });
+    }
+
+    FrameProfiler& profiler = FrameProfiler::getInstance();
+    for (const DueUpdate& update : running) {
+        if (!isLive(update) || (parallel && update.component->isParallelSafe())) {
+            continue;
+        }
+        if (profiler.isEnabled()) {
+            uint64_t start = FrameProfiler::now();
+            update.component->update(update.deltaTime);
+            profiler.recordComponentUpdate(*update.component, FrameProfiler::now() - start);
+        } else {
+            update.component->update(update.deltaTime);
+        }
+    }
+
+    running.clear();
+    due.swap(running);
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "ObjectHandle.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class Component;
+class Object;
+
+/**
+ * Runs the component updates that don't happen every simulation step. Components declare
+ * their cadence with Component::getTickRate: Interval components are filed in a
+ * hierarchical timer wheel (1 ms resolution, four levels of 64 slots, so about 4.6 hours
+ * ahead before an entry is re-filed) and OnWake components sit idle until wake() is called.
+ * Object skips both kinds in its update loop and component pools skip them too, so a
+ * component that isn't due is never visited.
+ *
+ * Components are added when their object enters the world and removed when it leaves
+ * (Object::setInWorld). update() gets the simulation time since the component last ran.
+ */
+class TickScheduler {
+public:
+    static TickScheduler& getInstance();
+
+    void add(Object& owner, Component& component);
+    void remove(Component& component);
+    void clear();
+
+    // Update component on the next step (ignored for EveryFrame components). Safe to call
+    // from the parallel update phase
+    void wake(Component& component);
+
+    // Advance the clock by deltaTime and update every component that has come due
+    // (Engine::stepSimulation, after the per-object updates)
+    void advance(float deltaTime);
+
+    size_t size() const { return entries.size(); }
+
+private:
+    static constexpr int kLevels = 4;
+    static constexpr int kSlotBits = 6;
+    static constexpr uint64_t kSlotCount = 1ull << kSlotBits;
+    static constexpr uint64_t kSlotMask = kSlotCount - 1;
+
+    struct Entry {
+        ObjectHandle owner;
+        uint64_t registrationId = 0;
+        bool interval = false;
+        uint64_t intervalTicks = 0;
+        uint64_t dueTick = 0;
+        uint64_t scheduleId = 0;  // wheel items carrying an older id are stale
+        double lastRunTime = 0.0;
+        bool wakePending = false;
+    };
+
+    // Wheel slots hold (component, scheduleId) and the wake list (component, registrationId);
+    // both are checked against entries when they come up, so removing or rescheduling a
+    // component never searches them
+    struct Ticket {
+        Component* component = nullptr;
+        uint64_t id = 0;
+    };
+
+    struct DueUpdate {
+        Component* component = nullptr;
+        ObjectHandle owner;
+        float deltaTime = 0.0f;
+    };
+
+    TickScheduler() = default;
+    ~TickScheduler() = default;
+    TickScheduler(const TickScheduler&) = delete;
+    TickScheduler& operator=(const TickScheduler&) = delete;
+
+    void schedule(Component* component, Entry& entry, uint64_t dueTick);
+    void file(const Ticket& ticket, uint64_t dueTick);
+    Entry* findScheduled(const Ticket& ticket);
+    void cascade(int level);
+    void collectDue(Component* component, Entry& entry);
+    void runDue();
+
+    std::unordered_map<Component*, Entry> entries;
+    std::array<std::array<std::vector<Ticket>, kSlotCount>, kLevels> wheel;
+    std::vector<Ticket> slotScratch;
+    std::vector<Ticket> woken;
+    std::mutex wakeMutex;
+    std::vector<DueUpdate> due;
+    uint64_t currentTick = 0;
+    uint64_t targetTick = 0;  // tick advance() is running up to
+    uint64_t nextScheduleId = 0;
+    double clockSeconds = 0.0;
+};
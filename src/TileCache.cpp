@@ -0,0 +1,259 @@
+#include "TileCache.h"
+#include "Engine.h"
+#include "FrameProfiler.h"
+#include "RenderQueue.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+
+namespace {
+// Largest side of a baked block of tiles
+constexpr int kChunkPixels = 512;
+// Chunks unused for this many frames are dropped, checked every kSweepInterval frames
+constexpr uint32_t kMaxIdleFrames = 300;
+constexpr uint32_t kSweepInterval = 60;
+
+// Baked size of a tile shown at screenSize pixels: the next quarter-octave step up, so
+// small zoom changes keep using the chunk, and no larger than the frame itself
+int bakedTileSize(float screenSize, int frameSize) {
+    const float stepped = std::exp2(std::ceil(std::log2(std::max(screenSize, 1.0f)) * 4.0f) / 4.0f);
+    return std::clamp(static_cast<int>(std::ceil(stepped)), 1, std::max(frameSize, 1));
+}
+}
+
+size_t TileCache::KeyHash::operator()(const Key& key) const {
+    size_t hash = std::hash<const void*>()(key.source);
+    for (int value : {key.src.x, key.src.y, key.src.w, key.src.h, static_cast<int>(key.flip), key.tileWidth,
+                      key.tileHeight}) {
+        hash = hash * 31 + std::hash<int>()(value);
+    }
+    return hash;
+}
+
+TileCache& TileCache::getInstance() {
+    static TileCache instance;
+    return instance;
+}
+
+const TileCache::Chunk& TileCache::chunkFor(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect& src,
+                                            SDL_RendererFlip flip, float tileWidth, float tileHeight) {
+    const Key key{texture, src, flip, bakedTileSize(tileWidth, src.w), bakedTileSize(tileHeight, src.h)};
+    auto [it, inserted] = chunks.try_emplace(key);
+    Chunk& chunk = it->second;
+    if (inserted) {
+        // One tile per quad straight from the source unless a block can be baked
+        chunk.texture = texture;
+        chunk.src = src;
+        const int tilesX = std::max(1, kChunkPixels / key.tileWidth);
+        const int tilesY = std::max(1, kChunkPixels / key.tileHeight);
+        if (tilesX * tilesY > 1 && SDL_RenderTargetSupported(renderer)) {
+            chunk.tilesX = tilesX;
+            chunk.tilesY = tilesY;
+            if (!bake(renderer, key, chunk)) {
+                chunk.tilesX = 1;
+                chunk.tilesY = 1;
+            }
+        }
+    }
+    chunk.lastUsedFrame = frame;
+    return chunk;
+}
+
+bool TileCache::bake(SDL_Renderer* renderer, const Key& key, Chunk& chunk) {
+    const int width = key.tileWidth * chunk.tilesX;
+    const int height = key.tileHeight * chunk.tilesY;
+    SDL_Texture* target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!target) {
+        std::cerr << "TileCache: Failed to create " << width << "x" << height << " chunk - " << SDL_GetError() << std::endl;
+        return false;
+    }
+    SDL_SetTextureBlendMode(target, SDL_BLENDMODE_BLEND);
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    if (SDL_SetRenderTarget(renderer, target) != 0) {
+        std::cerr << "TileCache: Failed to bake chunk - " << SDL_GetError() << std::endl;
+        SDL_DestroyTexture(target);
+        return false;
+    }
+
+    Uint8 drawR = 0, drawG = 0, drawB = 0, drawA = 0;
+    SDL_BlendMode drawBlend = SDL_BLENDMODE_NONE;
+    SDL_GetRenderDrawColor(renderer, &drawR, &drawG, &drawB, &drawA);
+    SDL_GetRenderDrawBlendMode(renderer, &drawBlend);
+    Uint8 sourceR = 255, sourceG = 255, sourceB = 255, sourceA = 255;
+    SDL_BlendMode sourceBlend = SDL_BLENDMODE_BLEND;
+    SDL_GetTextureColorMod(key.source, &sourceR, &sourceG, &sourceB);
+    SDL_GetTextureAlphaMod(key.source, &sourceA);
+    SDL_GetTextureBlendMode(key.source, &sourceBlend);
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_RenderClear(renderer);
+
+    // Copy the texels as they are, alpha included; tint and alpha are applied when drawing
+    SDL_SetTextureColorMod(key.source, 255, 255, 255);
+    SDL_SetTextureAlphaMod(key.source, 255);
+    SDL_SetTextureBlendMode(key.source, SDL_BLENDMODE_NONE);
+    for (int tileY = 0; tileY < chunk.tilesY; ++tileY) {
+        for (int tileX = 0; tileX < chunk.tilesX; ++tileX) {
+            SDL_Rect dst = {tileX * key.tileWidth, tileY * key.tileHeight, key.tileWidth, key.tileHeight};
+            SDL_RenderCopyEx(renderer, key.source, &key.src, &dst, 0.0, nullptr, key.flip);
+        }
+    }
+
+    SDL_SetTextureColorMod(key.source, sourceR, sourceG, sourceB);
+    SDL_SetTextureAlphaMod(key.source, sourceA);
+    SDL_SetTextureBlendMode(key.source, sourceBlend);
+    SDL_SetRenderDrawColor(renderer, drawR, drawG, drawB, drawA);
+    SDL_SetRenderDrawBlendMode(renderer, drawBlend);
+    SDL_SetRenderTarget(renderer, previousTarget);
+
+    chunk.texture = target;
+    chunk.src = {0, 0, width, height};
+    chunk.baked = true;
+    ++bakedThisFrame;
+    return true;
+}
+
+void TileCache::queueTiled(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect& src, float centerX,
+                           float centerY, float width, float height, float tileWidth, float tileHeight,
+                           float angleDegrees, SDL_RendererFlip flip, SDL_Color tint, int layer) {
+    if (!renderer || !texture || src.w <= 0 || src.h <= 0) {
+        return;
+    }
+    width = std::max(width, 1.0f);
+    height = std::max(height, 1.0f);
+    tileWidth = std::max(tileWidth, 1.0f);
+    tileHeight = std::max(tileHeight, 1.0f);
+
+    const Chunk& chunk = chunkFor(renderer, texture, src, flip, tileWidth, tileHeight);
+    const float chunkWidth = tileWidth * static_cast<float>(chunk.tilesX);
+    const float chunkHeight = tileHeight * static_cast<float>(chunk.tilesY);
+    const SDL_RendererFlip quadFlip = chunk.baked ? SDL_FLIP_NONE : flip;
+
+    float cosA = 1.0f;
+    float sinA = 0.0f;
+    if (angleDegrees != 0.0f) {
+        const float radians = angleDegrees * static_cast<float>(M_PI) / 180.0f;
+        cosA = std::cos(radians);
+        sinA = std::sin(radians);
+    }
+
+    const int columns = static_cast<int>(std::ceil(width / chunkWidth));
+    const int rows = static_cast<int>(std::ceil(height / chunkHeight));
+    const float screenRight = static_cast<float>(Engine::screenWidth);
+    const float screenBottom = static_cast<float>(Engine::screenHeight);
+    RenderQueue& queue = RenderQueue::getInstance();
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            const float x = static_cast<float>(column) * chunkWidth;
+            const float y = static_cast<float>(row) * chunkHeight;
+
+            // The last column and row are cut at the area's edge
+            const float dstW = std::min(chunkWidth, width - x);
+            const float dstH = std::min(chunkHeight, height - y);
+            SDL_Rect part = chunk.src;
+            if (dstW < chunkWidth) {
+                part.w = std::clamp(static_cast<int>(std::round(chunk.src.w * dstW / chunkWidth)), 1, chunk.src.w);
+            }
+            if (dstH < chunkHeight) {
+                part.h = std::clamp(static_cast<int>(std::round(chunk.src.h * dstH / chunkHeight)), 1, chunk.src.h);
+            }
+
+            // Turn the piece's centre around the area's centre; the piece turns with it
+            const float localX = x + dstW * 0.5f - width * 0.5f;
+            const float localY = y + dstH * 0.5f - height * 0.5f;
+            const float pieceX = centerX + localX * cosA - localY * sinA;
+            const float pieceY = centerY + localX * sinA + localY * cosA;
+
+            const float reach = (dstW + dstH) * 0.5f;
+            if (pieceX + reach < 0.0f || pieceY + reach < 0.0f || pieceX - reach > screenRight ||
+                pieceY - reach > screenBottom) {
+                continue;
+            }
+
+            const SDL_FRect dst = {pieceX - dstW * 0.5f, pieceY - dstH * 0.5f, dstW, dstH};
+            queue.submit(chunk.texture, part, dst, angleDegrees, quadFlip, tint, layer);
+            ++quadsThisFrame;
+        }
+    }
+}
+
+void TileCache::drawTiledPlane(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect& src, float originX,
+                               float originY, float tileWidth, float tileHeight, uint8_t alpha) {
+    if (!renderer || !texture || src.w <= 0 || src.h <= 0) {
+        return;
+    }
+    tileWidth = std::max(tileWidth, 1.0f);
+    tileHeight = std::max(tileHeight, 1.0f);
+
+    const Chunk& chunk = chunkFor(renderer, texture, src, SDL_FLIP_NONE, tileWidth, tileHeight);
+    const float chunkWidth = tileWidth * static_cast<float>(chunk.tilesX);
+    const float chunkHeight = tileHeight * static_cast<float>(chunk.tilesY);
+
+    // First grid line at or left of / above the screen's edge
+    const float startX = originX - std::ceil(originX / chunkWidth) * chunkWidth;
+    const float startY = originY - std::ceil(originY / chunkHeight) * chunkHeight;
+    const int columns = static_cast<int>(std::ceil((static_cast<float>(Engine::screenWidth) - startX) / chunkWidth));
+    const int rows = static_cast<int>(std::ceil((static_cast<float>(Engine::screenHeight) - startY) / chunkHeight));
+
+    SDL_SetTextureAlphaMod(chunk.texture, alpha);
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            const SDL_FRect dst = {startX + static_cast<float>(column) * chunkWidth,
+                                   startY + static_cast<float>(row) * chunkHeight, chunkWidth, chunkHeight};
+            SDL_RenderCopyF(renderer, chunk.texture, &chunk.src, &dst);
+            ++quadsThisFrame;
+        }
+    }
+    SDL_SetTextureAlphaMod(chunk.texture, 255);
+}
+
+void TileCache::invalidate(SDL_Texture* texture) {
+    for (auto it = chunks.begin(); it != chunks.end();) {
+        if (it->first.source == texture) {
+            if (it->second.baked) {
+                SDL_DestroyTexture(it->second.texture);
+            }
+            it = chunks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void TileCache::clear() {
+    for (auto& [key, chunk] : chunks) {
+        if (chunk.baked) {
+            SDL_DestroyTexture(chunk.texture);
+        }
+    }
+    chunks.clear();
+}
+
+void TileCache::endFrame() {
+    FrameProfiler& profiler = FrameProfiler::getInstance();
+    if (profiler.isEnabled()) {
+        profiler.addCounter("Tile chunks baked", static_cast<double>(bakedThisFrame));
+        profiler.addCounter("Tile chunk quads", static_cast<double>(quadsThisFrame));
+    }
+    bakedThisFrame = 0;
+    quadsThisFrame = 0;
+
+    ++frame;
+    if (frame % kSweepInterval != 0) {
+        return;
+    }
+    for (auto it = chunks.begin(); it != chunks.end();) {
+        if (frame - it->second.lastUsedFrame > kMaxIdleFrames) {
+            if (it->second.baked) {
+                SDL_DestroyTexture(it->second.texture);
+            }
+            it = chunks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * Pre-tiled chunks for repeating sprites: tiled SpriteComponents (walls, floors) and
+ * tiled background layers. A tile pattern is baked once into a render-target texture
+ * holding a block of tiles, and areas are then covered with a few chunk-sized quads
+ * instead of one per tile.
+ *
+ * A chunk depends only on the source frame, the flip and the tile size on screen, so any
+ * number of areas share it. Tile sizes are rounded up to steps of a quarter octave (and
+ * never past the frame's own resolution), so a chunk is rebaked only when the camera
+ * scale moves by a step. Chunks unused for a while are dropped; SpriteManager invalidates
+ * the chunks of a texture it unloads.
+ *
+ * Without render-target support the pattern falls back to one quad per tile.
+ */
+class TileCache {
+public:
+    static TileCache& getInstance();
+
+    // Queue (RenderQueue) a width x height area in screen pixels, centred on (centerX, centerY)
+    // and turned angleDegrees clockwise, tiled with src from its top-left corner; tiles
+    // running past the right or bottom edge are cut
+    void queueTiled(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect& src, float centerX,
+                    float centerY, float width, float height, float tileWidth, float tileHeight,
+                    float angleDegrees, SDL_RendererFlip flip, SDL_Color tint, int layer);
+
+    // Draw straight away: tiles of src covering the whole screen, on a grid through
+    // (originX, originY) in screen pixels
+    void drawTiledPlane(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect& src, float originX,
+                        float originY, float tileWidth, float tileHeight, uint8_t alpha);
+
+    // Drop the chunks baked from texture (about to be destroyed)
+    void invalidate(SDL_Texture* texture);
+    // Drop everything (textures unloaded, render targets lost)
+    void clear();
+
+    // Once per rendered frame: ages chunks and drops the stale ones
+    void endFrame();
+
+    size_t size() const { return chunks.size(); }
+
+private:
+    struct Key {
+        SDL_Texture* source = nullptr;
+        SDL_Rect src{};
+        SDL_RendererFlip flip = SDL_FLIP_NONE;
+        int tileWidth = 0;  // baked tile size in chunk pixels
+        int tileHeight = 0;
+
+        bool operator==(const Key& other) const {
+            return source == other.source && src.x == other.src.x && src.y == other.src.y &&
+                   src.w == other.src.w && src.h == other.src.h && flip == other.flip &&
+                   tileWidth == other.tileWidth && tileHeight == other.tileHeight;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Chunk {
+        SDL_Texture* texture = nullptr;  // the source itself when not baked
+        SDL_Rect src{};                  // region of texture holding the block
+        int tilesX = 1;                  // tiles in the block
+        int tilesY = 1;
+        bool baked = false;              // texture is ours
+        uint32_t lastUsedFrame = 0;
+    };
+
+    TileCache() = default;
+    ~TileCache() = default;
+    TileCache(const TileCache&) = delete;
+    TileCache& operator=(const TileCache&) = delete;
+
+    // Chunk for tiles of src drawn tileWidth x tileHeight screen pixels, baking it if needed
+    const Chunk& chunkFor(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect& src,
+                          SDL_RendererFlip flip, float tileWidth, float tileHeight);
+    bool bake(SDL_Renderer* renderer, const Key& key, Chunk& chunk);
+
+    std::unordered_map<Key, Chunk, KeyHash> chunks;
+    uint32_t frame = 0;
+    size_t bakedThisFrame = 0;
+    size_t quadsThisFrame = 0;
+};
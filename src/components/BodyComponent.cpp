@@ -3,11 +3,13 @@
 #include "../Engine.h"
 #include "../Object.h"
 #include "../PhysicsMaterial.h"
+#include "../SensorEventManager.h"
 #include <iostream>
 #include <vector>
 
 BodyComponent::BodyComponent(Object& parent) : Component(parent), bodyId(b2_nullBodyId) {
     createDefaultBody();
+    markMoved();
 }
 
 BodyComponent::BodyComponent(Object& parent, float drag) : Component(parent), bodyId(b2_nullBodyId) {
@@ -15,10 +17,12 @@ BodyComponent::BodyComponent(Object& parent, float drag) : Component(parent), bo
     if (B2_IS_NON_NULL(bodyId)) {
         b2Body_SetLinearDamping(bodyId, drag);
     }
+    markMoved();
 }
 
 BodyComponent::BodyComponent(Object& parent, const nlohmann::json& data) : Component(parent), bodyId(b2_nullBodyId) {
     createBodyFromJson(data);
+    markMoved();
 }
 
 BodyComponent::~BodyComponent() {
@@ -26,6 +30,14 @@ BodyComponent::~BodyComponent() {
     if (B2_IS_NON_NULL(bodyId)) {
         b2DestroyBody(bodyId);
         bodyId = b2_nullBodyId;
+        markMoved();
+    }
+}
+
+void BodyComponent::markMoved() {
+    // Bodies appearing, disappearing or teleporting don't show up in Box2D's move events
+    if (Engine* engine = Object::getEngine()) {
+        engine->getMotionTracker().markMoved(parent().getHandle());
     }
 }
 
@@ -139,6 +151,62 @@ void BodyComponent::setPosition(float x, float y, float angle) {
     b2Vec2 position = {x * Engine::PIXELS_TO_METERS, y * Engine::PIXELS_TO_METERS};
     b2Rot rotation = b2MakeRot(Engine::degreesToRadians(angle));
     b2Body_SetTransform(bodyId, position, rotation);
+    
+    // Teleports snap instead of interpolating from the old location
+    hasPreviousTransform = false;
+    markMoved();
+}
+
+bool BodyComponent::resetToPrototype(const nlohmann::json& data) {
+    if (B2_IS_NULL(bodyId) || !b2Body_IsValid(bodyId)) {
+        return false;
+    }
+
+    // Same defaults as createBodyFromJson; fixtures are left as built
+    bool isLegacy = !data.contains("bodyType") && !data.contains("fixture");
+    if (isLegacy) {
+        b2Body_SetType(bodyId, b2_dynamicBody);
+        b2Body_SetFixedRotation(bodyId, false);
+        b2Body_SetBullet(bodyId, false);
+        b2Body_SetLinearDamping(bodyId, data.value("drag", 0.5f));
+        b2Body_SetAngularDamping(bodyId, 0.3f);
+        b2Body_SetGravityScale(bodyId, 1.0f);
+        spawnVelX = data.value("velX", 0.0f);
+        spawnVelY = data.value("velY", 0.0f);
+        spawnVelAngle = data.value("velAngle", 0.0f);
+    } else {
+        b2Body_SetType(bodyId, parseBodyType(data.value("bodyType", "dynamic")));
+        b2Body_SetFixedRotation(bodyId, data.value("fixedRotation", false));
+        b2Body_SetBullet(bodyId, data.value("bullet", false));
+        b2Body_SetLinearDamping(bodyId, data.value("linearDamping", 0.5f));
+        b2Body_SetAngularDamping(bodyId, data.value("angularDamping", 0.3f));
+        b2Body_SetGravityScale(bodyId, data.value("gravityScale", 1.0f));
+        spawnVelX = 0.0f;
+        spawnVelY = 0.0f;
+        spawnVelAngle = 0.0f;
+    }
+
+    setPosition(data.value("posX", 0.0f), data.value("posY", 0.0f), data.value("angle", 0.0f));
+    return true;
+}
+
+void BodyComponent::onPooled() {
+    if (B2_IS_NULL(bodyId)) {
+        return;
+    }
+    // Drop touch records so the next life doesn't inherit this one's contacts
+    SensorEventManager::getInstance().forgetBody(bodyId);
+    b2Body_Disable(bodyId);
+}
+
+void BodyComponent::onUnpooled() {
+    if (B2_IS_NULL(bodyId)) {
+        return;
+    }
+    b2Body_Enable(bodyId);
+    setVelocity(spawnVelX, spawnVelY, spawnVelAngle);
+    hasPreviousTransform = false;
+    markMoved();
 }
 
 void BodyComponent::setVelocity(float x, float y, float angle) {
@@ -166,13 +234,55 @@ std::tuple<float, float, float> BodyComponent::getPosition() {
     if (B2_IS_NULL(bodyId)) return {0.0f, 0.0f, 0.0f};
     
     // Convert meters to pixels
-    b2Vec2 pos = b2Body_GetPosition(bodyId);
-    b2Rot rot = b2Body_GetRotation(bodyId);
+    b2Transform transform = currentTransform();
+    float angle = Engine::radiansToDegrees(b2Rot_GetAngle(transform.q));
+    
+    return std::make_tuple(
+        transform.p.x * Engine::METERS_TO_PIXELS, 
+        transform.p.y * Engine::METERS_TO_PIXELS, 
+        angle
+    );
+}
+
+b2Transform BodyComponent::currentTransform() const {
+    // The last move event's transform stays current until the body moves again or is
+    // teleported, so resting bodies don't go back to Box2D
+    b2Transform transform;
+    Engine* engine = Object::getEngine();
+    if (!engine || !engine->getMotionTracker().getTransform(parent().getHandle(), transform)) {
+        transform = b2Body_GetTransform(bodyId);
+    }
+    return transform;
+}
+
+void BodyComponent::capturePreviousTransform() {
+    if (B2_IS_NULL(bodyId) || b2Body_GetType(bodyId) == b2_staticBody) {
+        hasPreviousTransform = false;
+        return;
+    }
+    
+    b2Transform transform = currentTransform();
+    previousPosition = transform.p;
+    previousRotation = transform.q;
+    hasPreviousTransform = true;
+}
+
+std::tuple<float, float, float> BodyComponent::getRenderPosition() {
+    Engine* engine = Object::getEngine();
+    float alpha = engine ? engine->getRenderInterpolationAlpha() : 1.0f;
+    if (B2_IS_NULL(bodyId) || !hasPreviousTransform || alpha >= 1.0f) {
+        return getPosition();
+    }
+    
+    // Blend between the previous and current physics states
+    b2Transform transform = currentTransform();
+    b2Vec2 pos = b2Lerp(previousPosition, transform.p, alpha);
+    b2Rot rot = b2NLerp(previousRotation, transform.q, alpha);
     float angle = Engine::radiansToDegrees(b2Rot_GetAngle(rot));
     
     return std::make_tuple(
-        pos.x * Engine::METERS_TO_PIXELS, 
-        pos.y * Engine::METERS_TO_PIXELS, 
+        pos.x * Engine::METERS_TO_PIXELS,
+        pos.y * Engine::METERS_TO_PIXELS,
         angle
     );
 }
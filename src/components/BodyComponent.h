@@ -14,11 +14,17 @@ public:
     ~BodyComponent() override;
     
     void update(float deltaTime) override;
+    TickRate getTickRate() const override { return TickRate::OnWake; }
     void draw() override;
     
     // Serialization
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "BodyComponent"; }
+
+    // Object pooling: the body is kept and disabled while parked
+    bool resetToPrototype(const nlohmann::json& data) override;
+    void onPooled() override;
+    void onUnpooled() override;
     
     // Interface methods (maintain compatibility)
     void setPosition(float x, float y, float angleDegrees);
@@ -29,6 +35,11 @@ public:
     // Returns (velX, velY, angularVelocityDegreesPerSecond)
     std::tuple<float,float,float> getVelocity();
     
+    // Fixed-timestep interpolation: snapshot the transform before a physics step, and
+    // return (x, y, angleDegrees) blended by the engine's render interpolation alpha
+    void capturePreviousTransform();
+    std::tuple<float,float,float> getRenderPosition();
+    
     // Get fixture dimensions in pixels (width, height)
     std::tuple<float, float> getFixtureSize() const;
 
@@ -45,7 +56,19 @@ private:
     int dominantMaterialId = 0;
     bool hasExplicitMaterial = false;
     
+    // Transform from before the most recent fixed physics step (meters / rotation)
+    b2Vec2 previousPosition{0.0f, 0.0f};
+    b2Rot previousRotation = b2Rot_identity;
+    bool hasPreviousTransform = false;
+
+    // Initial velocity reapplied when a pooled body is re-enabled (Box2D drops it on disable)
+    float spawnVelX = 0.0f;
+    float spawnVelY = 0.0f;
+    float spawnVelAngle = 0.0f;
+    
     // Helper methods
+    void markMoved();
+    b2Transform currentTransform() const;
     void createBodyFromJson(const nlohmann::json& data);
     void createDefaultBody(float posX = 0.0f, float posY = 0.0f, float angle = 0.0f);
     void createFixtureFromJson(const nlohmann::json& fixtureData);
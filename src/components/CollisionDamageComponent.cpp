@@ -18,6 +18,11 @@ CollisionDamageComponent::CollisionDamageComponent(Object& parent, const nlohman
     initializeFromJson(data);
 }
 
+CollisionDamageComponent::CollisionDamageComponent(Object& parent, const CollisionDamageComponent& prototype)
+    : Component(parent) {
+    *this = prototype;
+}
+
 void CollisionDamageComponent::initializeFromJson(const nlohmann::json& data) {
     enabled = data.value("enabled", enabled);
     baseDamage = data.value("baseDamage", baseDamage);
@@ -29,6 +34,19 @@ void CollisionDamageComponent::initializeFromJson(const nlohmann::json& data) {
     affectStatic = data.value("affectStatic", affectStatic);
 }
 
+bool CollisionDamageComponent::resetToPrototype(const nlohmann::json& data) {
+    enabled = true;
+    baseDamage = 0.0f;
+    kineticScale = 1.0f;
+    minApproachSpeed = 0.0f;
+    maxDamage = -1.0f;
+    affectDynamic = true;
+    affectKinematic = true;
+    affectStatic = true;
+    initializeFromJson(data);
+    return true;
+}
+
 void CollisionDamageComponent::update(float /*deltaTime*/) {
     // No per-frame logic required; damage is computed on impact
 }
@@ -86,4 +104,5 @@ nlohmann::json CollisionDamageComponent::toJson() const {
 }
 
 static ComponentRegistrar<CollisionDamageComponent> registrar("CollisionDamageComponent");
+static ComponentCopyRegistrar<CollisionDamageComponent> copyRegistrar("CollisionDamageComponent");
 
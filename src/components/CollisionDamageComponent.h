@@ -11,12 +11,16 @@ class CollisionDamageComponent : public Component {
 public:
     explicit CollisionDamageComponent(Object& parent);
     CollisionDamageComponent(Object& parent, const nlohmann::json& data);
+    // Typed copy of a prototype's component (ComponentCopyRegistrar)
+    CollisionDamageComponent(Object& parent, const CollisionDamageComponent& prototype);
 
     void update(float deltaTime) override;
+    TickRate getTickRate() const override { return TickRate::OnWake; }
     void draw() override;
 
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "CollisionDamageComponent"; }
+    bool resetToPrototype(const nlohmann::json& data) override;
 
     float calculateDamage(const Object& target, float selfMass, float approachSpeed) const;
     bool canAffectBodyType(b2BodyType type) const;
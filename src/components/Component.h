@@ -24,9 +24,35 @@ public:
     // Lifecycle hooks
     virtual void onParentDeath() {}
 
+    // Parallel update phase: update() may then run on a worker thread alongside other objects.
+    // It may read anything but only write its own object's components; other mutations
+    // (Box2D writes, spawns, markForDeath, use) go through JobSystem::runOrDefer
+    virtual bool isParallelSafe() const { return false; }
+
+    // Update cadence, read once when the component is attached. EveryFrame components update
+    // every simulation step; Interval ones every getTickInterval() seconds and OnWake ones
+    // only after TickScheduler::wake, both through TickScheduler with deltaTime covering the
+    // time since they last ran
+    enum class TickRate { EveryFrame, Interval, OnWake };
+    virtual TickRate getTickRate() const { return TickRate::EveryFrame; }
+    virtual float getTickInterval() const { return 0.0f; }
+
+    // Camera culling: how far (world pixels) draw() may reach past the body's bounds.
+    // Infinity for components drawing away from their object, which are then never culled
+    virtual float getDrawOverhang() const { return 0.0f; }
+
+    // Object pooling: restore the state this component was constructed with from data
+    // (false if the type can't be recycled), and sleep/wake while the object is parked
+    virtual bool resetToPrototype(const nlohmann::json& /*data*/) { return false; }
+    virtual void onPooled() {}
+    virtual void onUnpooled() {}
+
 protected:
     Object& parent() const { return parentObject; }
 
+    // Typed copies (ComponentCopyRegistrar) assign another component's state; the parent stays
+    Component& operator=(const Component&) { return *this; }
+
 private:
     Object& parentObject;
 };
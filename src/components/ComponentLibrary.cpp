@@ -1,4 +1,6 @@
 #include "ComponentLibrary.h"
+#include <cstdlib>
+#include <iostream>
 #include <stdexcept>
 
 ComponentLibrary& ComponentLibrary::getInstance() {
@@ -6,12 +8,22 @@ ComponentLibrary& ComponentLibrary::getInstance() {
     return instance;
 }
 
-void ComponentLibrary::registerComponent(const std::string& typeName, ComponentFactory factory, std::type_index typeIndex) {
+uint16_t allocateComponentTypeId(const std::type_info& type) {
+    static uint16_t nextId = 0;
+    if (nextId >= kMaxComponentTypes) {
+        std::cerr << "Fatal: Too many component types (" << kMaxComponentTypes << ") registering " << type.name()
+                  << ", raise kMaxComponentTypes in ComponentTypeId.h" << std::endl;
+        std::abort();
+    }
+    return nextId++;
+}
+
+void ComponentLibrary::registerComponent(const std::string& typeName, ComponentFactory factory, uint16_t typeId) {
     factories[typeName] = factory;
-    typeIndices.insert_or_assign(typeName, typeIndex);
+    typeIds[typeName] = typeId;
 }
 
-std::unique_ptr<Component> ComponentLibrary::createComponent(const std::string& typeName, Object& parent, const nlohmann::json& data) {
+ComponentPtr ComponentLibrary::createComponent(const std::string& typeName, Object& parent, const nlohmann::json& data) {
     auto it = factories.find(typeName);
     if (it == factories.end()) {
         throw std::runtime_error("Component type not registered: " + typeName);
@@ -19,6 +31,20 @@ std::unique_ptr<Component> ComponentLibrary::createComponent(const std::string&
     return it->second(parent, data);
 }
 
+const ComponentFactory* ComponentLibrary::findFactory(const std::string& typeName) const {
+    auto it = factories.find(typeName);
+    return it == factories.end() ? nullptr : &it->second;
+}
+
+void ComponentLibrary::registerTypedCopy(const std::string& typeName, ComponentTypedCopy typedCopy) {
+    typedCopies[typeName] = std::move(typedCopy);
+}
+
+const ComponentTypedCopy* ComponentLibrary::findTypedCopy(const std::string& typeName) const {
+    auto it = typedCopies.find(typeName);
+    return it == typedCopies.end() ? nullptr : &it->second;
+}
+
 bool ComponentLibrary::isRegistered(const std::string& typeName) const {
     return factories.find(typeName) != factories.end();
 }
@@ -32,9 +58,9 @@ std::vector<std::string> ComponentLibrary::getRegisteredTypes() const {
     return types;
 }
 
-std::type_index ComponentLibrary::getTypeIndex(const std::string& typeName) const {
-    auto it = typeIndices.find(typeName);
-    if (it == typeIndices.end()) {
+uint16_t ComponentLibrary::getTypeId(const std::string& typeName) const {
+    auto it = typeIds.find(typeName);
+    if (it == typeIds.end()) {
         throw std::runtime_error("Component type not registered: " + typeName);
     }
     return it->second;
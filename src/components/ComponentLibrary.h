@@ -1,17 +1,25 @@
 #pragma once
 
 #include "Component.h"
+#include "ComponentPool.h"
+#include "ComponentTypeId.h"
 #include <nlohmann/json.hpp>
 #include <string>
 #include <unordered_map>
 #include <functional>
 #include <memory>
-#include <typeindex>
 
 class Object;
 
 // Factory function type for creating components
-using ComponentFactory = std::function<std::unique_ptr<Component>(Object&, const nlohmann::json&)>;
+using ComponentFactory = std::function<ComponentPtr(Object&, const nlohmann::json&)>;
+
+// Typed copy of a component from a seed of the same type, for types registered with
+// ComponentCopyRegistrar: copy builds one for another object, reset assigns the seed's state
+struct ComponentTypedCopy {
+    std::function<ComponentPtr(Object&, const Component&)> copy;
+    std::function<void(Component&, const Component&)> reset;
+};
 
 /**
  * ComponentLibrary - Registry for component types to enable serialization
@@ -22,11 +30,18 @@ public:
     // Get the singleton instance
     static ComponentLibrary& getInstance();
     
-    // Register a component type with its factory function and type_index
-    void registerComponent(const std::string& typeName, ComponentFactory factory, std::type_index typeIndex);
+    // Register a component type with its factory function and dense type ID
+    void registerComponent(const std::string& typeName, ComponentFactory factory, uint16_t typeId);
     
     // Create a component from JSON data
-    std::unique_ptr<Component> createComponent(const std::string& typeName, Object& parent, const nlohmann::json& data);
+    ComponentPtr createComponent(const std::string& typeName, Object& parent, const nlohmann::json& data);
+    
+    // Resolve a factory once (nullptr if unregistered); stays valid for the program's lifetime
+    const ComponentFactory* findFactory(const std::string& typeName) const;
+    
+    // Typed copy support, for types that opt in (nullptr otherwise); same lifetime as factories
+    void registerTypedCopy(const std::string& typeName, ComponentTypedCopy typedCopy);
+    const ComponentTypedCopy* findTypedCopy(const std::string& typeName) const;
     
     // Check if a component type is registered
     bool isRegistered(const std::string& typeName) const;
@@ -34,13 +49,14 @@ public:
     // Get all registered component type names
     std::vector<std::string> getRegisteredTypes() const;
     
-    // Get type_index for a component type name
-    std::type_index getTypeIndex(const std::string& typeName) const;
+    // Get the dense type ID for a component type name
+    uint16_t getTypeId(const std::string& typeName) const;
     
 private:
     ComponentLibrary() = default;
     std::unordered_map<std::string, ComponentFactory> factories;
-    std::unordered_map<std::string, std::type_index> typeIndices;
+    std::unordered_map<std::string, uint16_t> typeIds;
+    std::unordered_map<std::string, ComponentTypedCopy> typedCopies;
 };
 
 /**
@@ -53,10 +69,29 @@ class ComponentRegistrar {
 public:
     ComponentRegistrar(const std::string& typeName) {
         ComponentLibrary::getInstance().registerComponent(typeName, 
-            [](Object& parent, const nlohmann::json& data) -> std::unique_ptr<Component> {
-                return std::make_unique<T>(parent, data);
+            [](Object& parent, const nlohmann::json& data) -> ComponentPtr {
+                return makeComponent<T>(parent, data);
             },
-            std::type_index(typeid(T)));
+            componentTypeId<T>());
     }
 };
 
+/**
+ * Opt-in typed copies for ObjectPrototype: types whose state is plain values (no engine
+ * resources made in the constructor) provide T(Object& parent, const T& prototype) and
+ * register it next to their ComponentRegistrar:
+ * static ComponentCopyRegistrar<MyComponent> copyRegistrar("MyComponent");
+ */
+template<typename T>
+class ComponentCopyRegistrar {
+public:
+    ComponentCopyRegistrar(const std::string& typeName) {
+        ComponentLibrary::getInstance().registerTypedCopy(typeName, ComponentTypedCopy{
+            [](Object& parent, const Component& seed) -> ComponentPtr {
+                return makeComponent<T>(parent, static_cast<const T&>(seed));
+            },
+            [](Component& component, const Component& seed) {
+                static_cast<T&>(component) = static_cast<const T&>(seed);
+            }});
+    }
+};
@@ -0,0 +1,62 @@
+#include "ComponentPool.h"
+#include "../Object.h"
+#include "../FrameProfiler.h"
+
+namespace {
+bool poolingEnabled = false;
+
+std::vector<ComponentPoolBase*>& registeredPools() {
+    static std::vector<ComponentPoolBase*> pools;
+    return pools;
+}
+}
+
+void ComponentDeleter::operator()(Component* component) const {
+    if (!component) {
+        return;
+    }
+    if (pool) {
+        pool->release(component);
+    } else {
+        delete component;
+    }
+}
+
+ComponentPoolBase::ComponentPoolBase() {
+    registeredPools().push_back(this);
+}
+
+void ComponentPoolBase::setEnabled(bool enabled) {
+    poolingEnabled = enabled;
+}
+
+bool ComponentPoolBase::isEnabled() {
+    return poolingEnabled;
+}
+
+void ComponentPoolBase::updateAllPools(float deltaTime) {
+    // Index loop: a pool created during the pass (first instance of a type) is appended
+    std::vector<ComponentPoolBase*>& pools = registeredPools();
+    for (size_t i = 0; i < pools.size(); ++i) {
+        pools[i]->updateAll(deltaTime);
+    }
+}
+
+bool ComponentPoolBase::shouldUpdate(const Object* owner) {
+    return owner->isInWorld() && !owner->isMarkedForDeath() && !owner->skipsSimulationStep();
+}
+
+float ComponentPoolBase::stepDeltaTime(const Object* owner, float deltaTime) {
+    return owner->getStepDeltaTime(deltaTime);
+}
+
+uint64_t ComponentPoolBase::profileNow() {
+    return FrameProfiler::getInstance().isEnabled() ? FrameProfiler::now() : 0;
+}
+
+void ComponentPoolBase::recordPoolUpdate(const Component& sample, uint64_t startNs, int calls) {
+    FrameProfiler& profiler = FrameProfiler::getInstance();
+    if (profiler.isEnabled() && startNs != 0) {
+        profiler.recordComponentUpdate(sample, FrameProfiler::now() - startNs, calls);
+    }
+}
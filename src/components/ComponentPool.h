@@ -0,0 +1,225 @@
+#pragma once
+
+#include "Component.h"
+#include "../JobSystem.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+class Object;
+class ComponentPoolBase;
+
+// Deleter for components: pooled components go back to their pool, others are deleted
+struct ComponentDeleter {
+    ComponentPoolBase* pool = nullptr;
+    void operator()(Component* component) const;
+};
+
+using ComponentPtr = std::unique_ptr<Component, ComponentDeleter>;
+
+/**
+ * Optional data-oriented storage: each component type lives in its own chunked pool
+ * (stable addresses, dense slots) and Engine updates pool by pool instead of object
+ * by object. Must be enabled before any components are created.
+ */
+class ComponentPoolBase {
+public:
+    virtual ~ComponentPoolBase() = default;
+
+    virtual void release(Component* component) = 0;
+    virtual void updateAll(float deltaTime) = 0;
+    virtual size_t liveCount() const = 0;
+
+    // Global switch for new components (existing components keep their storage)
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    // Update every pool in creation order (Engine::stepSimulation when pooling is enabled)
+    static void updateAllPools(float deltaTime);
+
+protected:
+    // Registers the pool so updateAllPools visits it
+    ComponentPoolBase();
+
+    // Owner is in the engine's object list, not marked for death and not sitting out this
+    // step (SimulationLod)
+    static bool shouldUpdate(const Object* owner);
+    // deltaTime, or the time gathered while the owner was dormant
+    static float stepDeltaTime(const Object* owner, float deltaTime);
+
+    // Profiler hooks for a whole pool pass (no-ops while the profiler is off)
+    static uint64_t profileNow();
+    static void recordPoolUpdate(const Component& sample, uint64_t startNs, int calls);
+};
+
+template<typename T>
+class ComponentPool final : public ComponentPoolBase {
+public:
+    static ComponentPool& instance() {
+        static ComponentPool pool;
+        return pool;
+    }
+
+    template<typename... Args>
+    T* create(Object& owner, Args&&... args) {
+        uint32_t index;
+        if (!freeSlots.empty()) {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            if (highWater == chunks.size() * kChunkSize) {
+                chunks.push_back(std::make_unique<Chunk>());
+            }
+            index = highWater++;
+        }
+
+        Chunk& chunk = *chunks[index / kChunkSize];
+        size_t slot = index % kChunkSize;
+        T* component = nullptr;
+        try {
+            component = new (chunk.slotAddress(slot)) T(owner, std::forward<Args>(args)...);
+        } catch (...) {
+            freeSlots.push_back(index);
+            throw;
+        }
+        chunk.owners[slot] = &owner;
+        chunk.everyFrame[slot] = component->getTickRate() == Component::TickRate::EveryFrame;
+        if (chunk.everyFrame[slot]) {
+            ++liveEveryFrame;
+        }
+        ++live;
+        return component;
+    }
+
+    void release(Component* component) override {
+        T* typed = static_cast<T*>(component);
+        unsigned char* address = reinterpret_cast<unsigned char*>(typed);
+        for (size_t c = 0; c < chunks.size(); ++c) {
+            Chunk& chunk = *chunks[c];
+            unsigned char* base = chunk.slotAddress(0);
+            if (address >= base && address < base + kChunkSize * sizeof(T)) {
+                size_t slot = static_cast<size_t>(address - base) / sizeof(T);
+                typed->~T();
+                chunk.owners[slot] = nullptr;
+                if (chunk.everyFrame[slot]) {
+                    --liveEveryFrame;
+                }
+                freeSlots.push_back(static_cast<uint32_t>(c * kChunkSize + slot));
+                --live;
+                return;
+            }
+        }
+    }
+
+    void updateAll(float deltaTime) override {
+        // Types that only update through TickScheduler aren't walked at all
+        if (liveEveryFrame == 0) {
+            return;
+        }
+
+        // Snapshot the bound: components created during this pass wait for the next step,
+        // matching objects queued through Engine::queueObject
+        const uint32_t end = highWater;
+        if (JobSystem::getInstance().isParallel() && isParallelType(end)) {
+            updateAllParallel(deltaTime, end);
+            return;
+        }
+
+        const Component* sample = nullptr;
+        uint64_t startNs = 0;
+        int calls = 0;
+        for (uint32_t index = 0; index < end; ++index) {
+            Chunk& chunk = *chunks[index / kChunkSize];
+            size_t slot = index % kChunkSize;
+            if (!chunk.owners[slot] || !chunk.everyFrame[slot] || !shouldUpdate(chunk.owners[slot])) {
+                continue;
+            }
+            T* component = std::launder(reinterpret_cast<T*>(chunk.slotAddress(slot)));
+            if (!sample) {
+                sample = component;
+                startNs = profileNow();
+            }
+            component->update(stepDeltaTime(chunk.owners[slot], deltaTime));
+            ++calls;
+        }
+        if (sample) {
+            recordPoolUpdate(*sample, startNs, calls);
+        }
+    }
+
+    size_t liveCount() const override { return live; }
+
+private:
+    static constexpr size_t kChunkSize = 256;
+
+    struct Chunk {
+        alignas(T) unsigned char storage[kChunkSize * sizeof(T)];
+        std::array<Object*, kChunkSize> owners{};
+        std::array<bool, kChunkSize> everyFrame{};  // getTickRate() == EveryFrame
+
+        unsigned char* slotAddress(size_t slot) { return storage + slot * sizeof(T); }
+    };
+
+    // Live, in the world and updated every step
+    T* liveComponent(uint32_t index) {
+        Chunk& chunk = *chunks[index / kChunkSize];
+        size_t slot = index % kChunkSize;
+        if (!chunk.owners[slot] || !chunk.everyFrame[slot] || !shouldUpdate(chunk.owners[slot])) {
+            return nullptr;
+        }
+        return std::launder(reinterpret_cast<T*>(chunk.slotAddress(slot)));
+    }
+
+    // All instances of a type answer isParallelSafe() alike; ask the first live one
+    bool isParallelType(uint32_t end) {
+        for (uint32_t index = 0; index < end; ++index) {
+            if (T* component = liveComponent(index)) {
+                return component->isParallelSafe();
+            }
+        }
+        return false;
+    }
+
+    void updateAllParallel(float deltaTime, uint32_t end) {
+        const Component* sample = nullptr;
+        for (uint32_t index = 0; index < end && !sample; ++index) {
+            sample = liveComponent(index);
+        }
+        uint64_t startNs = profileNow();
+        std::atomic<int> calls{0};
+        JobSystem::getInstance().parallelForDeferred(end, kChunkSize / 4, [this, deltaTime, &calls](size_t index) {
+            if (T* component = liveComponent(static_cast<uint32_t>(index))) {
+                component->update(stepDeltaTime(chunks[index / kChunkSize]->owners[index % kChunkSize], deltaTime));
+                calls.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        if (sample) {
+            recordPoolUpdate(*sample, startNs, calls.load());
+        }
+    }
+
+    ComponentPool() = default;
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<uint32_t> freeSlots;
+    uint32_t highWater = 0;
+    size_t live = 0;
+    size_t liveEveryFrame = 0;
+};
+
+// Create a component in its pool when pooling is enabled, otherwise on the heap
+template<typename T, typename... Args>
+ComponentPtr makeComponent(Object& owner, Args&&... args) {
+    if (ComponentPoolBase::isEnabled()) {
+        ComponentPool<T>& pool = ComponentPool<T>::instance();
+        return ComponentPtr(pool.create(owner, std::forward<Args>(args)...), ComponentDeleter{&pool});
+    }
+    return ComponentPtr(new T(owner, std::forward<Args>(args)...), ComponentDeleter{});
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <typeinfo>
+
+// Upper bound on distinct component classes; sizes the per-Object slot table
+constexpr size_t kMaxComponentTypes = 64;
+
+// Hands out the next dense type ID. Past kMaxComponentTypes it reports the type that
+// overflowed and aborts: IDs are handed out during static initialization, where an
+// exception would end the process before main without a word
+uint16_t allocateComponentTypeId(const std::type_info& type);
+
+// Dense per-class ID used to index Object's component slots. ComponentRegistrar assigns
+// IDs for registered types during static initialization; other types get one on first use.
+template<typename T>
+uint16_t componentTypeId() {
+    static const uint16_t id = allocateComponentTypeId(typeid(T));
+    return id;
+}
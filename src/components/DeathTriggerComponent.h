@@ -12,6 +12,7 @@ public:
     ~DeathTriggerComponent() override = default;
 
     void update(float deltaTime) override;
+    TickRate getTickRate() const override { return TickRate::OnWake; }
     void draw() override;
     void use(Object& instigator) override;
 
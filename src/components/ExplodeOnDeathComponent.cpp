@@ -6,9 +6,13 @@
 #include "../menus/MenuManager.h"
 #include "../Object.h"
 #include "../Engine.h"
+#include "../ObjectPool.h"
 #include <random>
 
 namespace {
+// Explosions pre-built per distinct sprite at level load
+constexpr size_t kExplosionReserve = 4;
+
 float randomAngleDegrees() {
     static thread_local std::mt19937 rng(std::random_device{}());
     static std::uniform_real_distribution<float> distribution(0.0f, 360.0f);
@@ -23,7 +27,9 @@ ExplodeOnDeathComponent::ExplodeOnDeathComponent(Object& parent)
       explosionHeight(64.0f),
       loopsBeforeDeath(3),
       randomizeAngleEachFrame(true),
-      triggered(false) {
+      triggered(false),
+      explosionPrefab(ObjectPool::kInvalidPrefab) {
+    registerExplosionPrefab();
 }
 
 ExplodeOnDeathComponent::ExplodeOnDeathComponent(Object& parent, const nlohmann::json& data)
@@ -33,7 +39,13 @@ ExplodeOnDeathComponent::ExplodeOnDeathComponent(Object& parent, const nlohmann:
       explosionHeight(64.0f),
       loopsBeforeDeath(3),
       randomizeAngleEachFrame(true),
-      triggered(false) {
+      triggered(false),
+      explosionPrefab(ObjectPool::kInvalidPrefab) {
+    initializeFromJson(data);
+    registerExplosionPrefab();
+}
+
+void ExplodeOnDeathComponent::initializeFromJson(const nlohmann::json& data) {
     if (data.contains("explosionSprite")) {
         explosionSprite = data["explosionSprite"].get<std::string>();
     }
@@ -51,6 +63,29 @@ ExplodeOnDeathComponent::ExplodeOnDeathComponent(Object& parent, const nlohmann:
     }
 }
 
+bool ExplodeOnDeathComponent::resetToPrototype(const nlohmann::json& data) {
+    std::string previousSprite = explosionSprite;
+    explosionSprite = "explosion";
+    explosionWidth = 64.0f;
+    explosionHeight = 64.0f;
+    loopsBeforeDeath = 3;
+    randomizeAngleEachFrame = true;
+    triggered = false;
+    initializeFromJson(data);
+    if (explosionSprite != previousSprite) {
+        // Re-registered with the next explosion
+        explosionPrefab = ObjectPool::kInvalidPrefab;
+    }
+    return true;
+}
+
+void ExplodeOnDeathComponent::registerExplosionPrefab() {
+    Engine* engine = Object::getEngine();
+    if (engine && !explosionSprite.empty()) {
+        explosionPrefab = engine->getObjectPool().registerSpriteEffect(explosionSprite, true, kExplosionReserve);
+    }
+}
+
 void ExplodeOnDeathComponent::update(float /*deltaTime*/) {
     // No continuous behavior required
 }
@@ -72,6 +107,7 @@ nlohmann::json ExplodeOnDeathComponent::toJson() const {
 
 void ExplodeOnDeathComponent::setExplosionSprite(const std::string& sprite) {
     explosionSprite = sprite;
+    explosionPrefab = ObjectPool::kInvalidPrefab;
 }
 
 void ExplodeOnDeathComponent::setExplosionSize(float width, float height) {
@@ -95,7 +131,7 @@ void ExplodeOnDeathComponent::onParentDeath() {
     
     auto* sound = parent().getComponent<SoundComponent>();
     auto* MenuManager = Object::getEngine()->getMenuManager();
-    if(!MenuManager->isMenuActive())
+    if(!MenuManager || !MenuManager->isMenuActive())
         if(sound)sound->playActionSound("explode");
 
     spawnExplosion();
@@ -117,20 +153,23 @@ void ExplodeOnDeathComponent::spawnExplosion() {
         std::tie(posX, posY, angle) = sprite->getPosition();
     }
 
-    auto explosionObject = std::make_unique<Object>();
+    if (explosionPrefab == ObjectPool::kInvalidPrefab) {
+        registerExplosionPrefab();
+    }
+    auto explosionObject = engine->getObjectPool().acquire(explosionPrefab);
+    if (!explosionObject) {
+        return;
+    }
     if (!parent().getName().empty()) {
         explosionObject->setName(parent().getName() + "_explosion");
     } else {
         explosionObject->setName("explosion");
     }
 
-    auto* explosionSpriteComponent = explosionObject->addComponent<SpriteComponent>(
-        explosionSprite,
-        true,
-        true,
-        loopsBeforeDeath);
+    auto* explosionSpriteComponent = explosionObject->getComponent<SpriteComponent>();
 
     if (explosionSpriteComponent) {
+        explosionSpriteComponent->setKillAfterLoops(loopsBeforeDeath);
         explosionSpriteComponent->setRenderSize(explosionWidth, explosionHeight);
         float initialAngle = randomizeAngleEachFrame ? randomAngleDegrees() : angle;
         explosionSpriteComponent->setPosition(posX, posY, initialAngle);
@@ -10,10 +10,12 @@ public:
     ~ExplodeOnDeathComponent() override = default;
 
     void update(float deltaTime) override;
+    TickRate getTickRate() const override { return TickRate::OnWake; }
     void draw() override;
 
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "ExplodeOnDeathComponent"; }
+    bool resetToPrototype(const nlohmann::json& data) override;
 
     void setExplosionSprite(const std::string& sprite);
     void setExplosionSize(float width, float height);
@@ -30,7 +32,10 @@ private:
     int loopsBeforeDeath;
     bool randomizeAngleEachFrame;
     bool triggered;
+    int explosionPrefab;  // ObjectPool prefab for the explosion sprite
 
+    void initializeFromJson(const nlohmann::json& data);
+    void registerExplosionPrefab();
     void spawnExplosion();
 };
 
@@ -21,6 +21,11 @@ HealthComponent::HealthComponent(Object& parent, const nlohmann::json& data)
     initializeFromJson(data);
 }
 
+HealthComponent::HealthComponent(Object& parent, const HealthComponent& prototype)
+    : Component(parent) {
+    *this = prototype;
+}
+
 void HealthComponent::initializeFromJson(const nlohmann::json& data) {
     if (data.contains("maxHP")) {
         maxHP = std::max(0.0f, data["maxHP"].get<float>());
@@ -40,6 +45,20 @@ void HealthComponent::initializeFromJson(const nlohmann::json& data) {
     destroyOnDeath = data.value("destroyOnDeath", destroyOnDeath);
 }
 
+bool HealthComponent::resetToPrototype(const nlohmann::json& data) {
+    maxHP = 100.0f;
+    currentHP = 100.0f;
+    impactResistance = 0.0f;
+    damageMultiplier = 1.0f;
+    regenPerSecond = 0.0f;
+    regenDelay = 0.0f;
+    timeSinceDamage = 0.0f;
+    receiveCollisionDamage = true;
+    destroyOnDeath = true;
+    initializeFromJson(data);
+    return true;
+}
+
 void HealthComponent::update(float deltaTime) {
     processRegen(deltaTime);
 }
@@ -145,4 +164,5 @@ nlohmann::json HealthComponent::toJson() const {
 
 // Register component
 static ComponentRegistrar<HealthComponent> registrar("HealthComponent");
+static ComponentCopyRegistrar<HealthComponent> copyRegistrar("HealthComponent");
 
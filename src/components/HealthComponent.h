@@ -10,6 +10,8 @@ class HealthComponent : public Component {
 public:
     explicit HealthComponent(Object& parent);
     HealthComponent(Object& parent, const nlohmann::json& data);
+    // Typed copy of a prototype's component (ComponentCopyRegistrar)
+    HealthComponent(Object& parent, const HealthComponent& prototype);
     ~HealthComponent() override = default;
 
     void update(float deltaTime) override;
@@ -17,6 +19,7 @@ public:
 
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "HealthComponent"; }
+    bool resetToPrototype(const nlohmann::json& data) override;
 
     float getCurrentHP() const { return currentHP; }
     float getMaxHP() const { return maxHP; }
@@ -20,6 +20,7 @@ public:
     virtual ~InputComponent() = default;
     
     void update(float deltaTime) override;
+    TickRate getTickRate() const override { return TickRate::OnWake; }
     void draw() override {} // Input component doesn't draw
     
     // Serialization
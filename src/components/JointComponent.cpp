@@ -9,7 +9,7 @@
 JointComponent::JointComponent(Object& parent) 
     : Component(parent), 
       jointId(b2_nullJointId),
-      connectedBody(nullptr),
+      connectedBody(),
       enableBreaking(false),
       maxBreakForce(INFINITY),
       maxBreakTorque(INFINITY),
@@ -20,7 +20,7 @@ JointComponent::JointComponent(Object& parent)
 JointComponent::JointComponent(Object& parent, const nlohmann::json& data) 
     : Component(parent),
       jointId(b2_nullJointId),
-      connectedBody(nullptr),
+      connectedBody(),
       enableBreaking(false),
       maxBreakForce(INFINITY),
       maxBreakTorque(INFINITY),
@@ -40,7 +40,7 @@ void JointComponent::setBreakSeparation(float separation) {
 
 void JointComponent::destroyJoint() {
     if (B2_IS_NULL(jointId)) {
-        connectedBody = nullptr;
+        connectedBody = ObjectHandle{};
         jointBroken = false;
         return;
     }
@@ -53,8 +53,8 @@ void JointComponent::destroyJoint() {
     } else {
         canDestroy = false;
     }
-    if (connectedBody && Object::isAlive(connectedBody)) {
-        if (auto* bodyCompB = connectedBody->getComponent<BodyComponent>()) {
+    if (Object* connected = Object::resolve(connectedBody)) {
+        if (auto* bodyCompB = connected->getComponent<BodyComponent>()) {
             if (B2_IS_NULL(bodyCompB->getBodyId())) {
                 canDestroy = false;
             }
@@ -70,7 +70,7 @@ void JointComponent::destroyJoint() {
     jointId = b2_nullJointId;
     // Reset broken flag so joint can be recreated
     jointBroken = false;
-    connectedBody = nullptr;
+    connectedBody = ObjectHandle{};
 }
 
 nlohmann::json JointComponent::toJson() const {
@@ -265,13 +265,7 @@ Object* JointComponent::findObjectByName(const std::string& name) {
     Engine* engine = Object::getEngine();
     if (!engine) return nullptr;
     
-    for (auto& obj : engine->getObjects()) {
-        if (obj->getName() == name) {
-            return obj.get();
-        }
-    }
-    
-    return nullptr;
+    return engine->findObjectByName(name);
 }
 
 void JointComponent::createJointFromJson(const nlohmann::json& data) {
@@ -283,9 +277,9 @@ void JointComponent::createJointFromJson(const nlohmann::json& data) {
     
     // Find connected body (this might fail if objects aren't loaded yet)
     // In a real implementation, you might need deferred joint creation
-    connectedBody = findObjectByName(connectedBodyName);
+    Object* connected = findObjectByName(connectedBodyName);
     
-    if (!connectedBody) {
+    if (!connected) {
         std::cerr << "Warning: Connected body '" << connectedBodyName 
                   << "' not found. Joint will not be created." << std::endl;
         // Note: In a production system, you'd want to defer joint creation
@@ -324,7 +318,7 @@ void JointComponent::createJointFromJson(const nlohmann::json& data) {
         if (length > 0) length *= Engine::PIXELS_TO_METERS;
         float hertz = data.value("hertz", 0.0f);
         float dampingRatio = data.value("dampingRatio", 0.0f);
-        createDistanceJoint(connectedBody, anchorA, anchorB, length, hertz, dampingRatio);
+        createDistanceJoint(connected, anchorA, anchorB, length, hertz, dampingRatio);
     }
     else if (jointTypeStr == "revolute") {
         bool enableLimit = data.value("enableLimit", false);
@@ -337,7 +331,7 @@ void JointComponent::createJointFromJson(const nlohmann::json& data) {
         float targetAngle = data.value("targetAngle", 0.0f);
         float hertz = data.value("hertz", 0.0f);
         float dampingRatio = data.value("dampingRatio", 0.0f);
-        createRevoluteJoint(connectedBody, anchorA, anchorB, enableLimit, lowerAngle, upperAngle,
+        createRevoluteJoint(connected, anchorA, anchorB, enableLimit, lowerAngle, upperAngle,
                           enableMotor, motorSpeed, maxMotorTorque, enableSpring, targetAngle, hertz, dampingRatio);
     }
     else if (jointTypeStr == "prismatic") {
@@ -352,13 +346,13 @@ void JointComponent::createJointFromJson(const nlohmann::json& data) {
         bool enableMotor = data.value("enableMotor", false);
         float motorSpeed = data.value("motorSpeed", 0.0f) * Engine::PIXELS_TO_METERS;
         float maxMotorForce = data.value("maxMotorForce", 0.0f);
-        createPrismaticJoint(connectedBody, anchorA, anchorB, axis, enableLimit, lowerTranslation, upperTranslation,
+        createPrismaticJoint(connected, anchorA, anchorB, axis, enableLimit, lowerTranslation, upperTranslation,
                            enableMotor, motorSpeed, maxMotorForce);
     }
     else if (jointTypeStr == "weld") {
         float hertz = data.value("hertz", 0.0f);
         float dampingRatio = data.value("dampingRatio", 0.0f);
-        createWeldJoint(connectedBody, anchorA, anchorB, hertz, dampingRatio);
+        createWeldJoint(connected, anchorA, anchorB, hertz, dampingRatio);
     }
     else if (jointTypeStr == "wheel") {
         b2Vec2 axis = {0.0f, 1.0f}; // default to vertical
@@ -371,7 +365,7 @@ void JointComponent::createJointFromJson(const nlohmann::json& data) {
         bool enableMotor = data.value("enableMotor", false);
         float motorSpeed = data.value("motorSpeed", 0.0f);
         float maxMotorTorque = data.value("maxMotorTorque", 0.0f);
-        createWheelJoint(connectedBody, anchorA, anchorB, axis, hertz, dampingRatio,
+        createWheelJoint(connected, anchorA, anchorB, axis, hertz, dampingRatio,
                         enableMotor, motorSpeed, maxMotorTorque);
     }
     else if (jointTypeStr == "motor") {
@@ -383,7 +377,7 @@ void JointComponent::createJointFromJson(const nlohmann::json& data) {
         float angularOffset = data.value("angularOffset", 0.0f);
         float maxForce = data.value("maxForce", 1.0f);
         float maxTorque = data.value("maxTorque", 1.0f);
-        createMotorJoint(connectedBody, linearOffset, angularOffset, maxForce, maxTorque);
+        createMotorJoint(connected, linearOffset, angularOffset, maxForce, maxTorque);
     }
     else if (jointTypeStr == "mouse") {
         b2Vec2 target = {0.0f, 0.0f};
@@ -394,10 +388,10 @@ void JointComponent::createJointFromJson(const nlohmann::json& data) {
         float hertz = data.value("hertz", 5.0f);
         float dampingRatio = data.value("dampingRatio", 0.7f);
         float maxForce = data.value("maxForce", 1000.0f);
-        createMouseJoint(connectedBody, target, hertz, dampingRatio, maxForce);
+        createMouseJoint(connected, target, hertz, dampingRatio, maxForce);
     }
     else if (jointTypeStr == "filter") {
-        createFilterJoint(connectedBody);
+        createFilterJoint(connected);
     }
     
     // Set collision state if specified
@@ -442,7 +436,7 @@ void JointComponent::createDistanceJoint(Object* bodyB, const b2Vec2& anchorA, c
     }
     
     jointId = b2CreateDistanceJoint(engine->getPhysicsWorld(), &def);
-    connectedBody = bodyB;
+    connectedBody = bodyB->getHandle();
 }
 
 void JointComponent::createRevoluteJoint(Object* bodyB, const b2Vec2& anchorA, const b2Vec2& anchorB,
@@ -491,7 +485,7 @@ void JointComponent::createRevoluteJoint(Object* bodyB, const b2Vec2& anchorA, c
     }
     
     jointId = b2CreateRevoluteJoint(engine->getPhysicsWorld(), &def);
-    connectedBody = bodyB;
+    connectedBody = bodyB->getHandle();
 }
 
 void JointComponent::createPrismaticJoint(Object* bodyB, const b2Vec2& anchorA, const b2Vec2& anchorB, const b2Vec2& axis,
@@ -533,7 +527,7 @@ void JointComponent::createPrismaticJoint(Object* bodyB, const b2Vec2& anchorA,
     }
     
     jointId = b2CreatePrismaticJoint(engine->getPhysicsWorld(), &def);
-    connectedBody = bodyB;
+    connectedBody = bodyB->getHandle();
 }
 
 void JointComponent::createWeldJoint(Object* bodyB, const b2Vec2& anchorA, const b2Vec2& anchorB,
@@ -568,7 +562,7 @@ void JointComponent::createWeldJoint(Object* bodyB, const b2Vec2& anchorA, const
     }
     
     jointId = b2CreateWeldJoint(engine->getPhysicsWorld(), &def);
-    connectedBody = bodyB;
+    connectedBody = bodyB->getHandle();
 }
 
 void JointComponent::createWheelJoint(Object* bodyB, const b2Vec2& anchorA, const b2Vec2& anchorB, const b2Vec2& axis,
@@ -610,7 +604,7 @@ void JointComponent::createWheelJoint(Object* bodyB, const b2Vec2& anchorA, cons
     }
     
     jointId = b2CreateWheelJoint(engine->getPhysicsWorld(), &def);
-    connectedBody = bodyB;
+    connectedBody = bodyB->getHandle();
 }
 
 void JointComponent::createMotorJoint(Object* bodyB, const b2Vec2& linearOffset,
@@ -643,7 +637,7 @@ void JointComponent::createMotorJoint(Object* bodyB, const b2Vec2& linearOffset,
     def.maxTorque = maxTorque;
     
     jointId = b2CreateMotorJoint(engine->getPhysicsWorld(), &def);
-    connectedBody = bodyB;
+    connectedBody = bodyB->getHandle();
 }
 
 void JointComponent::createMouseJoint(Object* bodyB, const b2Vec2& target,
@@ -673,7 +667,7 @@ void JointComponent::createMouseJoint(Object* bodyB, const b2Vec2& target,
     def.maxForce = maxForce;
     
     jointId = b2CreateMouseJoint(engine->getPhysicsWorld(), &def);
-    connectedBody = bodyB;
+    connectedBody = bodyB->getHandle();
 }
 
 void JointComponent::createFilterJoint(Object* bodyB) {
@@ -698,7 +692,7 @@ void JointComponent::createFilterJoint(Object* bodyB) {
     def.bodyIdB = bodyCompB->getBodyId();
     
     jointId = b2CreateFilterJoint(engine->getPhysicsWorld(), &def);
-    connectedBody = bodyB;
+    connectedBody = bodyB->getHandle();
 }
 
 // Query methods
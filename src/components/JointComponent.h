@@ -1,5 +1,6 @@
 #pragma once
 #include "Component.h"
+#include "../ObjectHandle.h"
 #include <box2d/box2d.h>
 #include <nlohmann/json.hpp>
 #include <string>
@@ -88,7 +89,7 @@ public:
     
 private:
     b2JointId jointId;
-    Object* connectedBody; // The object this joint connects to
+    ObjectHandle connectedBody; // The object this joint connects to
     std::string connectedBodyName; // Name of connected body (for JSON loading)
     
     // Breaking limits
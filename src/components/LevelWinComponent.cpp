@@ -5,9 +5,6 @@
 #include "../Object.h"
 #include "../menus/MenuManager.h"
 #include <iostream>
-#include <filesystem>
-#include <fstream>
-#include <climits>
 #include <nlohmann/json.hpp>
 
 LevelWinComponent::LevelWinComponent(Object& parent)
@@ -90,43 +87,10 @@ void LevelWinComponent::use(Object& instigator) {
     std::string levelToLoad = targetLevelName;
     
     if (levelToLoad.empty()) {
-        // Find next available level based on updated progression
+        // Find next available level based on updated progression (resolved by the preloader
+        // when it looked for the same one)
         int progression = saveMgr.getLevelProgression();
-        std::string levelsDir = "assets/levels";
-        std::string nextLevelPath = "";
-        int lowestOrder = INT_MAX;
-        
-        try {
-            if (std::filesystem::exists(levelsDir) && std::filesystem::is_directory(levelsDir)) {
-                for (const auto& entry : std::filesystem::directory_iterator(levelsDir)) {
-                    if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                        std::string filePath = entry.path().string();
-                        std::ifstream file(filePath);
-                        if (file.is_open()) {
-                            nlohmann::json levelJson;
-                            try {
-                                file >> levelJson;
-                                file.close();
-                                
-                                if (levelJson.contains("order") && levelJson["order"].is_number_integer()) {
-                                    int order = levelJson["order"].get<int>();
-                                    
-                                    // Find level with lowest order above current progression
-                                    if (order > progression && order < lowestOrder) {
-                                        lowestOrder = order;
-                                        nextLevelPath = filePath;
-                                    }
-                                }
-                            } catch (...) {
-                                file.close();
-                            }
-                        }
-                    }
-                }
-            }
-        } catch (const std::filesystem::filesystem_error& e) {
-            std::cerr << "[LevelWinComponent] Filesystem error: " << e.what() << std::endl;
-        }
+        std::string nextLevelPath = engine->findNextLevelPath(progression);
         
         if (!nextLevelPath.empty()) {
             levelToLoad = nextLevelPath;
@@ -10,6 +10,7 @@ public:
     LevelWinComponent(Object& parent, const nlohmann::json& data);
 
     void update(float deltaTime) override;
+    TickRate getTickRate() const override { return TickRate::OnWake; }
     void draw() override;
     void use(Object& instigator) override;
 
@@ -2,9 +2,10 @@
 #include "ComponentLibrary.h"
 #include "../Object.h"
 #include "../Engine.h"
+#include "../ObjectPool.h"
+#include "BodyComponent.h"
 #include <algorithm>
 #include <random>
-#include <chrono>
 #include <iostream>
 
 ObjectSpawnerComponent::ObjectSpawnerComponent(Object& parent)
@@ -13,7 +14,7 @@ ObjectSpawnerComponent::ObjectSpawnerComponent(Object& parent)
     , useNextPosition(true)
     , currentSpawnableIndex(0)
     , currentLocationIndex(0)
-    , rng(static_cast<unsigned int>(std::chrono::steady_clock::now().time_since_epoch().count()))
+    , rng(Engine::makeRngSeed())
 {
 }
 
@@ -23,7 +24,7 @@ ObjectSpawnerComponent::ObjectSpawnerComponent(Object& parent, const nlohmann::j
     , useNextPosition(data.value("useNextPosition", true))
     , currentSpawnableIndex(0)
     , currentLocationIndex(0)
-    , rng(static_cast<unsigned int>(std::chrono::steady_clock::now().time_since_epoch().count()))
+    , rng(Engine::makeRngSeed())
 {
     // Load spawnable objects
     if (data.contains("spawnableObjects") && data["spawnableObjects"].is_array()) {
@@ -67,6 +68,10 @@ ObjectSpawnerComponent::ObjectSpawnerComponent(Object& parent, const nlohmann::j
             spawnLocations.push_back(SpawnLocation(x, y));
         }
     }
+
+    for (auto& spawnable : spawnableObjects) {
+        registerPrefab(spawnable);
+    }
 }
 
 void ObjectSpawnerComponent::update(float deltaTime) {
@@ -171,13 +176,9 @@ int ObjectSpawnerComponent::selectSpawnLocationIndex() {
     }
 }
 
-void ObjectSpawnerComponent::createAndQueueObject(const SpawnableObject& spawnable, const SpawnLocation& location) {
+nlohmann::json ObjectSpawnerComponent::buildObjectDefinition(const SpawnableObject& spawnable) const {
     Engine* engine = Object::getEngine();
-    if (!engine) {
-        std::cerr << "ObjectSpawnerComponent: Engine not available!" << std::endl;
-        return;
-    }
-    
+
     // Build the object definition
     nlohmann::json objectDef;
     
@@ -208,12 +209,10 @@ void ObjectSpawnerComponent::createAndQueueObject(const SpawnableObject& spawnab
         objectDef["components"] = nlohmann::json::array();
     }
     
-    // Find or create BodyComponent to set position
+    // Spawned objects need a BodyComponent to be placed at a spawn location
     bool foundBodyComponent = false;
-    for (auto& component : objectDef["components"]) {
+    for (const auto& component : objectDef["components"]) {
         if (component.contains("type") && component["type"] == "BodyComponent") {
-            component["posX"] = location.x;
-            component["posY"] = location.y;
             foundBodyComponent = true;
             break;
         }
@@ -223,14 +222,47 @@ void ObjectSpawnerComponent::createAndQueueObject(const SpawnableObject& spawnab
     if (!foundBodyComponent) {
         nlohmann::json bodyComponent;
         bodyComponent["type"] = "BodyComponent";
-        bodyComponent["posX"] = location.x;
-        bodyComponent["posY"] = location.y;
         objectDef["components"].push_back(bodyComponent);
     }
-    
-    // Create the object
-    auto newObject = std::make_unique<Object>();
-    newObject->fromJson(objectDef);
+
+    return objectDef;
+}
+
+void ObjectSpawnerComponent::registerPrefab(SpawnableObject& spawnable) {
+    Engine* engine = Object::getEngine();
+    if (!engine) {
+        return;
+    }
+
+    // Enough instances for one spawn per location (or the remaining budget, if smaller)
+    size_t reserve = spawnLocations.size();
+    if (spawnable.remainingSpawns >= 0) {
+        reserve = std::min(reserve, static_cast<size_t>(spawnable.remainingSpawns));
+    }
+    spawnable.poolPrefab = engine->getObjectPool().registerPrefab(buildObjectDefinition(spawnable), reserve);
+}
+
+void ObjectSpawnerComponent::createAndQueueObject(SpawnableObject& spawnable, const SpawnLocation& location) {
+    Engine* engine = Object::getEngine();
+    if (!engine) {
+        std::cerr << "ObjectSpawnerComponent: Engine not available!" << std::endl;
+        return;
+    }
+
+    if (spawnable.poolPrefab == ObjectPool::kInvalidPrefab) {
+        registerPrefab(spawnable);
+    }
+
+    // Recycled or freshly built from the resolved definition
+    auto newObject = engine->getObjectPool().acquire(spawnable.poolPrefab);
+    if (!newObject) {
+        return;
+    }
+
+    if (auto* body = newObject->getComponent<BodyComponent>()) {
+        float angle = std::get<2>(body->getPosition());
+        body->setPosition(location.x, location.y, angle);
+    }
     
     // Queue it to be added to the engine
     engine->queueObject(std::move(newObject));
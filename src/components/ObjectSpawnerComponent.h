@@ -11,8 +11,9 @@ struct SpawnableObject {
     nlohmann::json objectData;  // Full object definition (can use template or be standalone)
     int maxSpawns;              // -1 for infinite
     int remainingSpawns;         // Current remaining spawns
+    int poolPrefab;              // ObjectPool prefab of the resolved definition
     
-    SpawnableObject() : maxSpawns(-1), remainingSpawns(-1) {}
+    SpawnableObject() : maxSpawns(-1), remainingSpawns(-1), poolPrefab(-1) {}
 };
 
 struct SpawnLocation {
@@ -33,6 +34,7 @@ public:
     ~ObjectSpawnerComponent() override = default;
 
     void update(float deltaTime) override;
+    TickRate getTickRate() const override { return TickRate::OnWake; }
     void draw() override {}
 
     void use(Object& instigator) override;
@@ -49,7 +51,9 @@ private:
     void spawnObject();
     int selectSpawnableObjectIndex();
     int selectSpawnLocationIndex();
-    void createAndQueueObject(const SpawnableObject& spawnable, const SpawnLocation& location);
+    nlohmann::json buildObjectDefinition(const SpawnableObject& spawnable) const;
+    void registerPrefab(SpawnableObject& spawnable);
+    void createAndQueueObject(SpawnableObject& spawnable, const SpawnLocation& location);
 
     std::vector<SpawnableObject> spawnableObjects;
     std::vector<SpawnLocation> spawnLocations;
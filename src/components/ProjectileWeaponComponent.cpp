@@ -1,7 +1,9 @@
 #include "ProjectileWeaponComponent.h"
 #include "ComponentLibrary.h"
 #include "../Engine.h"
+#include "../ObjectPool.h"
 #include "../Object.h"
+#include "../RenderQueue.h"
 #include "BodyComponent.h"
 #include "HealthComponent.h"
 #include "SpriteComponent.h"
@@ -10,8 +12,8 @@
 #include <cmath>
 #include <iostream>
 #include <algorithm>
-#include <chrono>
 #include <cstring>
+#include <limits>
 
 ProjectileWeaponComponent::ProjectileWeaponComponent(Object& parent)
     : Component(parent)
@@ -24,6 +26,7 @@ ProjectileWeaponComponent::ProjectileWeaponComponent(Object& parent)
     , hitSpriteWidth(32.0f)
     , hitSpriteHeight(32.0f)
     , hitSpriteDuration(0.1f)
+    , hitSpritePrefab(ObjectPool::kInvalidPrefab)
     , offsetX(0.0f)
     , offsetY(0.0f)
     , offsetAngle(0.0f)
@@ -32,7 +35,8 @@ ProjectileWeaponComponent::ProjectileWeaponComponent(Object& parent)
     , trailColorG(255)
     , trailColorB(0)
     , trailColorA(255)
-    , rng(static_cast<unsigned int>(std::chrono::steady_clock::now().time_since_epoch().count())) {
+    , rng(Engine::makeRngSeed()) {
+    registerHitSpritePrefab();
 }
 
 ProjectileWeaponComponent::ProjectileWeaponComponent(Object& parent, const nlohmann::json& data)
@@ -46,6 +50,7 @@ ProjectileWeaponComponent::ProjectileWeaponComponent(Object& parent, const nlohm
     , hitSpriteWidth(data.value("hitSpriteWidth", 32.0f))
     , hitSpriteHeight(data.value("hitSpriteHeight", 32.0f))
     , hitSpriteDuration(data.value("hitSpriteDuration", 0.1f))
+    , hitSpritePrefab(ObjectPool::kInvalidPrefab)
     , offsetX(data.value("offsetX", 0.0f))
     , offsetY(data.value("offsetY", 0.0f))
     , offsetAngle(data.value("offsetAngle", 0.0f))
@@ -54,7 +59,7 @@ ProjectileWeaponComponent::ProjectileWeaponComponent(Object& parent, const nlohm
     , trailColorG(255)
     , trailColorB(0)
     , trailColorA(255)
-    , rng(static_cast<unsigned int>(std::chrono::steady_clock::now().time_since_epoch().count())) {
+    , rng(Engine::makeRngSeed()) {
     
     // Parse trail color if provided
     if (data.contains("trailColor") && data["trailColor"].is_object()) {
@@ -63,6 +68,8 @@ ProjectileWeaponComponent::ProjectileWeaponComponent(Object& parent, const nlohm
         trailColorB = data["trailColor"].value("b", 0);
         trailColorA = data["trailColor"].value("a", 255);
     }
+
+    registerHitSpritePrefab();
 }
 
 void ProjectileWeaponComponent::update(float deltaTime) {
@@ -83,46 +90,44 @@ void ProjectileWeaponComponent::update(float deltaTime) {
         activeTrails.end());
 }
 
+float ProjectileWeaponComponent::getDrawOverhang() const {
+    for (const auto& trail : activeTrails) {
+        if (trail.active) {
+            return std::numeric_limits<float>::infinity();
+        }
+    }
+    return 0.0f;
+}
+
 void ProjectileWeaponComponent::draw() {
     Engine* engine = Object::getEngine();
     if (!engine) {
         return;
     }
 
-    SDL_Renderer* renderer = engine->getRenderer();
-    if (!renderer) {
+    if (!engine->getRenderer()) {
         return;
     }
 
-    // Save current draw color
-    Uint8 oldR, oldG, oldB, oldA;
-    SDL_GetRenderDrawColor(renderer, &oldR, &oldG, &oldB, &oldA);
-
-    // Draw all active bullet trails
-    SDL_SetRenderDrawColor(renderer, trailColorR, trailColorG, trailColorB, trailColorA);
+    // Trails go through the render queue so they stay in object order with the sprites
+    RenderQueue& queue = RenderQueue::getInstance();
+    auto cameraState = engine->getCameraState();
+    float scale = cameraState.scale;
     for (const auto& trail : activeTrails) {
         if (trail.active) {
-            // Convert world coordinates to screen coordinates
             float alpha = trail.elapsed / trail.duration;
             uint8_t currentAlpha = static_cast<uint8_t>(trailColorA * (1.0f - alpha));
-            SDL_SetRenderDrawColor(renderer, trailColorR, trailColorG, trailColorB, currentAlpha);
-            
-            // Get camera state for coordinate conversion
-            auto cameraState = engine->getCameraState();
-            float scale = cameraState.scale;
-            
-            // Convert to screen coordinates
+
+            // Convert world coordinates to screen coordinates
             float screenStartX = (trail.startX - cameraState.viewMinX) * scale;
             float screenStartY = (trail.startY - cameraState.viewMinY) * scale;
             float screenEndX = (trail.endX - cameraState.viewMinX) * scale;
             float screenEndY = (trail.endY - cameraState.viewMinY) * scale;
-            
-            SDL_RenderDrawLineF(renderer, screenStartX, screenStartY, screenEndX, screenEndY);
+
+            queue.submitLine(screenStartX, screenStartY, screenEndX, screenEndY, 1.0f,
+                             SDL_Color{trailColorR, trailColorG, trailColorB, currentAlpha});
         }
     }
-
-    // Restore original draw color
-    SDL_SetRenderDrawColor(renderer, oldR, oldG, oldB, oldA);
 }
 
 nlohmann::json ProjectileWeaponComponent::toJson() const {
@@ -388,7 +393,13 @@ void ProjectileWeaponComponent::createHitSprite(float x, float y) {
         return;
     }
 
-    auto hitSpriteObject = std::make_unique<Object>();
+    if (hitSpritePrefab == ObjectPool::kInvalidPrefab) {
+        registerHitSpritePrefab();
+    }
+    auto hitSpriteObject = engine->getObjectPool().acquire(hitSpritePrefab);
+    if (!hitSpriteObject) {
+        return;
+    }
     hitSpriteObject->setName(parent().getName().empty() ? "bullet_hit" : parent().getName() + "_hit");
 
     // Calculate approximate loops from duration (assuming ~10 fps default animation speed)
@@ -399,13 +410,10 @@ void ProjectileWeaponComponent::createHitSprite(float x, float y) {
         loops = static_cast<int>(std::ceil(hitSpriteDuration / 0.1f));
     }
     
-    auto* spriteComponent = hitSpriteObject->addComponent<SpriteComponent>(
-        hitSpriteName,
-        true,  // animate
-        false, // loop (one shot)
-        loops); // kill after loops
+    auto* spriteComponent = hitSpriteObject->getComponent<SpriteComponent>();
 
     if (spriteComponent) {
+        spriteComponent->setKillAfterLoops(loops);
         spriteComponent->setRenderSize(hitSpriteWidth, hitSpriteHeight);
         spriteComponent->setPosition(x, y, 0.0f);
         spriteComponent->playAnimation(false); // Don't loop
@@ -414,5 +422,13 @@ void ProjectileWeaponComponent::createHitSprite(float x, float y) {
     engine->queueObject(std::move(hitSpriteObject));
 }
 
+void ProjectileWeaponComponent::registerHitSpritePrefab() {
+    Engine* engine = Object::getEngine();
+    if (engine && !hitSpriteName.empty()) {
+        // One-shot animation; a few shots' worth of hits are pre-built at level load
+        hitSpritePrefab = engine->getObjectPool().registerSpriteEffect(hitSpriteName, false, 4 * (piercingCount + 1));
+    }
+}
+
 static ComponentRegistrar<ProjectileWeaponComponent> registrar("ProjectileWeaponComponent");
 
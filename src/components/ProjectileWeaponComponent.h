@@ -21,6 +21,8 @@ public:
 
     void update(float deltaTime) override;
     void draw() override;
+    // Trails are drawn where the shots went
+    float getDrawOverhang() const override;
 
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "ProjectileWeaponComponent"; }
@@ -48,6 +50,7 @@ private:
     std::vector<HitInfo> performRaycast(float startX, float startY, float dirX, float dirY, float range);
     void processHit(const b2RayResult& hit, float hitX, float hitY, Object& instigator, int pierceIndex);
     void createHitSprite(float x, float y);
+    void registerHitSpritePrefab();
 
     // Configuration
     float range;
@@ -59,6 +62,7 @@ private:
     float hitSpriteWidth;
     float hitSpriteHeight;
     float hitSpriteDuration; // How long hit sprite stays visible
+    int hitSpritePrefab;     // ObjectPool prefab for hit sprites
     float offsetX;
     float offsetY;
     float offsetAngle; // Additional angle offset from object's angle (degrees)
@@ -10,12 +10,13 @@
 #include "../InputManager.h"
 #include "../HostManager.h"
 #include "../ClientManager.h"
+#include "../JobSystem.h"
+#include "../FrameBudgetGovernor.h"
 
 #include <algorithm>
 #include <iostream>
 #include <limits>
 #include <tuple>
-#include <regex>
 #include <unordered_map>
 
 namespace {
@@ -24,6 +25,14 @@ float clampNonNegative(float value) {
     return std::max(0.0f, value);
 }
 
+// Well-mixed value per (handle, salt); summing them hashes a set independent of its order
+uint64_t mixHandle(ObjectHandle handle, uint64_t salt) {
+    uint64_t z = ((static_cast<uint64_t>(handle.generation) << 32) | handle.index) + salt * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
 } // namespace
 
 SensorComponent::SensorComponent(Object& parent)
@@ -43,6 +52,7 @@ SensorComponent::SensorComponent(Object& parent, const nlohmann::json& data)
     allowSelfTrigger = data.value("allowSelfTrigger", allowSelfTrigger);
     useRegexForInstigators = data.value("useRegexForInstigators", useRegexForInstigators);
     includeInteractComponent = data.value("includeInteractComponent", includeInteractComponent);
+    eventDriven = data.value("eventDriven", eventDriven);
 
     if (data.contains("targetObjects")) {
         if (data["targetObjects"].is_array()) {
@@ -50,7 +60,6 @@ SensorComponent::SensorComponent(Object& parent, const nlohmann::json& data)
         } else if (data["targetObjects"].is_string()) {
             targetNames = {data["targetObjects"].get<std::string>()};
         }
-        targetCacheDirty = true;
     }
     
     if (data.contains("unsatisfiedTargetObjects")) {
@@ -59,7 +68,6 @@ SensorComponent::SensorComponent(Object& parent, const nlohmann::json& data)
         } else if (data["unsatisfiedTargetObjects"].is_string()) {
             unsatisfiedTargetNames = {data["unsatisfiedTargetObjects"].get<std::string>()};
         }
-        unsatisfiedTargetCacheDirty = true;
     }
     
     if (data.contains("allowedInstigators")) {
@@ -104,6 +112,7 @@ SensorComponent::SensorComponent(Object& parent, const nlohmann::json& data)
         requireInstigatorDeath = data["requireInstigatorDeath"].get<bool>();
     }
 
+    compileNameMatchers();
     updateSenseMask();
 }
 
@@ -117,8 +126,7 @@ void SensorComponent::initializeDefaults() {
     allowSelfTrigger = false;
     useRegexForInstigators = false;
     includeInteractComponent = false;
-    targetCacheDirty = true;
-    unsatisfiedTargetCacheDirty = true;
+    eventDriven = true;
     cachedBody = nullptr;
     cachedBodyId = b2_nullBodyId;
     usingSensorFixtures = false;
@@ -140,7 +148,6 @@ void SensorComponent::initializeDefaults() {
     requireInstigatorDeath = false;
     previouslyAliveInstigators.clear();
     instigatorNames.clear();
-    triggeredDeaths.clear();
     instigatorDeathTrackingInitialized = false;
 }
 
@@ -201,158 +208,31 @@ void SensorComponent::refreshShapeCache() {
     }
 }
 
-void SensorComponent::rebuildTargetCache() {
-    targetCache.clear();
-    targetRegexes.clear();
-    
-    // Compile regex patterns if using regex
-    if (useRegex) {
-        for (const auto& pattern : targetNames) {
-            try {
-                targetRegexes.emplace_back(pattern, std::regex::ECMAScript | std::regex::icase);
-            } catch (const std::regex_error& e) {
-                std::cerr << "[SensorComponent] Invalid regex pattern '" << pattern << "': " << e.what() << std::endl;
-            }
-        }
-    }
-    
-    Engine* engine = Object::getEngine();
-    if (!engine) {
-        return;
-    }
-
-    for (const auto& objectPtr : engine->getObjects()) {
-        if (!objectPtr) {
-            continue;
-        }
-        Object* obj = objectPtr.get();
-        if (!obj || !Object::isAlive(obj)) {
-            continue;
-        }
-        if (obj == &parent() && !allowSelfTrigger) {
-            continue;
-        }
-        if (targetNames.empty()) {
-            continue;
-        }
-        
-        const std::string& objName = obj->getName();
-        bool matches = false;
-        
-        if (useRegex) {
-            // Check against regex patterns
-            for (const auto& regex : targetRegexes) {
-                if (std::regex_search(objName, regex)) {
-                    matches = true;
-                    break;
-                }
-            }
-        } else {
-            // Exact name matching
-            if (std::find(targetNames.begin(), targetNames.end(), objName) != targetNames.end()) {
-                matches = true;
-            }
-        }
-        
-        if (matches) {
-            targetCache.push_back(obj);
-        }
-    }
-    targetCacheDirty = false;
+void SensorComponent::compileNameMatchers() {
+    targetMatcher = NameMatcher::compile(targetNames, useRegex);
+    unsatisfiedTargetMatcher = NameMatcher::compile(unsatisfiedTargetNames, useRegex);
+    allowedInstigatorMatcher = NameMatcher::compile(allowedInstigatorNames, useRegexForInstigators);
 }
 
-void SensorComponent::rebuildUnsatisfiedTargetCache() {
-    unsatisfiedTargetCache.clear();
-    unsatisfiedTargetRegexes.clear();
-    
-    if (useRegex) {
-        for (const auto& pattern : unsatisfiedTargetNames) {
-            try {
-                unsatisfiedTargetRegexes.emplace_back(pattern, std::regex::ECMAScript | std::regex::icase);
-            } catch (const std::regex_error&) {
-                // Invalid regex, skip
-            }
-        }
-    }
-    
+std::vector<ObjectHandle> SensorComponent::collectTargets(const NameMatcher& matcher) const {
+    std::vector<ObjectHandle> targets;
     Engine* engine = Object::getEngine();
-    if (!engine) {
-        return;
-    }
-
-    for (const auto& objectPtr : engine->getObjects()) {
-        if (!objectPtr) {
-            continue;
-        }
-        Object* obj = objectPtr.get();
-        if (!obj || !Object::isAlive(obj)) {
-            continue;
-        }
-        if (obj == &parent() && !allowSelfTrigger) {
-            continue;
-        }
-        if (unsatisfiedTargetNames.empty()) {
-            continue;
-        }
-        
-        const std::string& objName = obj->getName();
-        bool matches = false;
-        
-        if (useRegex) {
-            // Check against regex patterns
-            for (const auto& regex : unsatisfiedTargetRegexes) {
-                if (std::regex_search(objName, regex)) {
-                    matches = true;
-                    break;
-                }
-            }
-        } else {
-            // Exact name matching
-            if (std::find(unsatisfiedTargetNames.begin(), unsatisfiedTargetNames.end(), objName) != unsatisfiedTargetNames.end()) {
-                matches = true;
-            }
-        }
-        
-        if (matches) {
-            unsatisfiedTargetCache.push_back(obj);
-        }
-    }
-    unsatisfiedTargetCacheDirty = false;
-}
-
-void SensorComponent::refreshUnsatisfiedTargetCache() {
-    if (!unsatisfiedTargetCacheDirty) {
-        for (Object* target : unsatisfiedTargetCache) {
-            if (!target || !Object::isAlive(target)) {
-                unsatisfiedTargetCacheDirty = true;
-                break;
-            }
-        }
-    }
-
-    if (unsatisfiedTargetCacheDirty) {
-        rebuildUnsatisfiedTargetCache();
+    if (!engine || matcher.empty()) {
+        return targets;
     }
-}
 
-void SensorComponent::refreshTargetCache() {
-    if (!targetCacheDirty) {
-        for (Object* target : targetCache) {
-            if (!target || !Object::isAlive(target)) {
-                targetCacheDirty = true;
-                break;
-            }
+    // Copied, since using a target can add, rename or remove objects in the name index
+    for (ObjectHandle handle : engine->findObjectsMatching(matcher)) {
+        if (handle != parent().getHandle() || allowSelfTrigger) {
+            targets.push_back(handle);
         }
     }
-
-    if (targetCacheDirty) {
-        rebuildTargetCache();
-    }
+    return targets;
 }
 
 void SensorComponent::setTargetNames(const std::vector<std::string>& names) {
     targetNames = names;
-    targetCacheDirty = true;
+    targetMatcher = NameMatcher::compile(targetNames, useRegex);
 }
 
 std::vector<Object*> SensorComponent::gatherCandidates() const {
@@ -364,33 +244,13 @@ std::vector<Object*> SensorComponent::gatherCandidates() const {
             const auto contacting = eventManager.getContactingObjects(shapeId);
             // Filter collision event objects by eligibility
             for (Object* obj : contacting) {
-                if (!obj || (obj == &parent() && !allowSelfTrigger) || !Object::isAlive(obj)) {
+                if (!obj || (obj == &parent() && !allowSelfTrigger)) {
                     continue;
                 }
                 // Check eligibility before adding
                 bool hasInteract = obj->getComponent<InteractComponent>() != nullptr;
-                bool isAllowedInstigator = false;
+                bool isAllowedInstigator = allowedInstigatorMatcher.matches(obj->getName());
                 
-                if (!allowedInstigatorNames.empty()) {
-                    const std::string& objName = obj->getName();
-                    if (useRegexForInstigators) {
-                        for (const auto& pattern : allowedInstigatorNames) {
-                            try {
-                                std::regex regex(pattern, std::regex::ECMAScript | std::regex::icase);
-                                if (std::regex_search(objName, regex)) {
-                                    isAllowedInstigator = true;
-                                    break;
-                                }
-                            } catch (const std::regex_error&) {
-                                // Invalid regex, skip
-                            }
-                        }
-                    } else {
-                        if (std::find(allowedInstigatorNames.begin(), allowedInstigatorNames.end(), objName) != allowedInstigatorNames.end()) {
-                            isAllowedInstigator = true;
-                        }
-                    }
-                }
                 
                 // Respect includeInteractComponent flag
                 if (includeInteractComponent) {
@@ -411,33 +271,13 @@ std::vector<Object*> SensorComponent::gatherCandidates() const {
                 const auto overlapping = eventManager.getSensorOverlappingObjects(shapeId);
                 // Filter sensor overlap objects by eligibility
                 for (Object* obj : overlapping) {
-                    if (!obj || (obj == &parent() && !allowSelfTrigger) || !Object::isAlive(obj)) {
+                    if (!obj || (obj == &parent() && !allowSelfTrigger)) {
                         continue;
                     }
                     // Check eligibility before adding
                     bool hasInteract = obj->getComponent<InteractComponent>() != nullptr;
-                    bool isAllowedInstigator = false;
+                    bool isAllowedInstigator = allowedInstigatorMatcher.matches(obj->getName());
                     
-                    if (!allowedInstigatorNames.empty()) {
-                        const std::string& objName = obj->getName();
-                        if (useRegexForInstigators) {
-                            for (const auto& pattern : allowedInstigatorNames) {
-                                try {
-                                    std::regex regex(pattern, std::regex::ECMAScript | std::regex::icase);
-                                    if (std::regex_search(objName, regex)) {
-                                        isAllowedInstigator = true;
-                                        break;
-                                    }
-                                } catch (const std::regex_error&) {
-                                    // Invalid regex, skip
-                                }
-                            }
-                        } else {
-                            if (std::find(allowedInstigatorNames.begin(), allowedInstigatorNames.end(), objName) != allowedInstigatorNames.end()) {
-                                isAllowedInstigator = true;
-                            }
-                        }
-                    }
                     
                     // Respect includeInteractComponent flag
                     if (includeInteractComponent) {
@@ -457,98 +297,88 @@ std::vector<Object*> SensorComponent::gatherCandidates() const {
         }
     }
 
-    //if (!requireCollision) {
-        Engine* engine = Object::getEngine();
-        if (engine) {
+    Engine* engine = Object::getEngine();
+    if (engine) {
+        auto considerObject = [&](Object* obj) {
+            if (obj && passesCandidateFilter(*obj)) {
+                uniqueCandidates.insert(obj);
+            }
+        };
+
+        // Distance, box zone and collision conditions can only pass for objects near the
+        // sensor, so those come from the spatial index (or the contacts above). Previously
+        // satisfied instigators are always revisited so leaving the area still fires the
+        // unsatisfied targets. Other sensors consider every object
+        std::vector<Object*> nearby;
+        if (collectNearbyObjects(*engine, nearby)) {
+            for (Object* obj : nearby) {
+                considerObject(obj);
+            }
+            for (ObjectHandle handle : previouslySatisfiedInstigators) {
+                considerObject(Object::resolve(handle));
+            }
+        } else if (!allowedInstigatorMatcher.empty() && !includeInteractComponent) {
+            // Only allowed instigators qualify, so the name index has them already
+            for (ObjectHandle handle : engine->findObjectsMatching(allowedInstigatorMatcher)) {
+                considerObject(Object::resolve(handle));
+            }
+        } else {
             for (const auto& objectPtr : engine->getObjects()) {
-                Object* obj = objectPtr.get();
-                if (!obj || (obj == &parent() && !allowSelfTrigger)) {
-                    continue;
-                }
-                if (!Object::isAlive(obj)) {
-                    continue;
-                }
-                
-                // Check if object is eligible based on includeInteractComponent setting
-                bool hasInteract = obj->getComponent<InteractComponent>() != nullptr;
-                bool isAllowedInstigator = false;
-                
-                if (!allowedInstigatorNames.empty()) {
-                    const std::string& objName = obj->getName();
-                    if (useRegexForInstigators) {
-                        for (const auto& pattern : allowedInstigatorNames) {
-                            try {
-                                std::regex regex(pattern, std::regex::ECMAScript | std::regex::icase);
-                                if (std::regex_search(objName, regex)) {
-                                    isAllowedInstigator = true;
-                                    break;
-                                }
-                            } catch (const std::regex_error&) {
-                                // Invalid regex, skip
-                            }
-                        }
-                    } else {
-                        if (std::find(allowedInstigatorNames.begin(), allowedInstigatorNames.end(), objName) != allowedInstigatorNames.end()) {
-                            isAllowedInstigator = true;
-                        }
-                    }
-                }
-                
-                // Respect includeInteractComponent flag
-                if (includeInteractComponent) {
-                    // Whitelist mode: include objects with InteractComponent OR in allowed list
-                    if (hasInteract || isAllowedInstigator) {
-                        uniqueCandidates.insert(obj);
-                    }
-                } else {
-                    // Original mode: only include objects in allowed list (bypasses InteractComponent requirement)
-                    if (isAllowedInstigator) {
-                        uniqueCandidates.insert(obj);
-                    } else if (hasInteract && allowedInstigatorNames.empty()) {
-                        // If no allowed list, fall back to InteractComponent (backward compatibility)
-                        uniqueCandidates.insert(obj);
-                    }
-                }
+                considerObject(objectPtr.get());
             }
         }
-    //}
+    }
 
     std::vector<Object*> candidates;
     candidates.reserve(uniqueCandidates.size());
     for (Object* obj : uniqueCandidates) {
-        if (obj && (obj != &parent() || allowSelfTrigger) && Object::isAlive(obj)) {
+        if (obj && (obj != &parent() || allowSelfTrigger)) {
             candidates.push_back(obj);
         }
     }
     return candidates;
 }
 
-bool SensorComponent::isInstigatorEligible(Object& instigator) const {
-    // Check if instigator is in allowed list
-    bool inAllowedList = false;
-    if (!allowedInstigatorNames.empty()) {
-        const std::string& instigatorName = instigator.getName();
-        
-        if (useRegexForInstigators) {
-            // Check against regex patterns
-            for (const auto& pattern : allowedInstigatorNames) {
-                try {
-                    std::regex regex(pattern, std::regex::ECMAScript | std::regex::icase);
-                    if (std::regex_search(instigatorName, regex)) {
-                        inAllowedList = true;
-                        break;
-                    }
-                } catch (const std::regex_error&) {
-                    // Invalid regex, skip
-                }
-            }
-        } else {
-            // Exact name matching
-            if (std::find(allowedInstigatorNames.begin(), allowedInstigatorNames.end(), instigatorName) != allowedInstigatorNames.end()) {
-                inAllowedList = true;
-            }
+bool SensorComponent::passesCandidateFilter(Object& obj) const {
+    if (&obj == &parent() && !allowSelfTrigger) {
+        return false;
+    }
+    
+    // Check if object is eligible based on includeInteractComponent setting
+    bool hasInteract = obj.getComponent<InteractComponent>() != nullptr;
+    bool isAllowedInstigator = allowedInstigatorMatcher.matches(obj.getName());
+    
+    // Respect includeInteractComponent flag
+    if (includeInteractComponent) {
+        // Whitelist mode: include objects with InteractComponent OR in allowed list
+        return hasInteract || isAllowedInstigator;
+    }
+    // Original mode: only include objects in allowed list (bypasses InteractComponent requirement).
+    // If no allowed list, fall back to InteractComponent (backward compatibility)
+    return isAllowedInstigator || (hasInteract && allowedInstigatorNames.empty());
+}
+
+bool SensorComponent::collectNearbyObjects(Engine& engine, std::vector<Object*>& out) const {
+    if (maxDistance > 0.0f) {
+        // Without a body of its own the distance check fails for every object
+        if (cachedBody && B2_IS_NON_NULL(cachedBodyId)) {
+            auto [x, y, angle] = cachedBody->getPosition();
+            (void)angle;
+            engine.getSpatialIndex().queryRadius(x, y, maxDistance, out);
         }
+        return true;
     }
+    if (requireBoxZone) {
+        engine.getSpatialIndex().queryAABB({boxZoneMinX, boxZoneMinY, boxZoneMaxX, boxZoneMaxY}, out);
+        return true;
+    }
+    // Collision candidates were already gathered from the contact and overlap events
+    return requireCollision;
+}
+
+bool SensorComponent::isInstigatorEligible(Object& instigator) const {
+    // Check if instigator is in allowed list
+    bool inAllowedList = allowedInstigatorMatcher.matches(instigator.getName());
     
     // Check if instigator has InteractComponent
     auto* interact = instigator.getComponent<InteractComponent>();
@@ -643,27 +473,19 @@ bool SensorComponent::verifyInputActivityCondition() const {
     
     if (inputActivityType == "controller_connect" || inputActivityType == "controller_connected") {
         // Check if any controller was recently connected
-        // Use a static map to track controller counts per sensor instance
-        static std::unordered_map<const SensorComponent*, int> lastControllerCounts;
+        // (count kept per sensor instance, so sensors can be evaluated in parallel)
         InputManager& inputMgr = InputManager::getInstance();
         int currentCount = inputMgr.getNumControllers();
         
-        auto it = lastControllerCounts.find(this);
-        if (it == lastControllerCounts.end()) {
+        if (lastControllerCount < 0) {
             // First time checking - initialize
-            lastControllerCounts[this] = currentCount;
+            lastControllerCount = currentCount;
             return false;  // Don't trigger on first check
         }
         
-        int lastCount = it->second;
-        if (currentCount > lastCount) {
-            lastControllerCounts[this] = currentCount;
-            return true;  // Controller was added
-        }
-        
-        // Update count even if no change (for next frame)
-        lastControllerCounts[this] = currentCount;
-        return false;
+        int lastCount = lastControllerCount;
+        lastControllerCount = currentCount;
+        return currentCount > lastCount;  // Controller was added
     } else if (inputActivityType == "client_join" || inputActivityType == "client_joined") {
         // Check if a client joined the hosted game
         // Note: This is a simplified check. For proper event-based detection,
@@ -735,7 +557,7 @@ bool SensorComponent::verifyGlobalValueCondition() const {
 
 void SensorComponent::checkInstigatorDeaths() {
     // Get all eligible instigators from the engine (not filtered by distance/collision)
-    std::unordered_set<Object*> currentlyAliveInstigators;
+    std::unordered_set<ObjectHandle> currentlyAliveInstigators;
     
     Engine* engine = Object::getEngine();
     if (engine) {
@@ -744,13 +566,10 @@ void SensorComponent::checkInstigatorDeaths() {
             if (!obj || (obj == &parent() && !allowSelfTrigger)) {
                 continue;
             }
-            if (!Object::isAlive(obj)) {
-                continue;
-            }
             
             // Check if this object is an eligible instigator
             if (isInstigatorEligible(*obj)) {
-                currentlyAliveInstigators.insert(obj);
+                currentlyAliveInstigators.insert(obj->getHandle());
             }
         }
     }
@@ -760,9 +579,9 @@ void SensorComponent::checkInstigatorDeaths() {
     if (!instigatorDeathTrackingInitialized) {
         previouslyAliveInstigators = currentlyAliveInstigators;
         // Cache names for all tracked instigators (safe to access even after they die)
-        for (Object* instigator : currentlyAliveInstigators) {
-            if (instigator) {
-                instigatorNames[instigator] = instigator->getName();
+        for (ObjectHandle handle : currentlyAliveInstigators) {
+            if (Object* instigator = Object::resolve(handle)) {
+                instigatorNames[handle] = instigator->getName();
             }
         }
         instigatorDeathTrackingInitialized = true;
@@ -771,157 +590,51 @@ void SensorComponent::checkInstigatorDeaths() {
         return;  // Don't trigger on initialization
     }
     
-    // Check for instigators that were alive before but are now dead
-    // IMPORTANT: Only iterate over previouslyAliveInstigators - this ensures we only
-    // check instigators that existed in the previous frame, not newly spawned ones
-    for (Object* previouslyAlive : previouslyAliveInstigators) {
-        // Only trigger if the object was actually alive and eligible in the previous frame
-        // and is now dead (not just ineligible)
-        if (!previouslyAlive) {
-            // Null pointer - skip (shouldn't happen, but be safe)
+    // A tracked instigator whose handle no longer resolves has died. Handles are never
+    // reissued, so each death is seen exactly once and a newly spawned object can't mask it.
+    // Objects that are alive but no longer eligible stay tracked so their death still counts
+    for (auto it = previouslyAliveInstigators.begin(); it != previouslyAliveInstigators.end();) {
+        if (Object* instigator = Object::resolve(*it)) {
+            // Update name cache in case it changed
+            instigatorNames[*it] = instigator->getName();
+            ++it;
             continue;
         }
         
-        // Check if object is still alive according to Object::isAlive()
-        // This is the definitive check - if Object::isAlive() returns false, the object is dead
-        bool isStillAlive = Object::isAlive(previouslyAlive);
-        
-        // Only trigger if the object is actually dead (not just ineligible)
-        // This ensures we don't trigger when objects become ineligible for other reasons
-        // and we definitely don't trigger for newly spawned objects
-        if (!isStillAlive) {
-            // Check if we've already triggered for this death
-            // This prevents multiple triggers for the same death
-            if (triggeredDeaths.find(previouslyAlive) == triggeredDeaths.end()) {
-                // Object died - trigger death once
-                // Use cached name to avoid accessing destroyed object
-                std::string objName = "<unnamed>";
-                auto nameIt = instigatorNames.find(previouslyAlive);
-                if (nameIt != instigatorNames.end()) {
-                    objName = nameIt->second.empty() ? "<unnamed>" : nameIt->second;
-                }
-                std::cout << "[SensorComponent] InstigatorDeath: Detected death of '" << objName 
-                          << "' (was in previous set, now dead)" << std::endl;
-                trigger(parent());
-                triggeredDeaths.insert(previouslyAlive);
-            }
-        } else {
-            // Object is still alive - update cached name if needed and verify it's in the current set
-            // Update name cache in case it changed
-            if (previouslyAlive) {
-                instigatorNames[previouslyAlive] = previouslyAlive->getName();
-            }
-            
-            // If it's not, it might have become ineligible, but we don't trigger for that
-            bool isInCurrentSet = currentlyAliveInstigators.find(previouslyAlive) != currentlyAliveInstigators.end();
-            if (!isInCurrentSet) {
-                // Object is alive but no longer eligible - this is not a death, don't trigger
-                // (This can happen if eligibility criteria change, but we only care about actual deaths)
-            }
-        }
+        // Use cached name to avoid accessing destroyed object
+        std::string objName = "<unnamed>";
+        auto nameIt = instigatorNames.find(*it);
+        if (nameIt != instigatorNames.end()) {
+            objName = nameIt->second.empty() ? "<unnamed>" : nameIt->second;
+            instigatorNames.erase(nameIt);
+        }
+        std::cout << "[SensorComponent] InstigatorDeath: Detected death of '" << objName 
+                  << "' (was in previous set, now dead)" << std::endl;
+        trigger(parent());
+        it = previouslyAliveInstigators.erase(it);
     }
     
-    // IMPORTANT: Add new instigators BEFORE removing dead ones
-    // This ensures that if an object dies and a new one spawns at the same address in the same frame,
-    // we properly track the new one
-    
-    // First, add all currently eligible instigators to tracking
-    // This includes both existing tracked ones and newly spawned ones
-    for (Object* instigator : currentlyAliveInstigators) {
-        if (instigator && Object::isAlive(instigator)) {
-            // Check if this is a newly added instigator (not in tracking yet)
-            bool isNewlyAdded = previouslyAliveInstigators.find(instigator) == previouslyAliveInstigators.end();
-            
-            // Always update name cache for alive instigators (in case name changed or object was recreated)
-            // This is important: if an object dies and a new one spawns at the same address,
-            // we need to update the name cache even if the pointer is the same
-            std::string currentName = instigator->getName();
-            bool nameChanged = false;
-            std::string oldName;
-            if (instigatorNames.find(instigator) != instigatorNames.end()) {
-                oldName = instigatorNames[instigator];
-                nameChanged = (oldName != currentName);
-            }
-            instigatorNames[instigator] = currentName;
-            
-            // Add to tracking if not already there
-            if (isNewlyAdded) {
-                previouslyAliveInstigators.insert(instigator);
-                
-                // Log when an instigator is first added to tracking
-                std::string objName = currentName.empty() ? "<unnamed>" : currentName;
-                std::cout << "[SensorComponent] InstigatorDeath: Added '" << objName 
-                          << "' to tracking list (now tracking " << previouslyAliveInstigators.size() 
-                          << " instigators)" << std::endl;
-            } else if (nameChanged) {
-                // Log if name changed (might indicate object was recreated at same address)
-                std::string oldNameDisplay = oldName.empty() ? "<unnamed>" : oldName;
-                std::string newNameDisplay = currentName.empty() ? "<unnamed>" : currentName;
-                std::cout << "[SensorComponent] InstigatorDeath: Name changed for tracked instigator at " 
-                          << static_cast<void*>(instigator) << " (old: '" << oldNameDisplay 
-                          << "', new: '" << newNameDisplay << "')" << std::endl;
-            }
+    // Start tracking newly eligible instigators
+    for (ObjectHandle handle : currentlyAliveInstigators) {
+        if (!previouslyAliveInstigators.insert(handle).second) {
+            continue;
         }
-    }
-    
-    // Now remove objects from tracking only if they're actually dead AND not in current set
-    // This ensures we continue tracking objects that become ineligible, so we can detect their death later
-    // We do this AFTER adding new ones to handle the case where an object dies and a new one spawns at the same address
-    for (auto it = previouslyAliveInstigators.begin(); it != previouslyAliveInstigators.end();) {
-        Object* trackedObj = *it;
+        Object* instigator = Object::resolve(handle);
+        std::string currentName = instigator ? instigator->getName() : std::string();
+        instigatorNames[handle] = currentName;
         
-        // Check if object is dead
-        if (!trackedObj || !Object::isAlive(trackedObj)) {
-            // Object is dead - check if there's a replacement in the current set
-            // (This handles the case where memory is reused and a new object spawns at the same address)
-            bool hasReplacement = currentlyAliveInstigators.find(trackedObj) != currentlyAliveInstigators.end();
-            
-            if (!hasReplacement) {
-                // Object is dead and no replacement - remove from tracking
-                // But keep in triggeredDeaths if we've already triggered for it
-                it = previouslyAliveInstigators.erase(it);
-            } else {
-                // There's a new object at this address (or the object became alive again)
-                // Keep tracking it - we already updated the name cache above
-                ++it;
-            }
-        } else {
-            ++it;
-        }
-    }
-    
-    // Clean up triggered deaths and name cache for objects that are fully destroyed
-    // (no longer in engine's object list and not alive)
-    for (auto it = triggeredDeaths.begin(); it != triggeredDeaths.end();) {
-        Object* deadObj = *it;
-        // If the object is no longer alive, check if it's still in the engine's object list
-        if (!deadObj || !Object::isAlive(deadObj)) {
-            bool stillInEngine = false;
-            if (engine) {
-                for (const auto& objectPtr : engine->getObjects()) {
-                    if (objectPtr.get() == deadObj) {
-                        stillInEngine = true;
-                        break;
-                    }
-                }
-            }
-            // If not in engine and not alive, it's fully destroyed - clean up
-            if (!stillInEngine) {
-                instigatorNames.erase(deadObj);  // Clean up name cache
-                it = triggeredDeaths.erase(it);
-            } else {
-                ++it;
-            }
-        } else {
-            ++it;
-        }
+        // Log when an instigator is first added to tracking
+        std::string objName = currentName.empty() ? "<unnamed>" : currentName;
+        std::cout << "[SensorComponent] InstigatorDeath: Added '" << objName 
+                  << "' to tracking list (now tracking " << previouslyAliveInstigators.size() 
+                  << " instigators)" << std::endl;
     }
 }
 
-void SensorComponent::cleanExpiredTimers(const std::unordered_set<Object*>& processed) {
+void SensorComponent::cleanExpiredTimers(const std::unordered_set<ObjectHandle>& processed) {
     for (auto it = conditionTimers.begin(); it != conditionTimers.end();) {
-        Object* instigator = it->first;
-        if (!instigator || !Object::isAlive(instigator) || processed.find(instigator) == processed.end()) {
+        ObjectHandle instigator = it->first;
+        if (!Object::isAlive(instigator) || processed.find(instigator) == processed.end()) {
             it = conditionTimers.erase(it);
             triggeredInstigators.erase(instigator);
         } else {
@@ -931,7 +644,9 @@ void SensorComponent::cleanExpiredTimers(const std::unordered_set<Object*>& proc
 }
 
 void SensorComponent::advanceTimersForCandidates(const std::vector<Object*>& candidates, float deltaTime) {
-    std::unordered_set<Object*> processed;
+    std::unordered_set<ObjectHandle> processed;
+    // The sensor itself is the "system" instigator for conditions that don't involve another object
+    const ObjectHandle systemInstigator = parent().getHandle();
 
     // Check non-object-based conditions first (InputActivity, GlobalValue)
     bool inputActivityOk = verifyInputActivityCondition();
@@ -948,31 +663,31 @@ void SensorComponent::advanceTimersForCandidates(const std::vector<Object*>& can
         if (inputActivityOk && globalValueOk) {
             // Only non-object conditions, trigger with self as instigator
             // Check if already triggered for this instigator (per-instigator satisfaction)
-            if (triggeredInstigators.find(&parent()) == triggeredInstigators.end()) {
+            if (triggeredInstigators.find(systemInstigator) == triggeredInstigators.end()) {
                 float nextTimer = 0.0f;
-                auto existing = conditionTimers.find(&parent());
+                auto existing = conditionTimers.find(systemInstigator);
                 if (existing != conditionTimers.end()) {
                     nextTimer = existing->second;
                 }
                 nextTimer += deltaTime;
-                conditionTimers[&parent()] = nextTimer;
+                conditionTimers[systemInstigator] = nextTimer;
                 
                 const float requiredHold = clampNonNegative(holdDuration);
                 if (nextTimer >= requiredHold) {
                     trigger(parent());
-                    triggeredInstigators.insert(&parent());
-                    previouslySatisfiedInstigators.insert(&parent());  // Mark as previously satisfied
+                    triggeredInstigators.insert(systemInstigator);
+                    previouslySatisfiedInstigators.insert(systemInstigator);  // Mark as previously satisfied
                 }
             }
-            processed.insert(&parent());
+            processed.insert(systemInstigator);
         } else {
             // Conditions not met - check if system was previously satisfied
-            bool wasSystemSatisfied = previouslySatisfiedInstigators.find(&parent()) != previouslySatisfiedInstigators.end();
+            bool wasSystemSatisfied = previouslySatisfiedInstigators.find(systemInstigator) != previouslySatisfiedInstigators.end();
             
             // Reset timer and allow retrigger
-            conditionTimers[&parent()] = 0.0f;
-            triggeredInstigators.erase(&parent());
-            previouslySatisfiedInstigators.erase(&parent());
+            conditionTimers[systemInstigator] = 0.0f;
+            triggeredInstigators.erase(systemInstigator);
+            previouslySatisfiedInstigators.erase(systemInstigator);
             
             // If system was previously satisfied and now isn't, trigger unsatisfied targets
             if (wasSystemSatisfied && !unsatisfiedTargetNames.empty()) {
@@ -983,23 +698,22 @@ void SensorComponent::advanceTimersForCandidates(const std::vector<Object*>& can
     
     // Special handling: If sensor has GlobalValue or InputActivity condition,
     // these should only trigger once (not once per candidate)
-    // Use the sensor itself as a special "system" instigator for these conditions
     bool hasSystemConditions = senseMaskHas(requiredSenses, SenseType::InputActivity) || 
                                senseMaskHas(requiredSenses, SenseType::GlobalValue);
-    Object* systemInstigator = &parent();  // Use sensor itself as system instigator
     
     // Track if system conditions have already triggered
     bool systemConditionsTriggered = triggeredInstigators.find(systemInstigator) != triggeredInstigators.end();
     bool systemConditionsMet = inputActivityOk && globalValueOk;
 
     for (Object* candidate : candidates) {
-        if (!candidate || (candidate == &parent() && !allowSelfTrigger) || !Object::isAlive(candidate)) {
+        if (!candidate || (candidate == &parent() && !allowSelfTrigger)) {
             continue;
         }
+        const ObjectHandle candidateHandle = candidate->getHandle();
 
         auto* interact = candidate->getComponent<InteractComponent>();
         if (!interact && requireInteractInput && allowedInstigatorNames.empty()) {
-            conditionTimers.erase(candidate);
+            conditionTimers.erase(candidateHandle);
             continue;
         }
 
@@ -1011,7 +725,7 @@ void SensorComponent::advanceTimersForCandidates(const std::vector<Object*>& can
                                   !requireInteractInput && !requireBoxZone;
         
         if (!isPureSystemSensor && !isInstigatorEligible(*candidate)) {
-            conditionTimers.erase(candidate);
+            conditionTimers.erase(candidateHandle);
             continue;
         }
 
@@ -1020,7 +734,7 @@ void SensorComponent::advanceTimersForCandidates(const std::vector<Object*>& can
         const bool interactOk = interact ? verifyInteractCondition(*interact) : (!requireInteractInput);
         const bool boxZoneOk = verifyBoxZoneCondition(*candidate);
 
-        processed.insert(candidate);
+        processed.insert(candidateHandle);
 
         // For object-specific conditions (collision, distance, interact, boxzone)
         const bool objectConditionsMet = collisionOk && distanceOk && interactOk && boxZoneOk;
@@ -1033,12 +747,12 @@ void SensorComponent::advanceTimersForCandidates(const std::vector<Object*>& can
                 // System conditions not met or already triggered
                 // But we still need to check if object conditions were previously satisfied
                 // (e.g., object was in distance range but system condition failed)
-                bool wasPreviouslySatisfied = previouslySatisfiedInstigators.find(candidate) != previouslySatisfiedInstigators.end();
+                bool wasPreviouslySatisfied = previouslySatisfiedInstigators.find(candidateHandle) != previouslySatisfiedInstigators.end();
                 
                 // Reset timer and allow retrigger for this instigator
-                conditionTimers[candidate] = 0.0f;
-                triggeredInstigators.erase(candidate);
-                previouslySatisfiedInstigators.erase(candidate);
+                conditionTimers[candidateHandle] = 0.0f;
+                triggeredInstigators.erase(candidateHandle);
+                previouslySatisfiedInstigators.erase(candidateHandle);
                 
                 // If instigator was previously satisfied (due to object conditions) and now isn't,
                 // trigger unsatisfied targets (even if system conditions failed)
@@ -1057,20 +771,20 @@ void SensorComponent::advanceTimersForCandidates(const std::vector<Object*>& can
                 // Check if this candidate's object conditions are met
                 if (objectConditionsMet) {
                     // Use this candidate as the instigator, but mark system conditions as triggered
-                    if (triggeredInstigators.find(candidate) == triggeredInstigators.end()) {
+                    if (triggeredInstigators.find(candidateHandle) == triggeredInstigators.end()) {
                         float nextTimer = 0.0f;
-                        auto existing = conditionTimers.find(candidate);
+                        auto existing = conditionTimers.find(candidateHandle);
                         if (existing != conditionTimers.end()) {
                             nextTimer = existing->second;
                         }
                         nextTimer += deltaTime;
-                        conditionTimers[candidate] = nextTimer;
+                        conditionTimers[candidateHandle] = nextTimer;
 
                         const float requiredHold = clampNonNegative(holdDuration);
                         if (nextTimer >= requiredHold) {
                             trigger(*candidate);
-                            triggeredInstigators.insert(candidate);
-                            previouslySatisfiedInstigators.insert(candidate);  // Mark as previously satisfied
+                            triggeredInstigators.insert(candidateHandle);
+                            previouslySatisfiedInstigators.insert(candidateHandle);  // Mark as previously satisfied
                             triggeredInstigators.insert(systemInstigator);  // Mark system conditions as triggered
                             systemConditionsTriggered = true;  // Update local flag
                         }
@@ -1078,31 +792,31 @@ void SensorComponent::advanceTimersForCandidates(const std::vector<Object*>& can
                 }
             } else if (!hasSystemConditions) {
                 // No system conditions, use per-candidate logic
-                if (triggeredInstigators.find(candidate) == triggeredInstigators.end()) {
+                if (triggeredInstigators.find(candidateHandle) == triggeredInstigators.end()) {
                     float nextTimer = 0.0f;
-                    auto existing = conditionTimers.find(candidate);
+                    auto existing = conditionTimers.find(candidateHandle);
                     if (existing != conditionTimers.end()) {
                         nextTimer = existing->second;
                     }
                     nextTimer += deltaTime;
-                    conditionTimers[candidate] = nextTimer;
+                    conditionTimers[candidateHandle] = nextTimer;
 
                     const float requiredHold = clampNonNegative(holdDuration);
                     if (nextTimer >= requiredHold) {
                         trigger(*candidate);
-                        triggeredInstigators.insert(candidate);
-                        previouslySatisfiedInstigators.insert(candidate);  // Mark as previously satisfied
+                        triggeredInstigators.insert(candidateHandle);
+                        previouslySatisfiedInstigators.insert(candidateHandle);  // Mark as previously satisfied
                     }
                 }
             }
         } else {
             // Conditions not met - check if this instigator was previously satisfied
-            bool wasPreviouslySatisfied = previouslySatisfiedInstigators.find(candidate) != previouslySatisfiedInstigators.end();
+            bool wasPreviouslySatisfied = previouslySatisfiedInstigators.find(candidateHandle) != previouslySatisfiedInstigators.end();
             
             // Reset timer and allow retrigger for this instigator
-            conditionTimers[candidate] = 0.0f;
-            triggeredInstigators.erase(candidate);
-            previouslySatisfiedInstigators.erase(candidate);
+            conditionTimers[candidateHandle] = 0.0f;
+            triggeredInstigators.erase(candidateHandle);
+            previouslySatisfiedInstigators.erase(candidateHandle);
             
             // If instigator was previously satisfied and now isn't, trigger unsatisfied targets
             if (wasPreviouslySatisfied && !unsatisfiedTargetNames.empty()) {
@@ -1126,62 +840,98 @@ void SensorComponent::advanceTimersForCandidates(const std::vector<Object*>& can
     cleanExpiredTimers(processed);
 }
 
+void SensorComponent::useTarget(Object& target, Object& instigator) {
+    // use() can spawn, kill or move anything, so from the parallel phase it waits for the
+    // apply phase (by handle, in case either object dies first)
+    if (!JobSystem::isInParallelPhase()) {
+        target.use(instigator);
+        return;
+    }
+    ObjectHandle targetHandle = target.getHandle();
+    ObjectHandle instigatorHandle = instigator.getHandle();
+    JobSystem::runOrDefer([targetHandle, instigatorHandle]() {
+        Object* deferredTarget = Object::resolve(targetHandle);
+        Object* deferredInstigator = Object::resolve(instigatorHandle);
+        if (deferredTarget && deferredInstigator) {
+            deferredTarget->use(*deferredInstigator);
+        }
+    });
+}
+
 void SensorComponent::trigger(Object& instigator) {
-    refreshTargetCache();
+    ++fireCount;
+    const std::vector<ObjectHandle> targets = collectTargets(targetMatcher);
 
     const std::string sensorName = parent().getName().empty() ? "<unnamed_sensor>" : parent().getName();
     const std::string instigatorName = instigator.getName().empty() ? "<unnamed_instigator>" : instigator.getName();
     std::cout << "[SensorComponent] Sensor '" << sensorName << "' triggered by '" << instigatorName << "'. Target count: "
-              << targetCache.size() << std::endl;
+              << targets.size() << std::endl;
 
-    if (targetCache.empty()) {
-        return;
-    }
-
-    for (Object* target : targetCache) {
-        if (!target || !Object::isAlive(target)) {
-            targetCacheDirty = true;
-            continue;
+    for (ObjectHandle handle : targets) {
+        if (Object* target = Object::resolve(handle)) {
+            useTarget(*target, instigator);
         }
-        // Allow self-triggering if enabled
-        if (target == &parent() && !allowSelfTrigger) {
-            continue;
-        }
-        target->use(instigator);
     }
 }
 
 void SensorComponent::triggerUnsatisfied(Object& instigator) {
-    refreshUnsatisfiedTargetCache();
+    ++fireCount;
+    const std::vector<ObjectHandle> targets = collectTargets(unsatisfiedTargetMatcher);
 
     const std::string sensorName = parent().getName().empty() ? "<unnamed_sensor>" : parent().getName();
     const std::string instigatorName = instigator.getName().empty() ? "<unnamed_instigator>" : instigator.getName();
     std::cout << "[SensorComponent] Sensor '" << sensorName << "' unsatisfied by '" << instigatorName << "'. Unsatisfied target count: "
-              << unsatisfiedTargetCache.size() << std::endl;
+              << targets.size() << std::endl;
 
-    if (unsatisfiedTargetCache.empty()) {
-        return;
-    }
-
-    for (Object* target : unsatisfiedTargetCache) {
-        if (!target || !Object::isAlive(target)) {
-            unsatisfiedTargetCacheDirty = true;
-            continue;
+    for (ObjectHandle handle : targets) {
+        if (Object* target = Object::resolve(handle)) {
+            useTarget(*target, instigator);
         }
-        // Allow self-triggering if enabled
-        if (target == &parent() && !allowSelfTrigger) {
-            continue;
-        }
-        target->use(instigator);
     }
 }
 
 void SensorComponent::update(float deltaTime) {
     updateSenseMask();
     refreshShapeCache();
-    refreshTargetCache();
-    refreshUnsatisfiedTargetCache();
 
+    if (asleep) {
+        pendingDeltaTime += deltaTime;
+        if (eventDriven && pendingDeltaTime < wakeAfter && !inputsChangedSinceSleep()) {
+            return;
+        }
+        // Conditions held while asleep, so running timers get the whole time
+        asleep = false;
+        deltaTime = pendingDeltaTime;
+        pendingDeltaTime = 0.0f;
+    }
+
+    // Over-budget frames evaluate sensors on alternate steps, carrying the skipped time over;
+    // input sensors still run every step so presses aren't missed
+    if (canSleep() && FrameBudgetGovernor::getInstance().deferSensorUpdate(parent().getHandle().index)) {
+        pendingDeltaTime += deltaTime;
+        return;
+    }
+    deltaTime += pendingDeltaTime;
+    pendingDeltaTime = 0.0f;
+
+    Engine* engine = Object::getEngine();
+    if (!eventDriven || !canSleep() || !engine) {
+        evaluate(deltaTime);
+        return;
+    }
+
+    // Inputs are recorded before evaluating, so a change made while evaluating still wakes us
+    recordSleepInputs(*engine);
+    const uint64_t stateBefore = computeStateSignature();
+    const uint32_t firedBefore = fireCount;
+    evaluate(deltaTime);
+    if (fireCount == firedBefore && computeStateSignature() == stateBefore) {
+        asleep = true;
+        wakeAfter = nearestHoldRemaining();
+    }
+}
+
+void SensorComponent::evaluate(float deltaTime) {
     if (requireCollision && shapeCache.empty()) {
         // Without shapes we can't evaluate collision; ensure timers are cleared.
         conditionTimers.clear();
@@ -1213,6 +963,168 @@ void SensorComponent::update(float deltaTime) {
     advanceTimersForCandidates(candidates, deltaTime);
 }
 
+bool SensorComponent::canSleep() const {
+    // Interact presses and controller counts have no change notification, so keep polling
+    return !requireInteractInput && !requireInputActivity;
+}
+
+void SensorComponent::recordSleepInputs(Engine& engine) {
+    sleepShapeSignature = computeShapeSignature();
+    sleepTouchStamp = SensorEventManager::getInstance().getCurrentStamp();
+    sleepGlobalValueStamp = GlobalValueManager::getInstance().getCurrentStamp();
+    sleepNameVersion = engine.getNameIndex().getVersion();
+    sleepSpatialStamp = engine.getSpatialIndex().getSyncStamp();
+    sleepInsideSignature = computeInsideSignature(engine);
+    sleepX = sleepY = 0.0f;
+    if (cachedBody && B2_IS_NON_NULL(cachedBodyId)) {
+        auto [x, y, angle] = cachedBody->getPosition();
+        (void)angle;
+        sleepX = x;
+        sleepY = y;
+    }
+}
+
+bool SensorComponent::inputsChangedSinceSleep() {
+    Engine* engine = Object::getEngine();
+    if (!engine || computeShapeSignature() != sleepShapeSignature) {
+        return true;
+    }
+
+    // Contact and overlap begin/end events on our own shapes
+    SensorEventManager& eventManager = SensorEventManager::getInstance();
+    if (eventManager.getCurrentStamp() != sleepTouchStamp) {
+        for (const b2ShapeId shapeId : shapeCache) {
+            if (eventManager.getShapeChangeStamp(shapeId) > sleepTouchStamp) {
+                return true;
+            }
+        }
+        sleepTouchStamp = eventManager.getCurrentStamp();
+    }
+
+    if (requireGlobalValue && !globalValueName.empty() &&
+        GlobalValueManager::getInstance().getChangeStamp(globalValueName) > sleepGlobalValueStamp) {
+        return true;
+    }
+
+    // Objects entering or leaving the world change the candidate list of sensors that scan
+    // by name, and the tracked set of death sensors
+    const uint64_t nameVersion = engine->getNameIndex().getVersion();
+    const bool spatialCandidates = maxDistance > 0.0f || requireBoxZone || requireCollision;
+    if (nameVersion != sleepNameVersion && (!spatialCandidates || requireInstigatorDeath)) {
+        return true;
+    }
+
+    // Movement near a distance or box sensor only matters once an object crosses its boundary
+    float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+    if (getSpatialArea(minX, minY, maxX, maxY)) {
+        const SpatialIndex& spatialIndex = engine->getSpatialIndex();
+        float x = 0.0f, y = 0.0f;
+        if (cachedBody && B2_IS_NON_NULL(cachedBodyId)) {
+            auto [bodyX, bodyY, angle] = cachedBody->getPosition();
+            (void)angle;
+            x = bodyX;
+            y = bodyY;
+        }
+        const bool moved = maxDistance > 0.0f && (x != sleepX || y != sleepY);
+        if (moved || nameVersion != sleepNameVersion ||
+            spatialIndex.changedSince({minX, minY, maxX, maxY}, sleepSpatialStamp)) {
+            const uint64_t inside = computeInsideSignature(*engine);
+            if (inside != sleepInsideSignature) {
+                return true;
+            }
+            sleepSpatialStamp = spatialIndex.getSyncStamp();
+            sleepX = x;
+            sleepY = y;
+        }
+    }
+    sleepNameVersion = nameVersion;
+    return false;
+}
+
+float SensorComponent::nearestHoldRemaining() const {
+    // A timer above zero on an instigator that hasn't triggered is a hold in progress
+    const float requiredHold = clampNonNegative(holdDuration);
+    float nearest = std::numeric_limits<float>::infinity();
+    for (const auto& [handle, timer] : conditionTimers) {
+        if (timer > 0.0f && triggeredInstigators.find(handle) == triggeredInstigators.end()) {
+            nearest = std::min(nearest, std::max(0.0f, requiredHold - timer));
+        }
+    }
+    return nearest;
+}
+
+uint64_t SensorComponent::computeStateSignature() const {
+    // Timer values are left out (only whether they run), so a sensor holding a condition
+    // still counts as unchanged and can sleep until the hold expires
+    uint64_t signature = instigatorDeathTrackingInitialized ? 1 : 0;
+    for (const auto& [handle, timer] : conditionTimers) {
+        signature += mixHandle(handle, timer > 0.0f ? 2 : 3);
+    }
+    for (ObjectHandle handle : triggeredInstigators) {
+        signature += mixHandle(handle, 4);
+    }
+    for (ObjectHandle handle : previouslySatisfiedInstigators) {
+        signature += mixHandle(handle, 5);
+    }
+    for (ObjectHandle handle : previouslyAliveInstigators) {
+        signature += mixHandle(handle, 6);
+    }
+    return signature;
+}
+
+uint64_t SensorComponent::computeShapeSignature() const {
+    uint64_t signature = shapeCache.size();
+    for (const b2ShapeId shapeId : shapeCache) {
+        signature = signature * 0x100000001b3ULL ^ b2StoreShapeId(shapeId);
+    }
+    return signature;
+}
+
+bool SensorComponent::getSpatialArea(float& minX, float& minY, float& maxX, float& maxY) const {
+    if (maxDistance > 0.0f) {
+        if (!cachedBody || B2_IS_NULL(cachedBodyId)) {
+            return false;  // nothing can be in range of a sensor without a body
+        }
+        auto [x, y, angle] = cachedBody->getPosition();
+        (void)angle;
+        minX = x - maxDistance;
+        minY = y - maxDistance;
+        maxX = x + maxDistance;
+        maxY = y + maxDistance;
+        return true;
+    }
+    if (requireBoxZone) {
+        minX = boxZoneMinX;
+        minY = boxZoneMinY;
+        maxX = boxZoneMaxX;
+        maxY = boxZoneMaxY;
+        return true;
+    }
+    return false;
+}
+
+uint64_t SensorComponent::computeInsideSignature(Engine& engine) const {
+    // Same tests as verifyDistanceCondition and verifyBoxZoneCondition (body position)
+    std::vector<Object*> inside;
+    if (maxDistance > 0.0f) {
+        if (cachedBody && B2_IS_NON_NULL(cachedBodyId)) {
+            auto [x, y, angle] = cachedBody->getPosition();
+            (void)angle;
+            engine.getSpatialIndex().queryRadius(x, y, maxDistance, inside);
+        }
+    } else if (requireBoxZone) {
+        engine.getSpatialIndex().queryPoints({boxZoneMinX, boxZoneMinY, boxZoneMaxX, boxZoneMaxY}, inside);
+    }
+
+    uint64_t signature = 0;
+    for (Object* obj : inside) {
+        if (obj && passesCandidateFilter(*obj)) {
+            signature += mixHandle(obj->getHandle(), 7);
+        }
+    }
+    return signature;
+}
+
 void SensorComponent::draw() {
     // No direct rendering; sensor is logic-only.
 }
@@ -1243,6 +1155,9 @@ nlohmann::json SensorComponent::toJson() const {
     if (includeInteractComponent) {
         data["includeInteractComponent"] = includeInteractComponent;
     }
+    if (!eventDriven) {
+        data["eventDriven"] = eventDriven;
+    }
     if (!allowedInstigatorNames.empty()) {
         data["allowedInstigators"] = allowedInstigatorNames;
         if (useRegexForInstigators) {
@@ -1331,7 +1246,7 @@ int SensorComponent::getSatisfiedConditionCount(const std::vector<Object*>& allO
     
     // Check each candidate to see if it satisfies conditions
     for (Object* candidate : candidates) {
-        if (!candidate || (candidate == &parent() && !allowSelfTrigger) || !Object::isAlive(candidate)) {
+        if (!candidate || (candidate == &parent() && !allowSelfTrigger)) {
             continue;
         }
         
@@ -1419,7 +1334,7 @@ int SensorComponent::getSatisfyingObjectCount(const std::vector<Object*>& allObj
     
     // Check each candidate to see if it satisfies all conditions
     for (Object* candidate : candidates) {
-        if (!candidate || (candidate == &parent() && !allowSelfTrigger) || !Object::isAlive(candidate)) {
+        if (!candidate || (candidate == &parent() && !allowSelfTrigger)) {
             continue;
         }
         
@@ -1453,52 +1368,19 @@ int SensorComponent::getSatisfyingObjectCount(const std::vector<Object*>& allObj
 
 std::vector<Object*> SensorComponent::getTargetObjects(const std::vector<std::unique_ptr<Object>>& allObjects) const {
     std::vector<Object*> targets;
-    if (targetNames.empty()) {
+    if (targetMatcher.empty()) {
         return targets;
     }
     
-    // Compile regex patterns if using regex
-    std::vector<std::regex> regexes;
-    if (useRegex) {
-        for (const auto& pattern : targetNames) {
-            try {
-                regexes.emplace_back(pattern, std::regex::ECMAScript | std::regex::icase);
-            } catch (const std::regex_error& e) {
-                std::cerr << "[SensorComponent] Invalid regex pattern '" << pattern << "': " << e.what() << std::endl;
-            }
-        }
-    }
-    
     for (const auto& objectPtr : allObjects) {
         if (!objectPtr) {
             continue;
         }
         Object* obj = objectPtr.get();
-        if (!obj || !Object::isAlive(obj)) {
-            continue;
-        }
         if (obj == &parent() && !allowSelfTrigger) {
             continue;
         }
-        const std::string& objName = obj->getName();
-        
-        bool matches = false;
-        if (useRegex) {
-            // Check against regex patterns
-            for (const auto& regex : regexes) {
-                if (std::regex_search(objName, regex)) {
-                    matches = true;
-                    break;
-                }
-            }
-        } else {
-            // Exact name matching
-            if (std::find(targetNames.begin(), targetNames.end(), objName) != targetNames.end()) {
-                matches = true;
-            }
-        }
-        
-        if (matches) {
+        if (targetMatcher.matches(obj->getName())) {
             targets.push_back(obj);
         }
     }
@@ -1514,7 +1396,7 @@ std::vector<Object*> SensorComponent::getSatisfiedObjects() const {
     bool globalValueOk = verifyGlobalValueCondition();
 
     for (Object* candidate : candidates) {
-        if (!candidate || (candidate == &parent() && !allowSelfTrigger) || !Object::isAlive(candidate)) {
+        if (!candidate || (candidate == &parent() && !allowSelfTrigger)) {
             continue;
         }
 
@@ -1545,14 +1427,9 @@ std::vector<Object*> SensorComponent::getSatisfiedObjects() const {
 std::vector<Object*> SensorComponent::getSatisfiedInstigators() const {
     std::vector<Object*> instigators;
     instigators.reserve(triggeredInstigators.size());
-    for (Object* instigator : triggeredInstigators) {
-        if (!instigator) {
-            continue;
-        }
-        if (instigator == &parent()) {
-            continue;
-        }
-        if (!Object::isAlive(instigator)) {
+    for (ObjectHandle handle : triggeredInstigators) {
+        Object* instigator = Object::resolve(handle);
+        if (!instigator || instigator == &parent()) {
             continue;
         }
         instigators.push_back(instigator);
@@ -1564,7 +1441,7 @@ bool SensorComponent::isInstigatorSatisfied(const Object* object) const {
     if (!object || object == &parent()) {
         return false;
     }
-    return triggeredInstigators.find(const_cast<Object*>(object)) != triggeredInstigators.end();
+    return triggeredInstigators.find(object->getHandle()) != triggeredInstigators.end();
 }
 
 static ComponentRegistrar<SensorComponent> registrar("SensorComponent");
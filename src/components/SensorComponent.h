@@ -2,6 +2,8 @@
 
 #include "Component.h"
 #include "SensorTypes.h"
+#include "../NameMatcher.h"
+#include "../ObjectHandle.h"
 
 #include <box2d/box2d.h>
 
@@ -9,11 +11,11 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
-#include <regex>
 
 #include <nlohmann/json.hpp>
 
 class BodyComponent;
+class Engine;
 class InteractComponent;
 
 class SensorComponent : public Component {
@@ -27,6 +29,13 @@ public:
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "SensorComponent"; }
 
+    // Condition evaluation runs in the parallel phase; triggering targets is deferred
+    bool isParallelSafe() const override { return true; }
+
+    // Event-driven sensors skip evaluation while none of their inputs changed
+    bool isEventDriven() const { return eventDriven; }
+    bool isAsleep() const { return asleep; }
+
     void setTargetNames(const std::vector<std::string>& names);
     const std::vector<std::string>& getTargetNames() const { return targetNames; }
 
@@ -74,50 +83,73 @@ private:
     bool requireInstigatorDeath;  // Track instigator deaths
 
     std::vector<std::string> targetNames;
-    std::vector<std::regex> targetRegexes;  // Compiled regex patterns
+    NameMatcher targetMatcher;
     bool useRegex;  // Whether to use regex matching
     bool allowSelfTrigger;  // Whether sensor can trigger itself
     
     // Allowed instigator names (objects that can trigger without InteractComponent)
     std::vector<std::string> allowedInstigatorNames;
-    std::vector<std::regex> allowedInstigatorRegexes;  // Compiled regex patterns
+    NameMatcher allowedInstigatorMatcher;
     bool useRegexForInstigators;  // Whether to use regex matching for instigators
     bool includeInteractComponent;  // If true, include objects with InteractComponent in addition to allowedInstigators (whitelist mode)
     
     // Targets to trigger when conditions are no longer satisfied
     std::vector<std::string> unsatisfiedTargetNames;
-    std::vector<std::regex> unsatisfiedTargetRegexes;  // Compiled regex patterns
-    std::vector<Object*> unsatisfiedTargetCache;
-    bool unsatisfiedTargetCacheDirty;
-    
-    std::vector<Object*> targetCache;
-    bool targetCacheDirty;
+    NameMatcher unsatisfiedTargetMatcher;
 
     BodyComponent* cachedBody;
     b2BodyId cachedBodyId;
     bool usingSensorFixtures;
     std::vector<b2ShapeId> shapeCache;
 
-    std::unordered_map<Object*, float> conditionTimers;
-    std::unordered_set<Object*> triggeredInstigators;  // Track which instigators have triggered (per-instigator satisfaction)
-    std::unordered_set<Object*> previouslySatisfiedInstigators;  // Track which instigators were previously satisfied (for unsatisfied triggers)
+    // Per-instigator state is keyed by handle so a new object reusing a dead one's address starts fresh
+    std::unordered_map<ObjectHandle, float> conditionTimers;
+    std::unordered_set<ObjectHandle> triggeredInstigators;  // Track which instigators have triggered (per-instigator satisfaction)
+    std::unordered_set<ObjectHandle> previouslySatisfiedInstigators;  // Track which instigators were previously satisfied (for unsatisfied triggers)
     
     // Instigator death tracking
-    std::unordered_set<Object*> previouslyAliveInstigators;  // Track which instigators were alive in the previous frame
-    std::unordered_map<Object*, std::string> instigatorNames;  // Cache names for dead objects (safe to access after death)
-    std::unordered_set<Object*> triggeredDeaths;  // Track which instigators we've already triggered death for
+    std::unordered_set<ObjectHandle> previouslyAliveInstigators;  // Track which instigators were alive in the previous frame
+    std::unordered_map<ObjectHandle, std::string> instigatorNames;  // Cache names for dead objects (safe to access after death)
     bool instigatorDeathTrackingInitialized;  // Track if we've done the initial population (skip triggers on first frame)
+    mutable int lastControllerCount = -1;  // controller_connect: count at the last check (-1 = not checked yet)
+
+    // Event-driven evaluation: after an evaluation that changed nothing but running hold
+    // timers, the sensor sleeps until one of the inputs recorded below moves or the nearest
+    // hold expires, then evaluates once with the time it slept
+    bool eventDriven;
+    bool asleep = false;
+    float pendingDeltaTime = 0.0f;  // time slept or deferred by the frame budget governor
+    float wakeAfter = 0.0f;
+    uint32_t fireCount = 0;  // triggers sent, to tell a quiet evaluation from one that fired
+    uint64_t sleepShapeSignature = 0;
+    uint64_t sleepTouchStamp = 0;
+    uint64_t sleepGlobalValueStamp = 0;
+    uint64_t sleepNameVersion = 0;
+    uint32_t sleepSpatialStamp = 0;
+    uint64_t sleepInsideSignature = 0;
+    float sleepX = 0.0f;
+    float sleepY = 0.0f;
 
     void initializeDefaults();
     void refreshBodyCache();
     void refreshShapeCache();
-    void refreshTargetCache();
-    void rebuildTargetCache();
-    void refreshUnsatisfiedTargetCache();
-    void rebuildUnsatisfiedTargetCache();
+    void compileNameMatchers();
+    std::vector<ObjectHandle> collectTargets(const NameMatcher& matcher) const;  // matching objects, minus self
     void updateSenseMask();
 
+    void evaluate(float deltaTime);
+    bool canSleep() const;
+    void recordSleepInputs(Engine& engine);
+    bool inputsChangedSinceSleep();
+    float nearestHoldRemaining() const;
+    uint64_t computeStateSignature() const;
+    uint64_t computeShapeSignature() const;
+    bool getSpatialArea(float& minX, float& minY, float& maxX, float& maxY) const;  // false = no distance/box condition
+    uint64_t computeInsideSignature(Engine& engine) const;  // candidates satisfying the distance/box condition
+
     std::vector<Object*> gatherCandidates() const;
+    bool passesCandidateFilter(Object& obj) const;
+    bool collectNearbyObjects(Engine& engine, std::vector<Object*>& out) const;  // false = no spatial condition
     bool isInstigatorEligible(Object& instigator) const;
     bool verifyCollisionCondition(Object& instigator) const;
     bool verifyDistanceCondition(Object& instigator) const;
@@ -129,8 +161,9 @@ private:
 
     void advanceTimersForCandidates(const std::vector<Object*>& candidates, float deltaTime);
     void trigger(Object& instigator);
+    void useTarget(Object& target, Object& instigator);
     void triggerUnsatisfied(Object& instigator);
-    void cleanExpiredTimers(const std::unordered_set<Object*>& processed);
+    void cleanExpiredTimers(const std::unordered_set<ObjectHandle>& processed);
 
     static float computeDistanceSquared(Object& a, Object& b);
 };
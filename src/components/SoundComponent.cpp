@@ -58,6 +58,12 @@ void SoundComponent::initializeFromJson(const nlohmann::json& data) {
     }
 }
 
+bool SoundComponent::resetToPrototype(const nlohmann::json& data) {
+    actionSounds.clear();
+    initializeFromJson(data);
+    return true;
+}
+
 nlohmann::json SoundComponent::toJson() const {
     nlohmann::json data;
     data["type"] = getTypeName();
@@ -15,10 +15,12 @@ public:
     ~SoundComponent() override = default;
 
     void update(float /*deltaTime*/) override {}
+    TickRate getTickRate() const override { return TickRate::OnWake; }
     void draw() override {}
 
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "SoundComponent"; }
+    bool resetToPrototype(const nlohmann::json& data) override;
 
     void playActionSound(const std::string& actionName);
     void setActionCollection(const std::string& actionName, const std::string& collection, float volume = 1.0f);
@@ -4,6 +4,7 @@
 #include "../Engine.h"
 #include "../Object.h"
 #include "../components/BodyComponent.h"
+#include "../JobSystem.h"
 #include <algorithm>
 #include <cmath>
 #include <random>
@@ -64,7 +65,15 @@ SpriteComponent::SpriteComponent(Object& parent, const nlohmann::json& data)
       animationSpeedScale(0.0f),
       baseAnimationSpeed(animationSpeed),
       lastMeasuredSpeed(0.0f) {
-    
+    initializeFromJson(data);
+}
+
+SpriteComponent::SpriteComponent(Object& parent, const SpriteComponent& prototype)
+    : Component(parent) {
+    *this = prototype;
+}
+
+void SpriteComponent::initializeFromJson(const nlohmann::json& data) {
     if (data.contains("spriteName")) spriteName = data["spriteName"].get<std::string>();
     if (data.contains("currentFrame")) currentFrame = data["currentFrame"].get<int>();
     if (data.contains("animating")) animating = data["animating"].get<bool>();
@@ -91,6 +100,7 @@ SpriteComponent::SpriteComponent(Object& parent, const nlohmann::json& data)
     if (data.contains("tileHeight")) tileHeight = data["tileHeight"].get<float>();
     if (data.contains("renderWidth")) renderWidth = data["renderWidth"].get<float>();
     if (data.contains("renderHeight")) renderHeight = data["renderHeight"].get<float>();
+    layer = data.value("layer", layer);
     if (data.contains("stillSpriteName")) stillSpriteName = data["stillSpriteName"].get<std::string>();
     if (data.contains("movingSpriteName")) movingSpriteName = data["movingSpriteName"].get<std::string>();
     movementSpeedThreshold = data.value("movementSpeedThreshold", movementSpeedThreshold);
@@ -100,6 +110,41 @@ SpriteComponent::SpriteComponent(Object& parent, const nlohmann::json& data)
     baseAnimationSpeed = animationSpeed;
 }
 
+bool SpriteComponent::resetToPrototype(const nlohmann::json& data) {
+    // Constructor defaults, then the prototype's values
+    spriteName.clear();
+    currentFrame = 0;
+    animating = false;
+    looping = false;
+    animationSpeed = 10.0f;
+    animationTimer = 0.0f;
+    flipFlags = SDL_FLIP_NONE;
+    alpha = 255;
+    colorR = 255;
+    colorG = 255;
+    colorB = 255;
+    localX = 0.0f;
+    localY = 0.0f;
+    localAngle = 0.0f;
+    tiled = false;
+    tileWidth = 0.0f;
+    tileHeight = 0.0f;
+    renderWidth = 0.0f;
+    renderHeight = 0.0f;
+    layer = 0;
+    killAfterLoops = -1;
+    completedLoops = 0;
+    randomizeAnglePerFrame = false;
+    stillSpriteName.clear();
+    movingSpriteName.clear();
+    movementSpeedThreshold = 5.0f;
+    scaleAnimationWithSpeed = false;
+    animationSpeedScale = 0.0f;
+    lastMeasuredSpeed = 0.0f;
+    initializeFromJson(data);
+    return true;
+}
+
 nlohmann::json SpriteComponent::toJson() const {
     nlohmann::json j;
     j["type"] = getTypeName();
@@ -136,6 +181,7 @@ nlohmann::json SpriteComponent::toJson() const {
     }
     if (renderWidth > 0) j["renderWidth"] = renderWidth;
     if (renderHeight > 0) j["renderHeight"] = renderHeight;
+    if (layer != 0) j["layer"] = layer;
     if (randomizeAnglePerFrame) {
         j["randomizeAnglePerFrame"] = randomizeAnglePerFrame;
     }
@@ -160,6 +206,7 @@ nlohmann::json SpriteComponent::toJson() const {
 
 // Register this component type with the library
 static ComponentRegistrar<SpriteComponent> registrar("SpriteComponent");
+static ComponentCopyRegistrar<SpriteComponent> copyRegistrar("SpriteComponent");
 
 void SpriteComponent::update(float deltaTime) {
     updateMovementDrivenState();
@@ -195,7 +242,8 @@ void SpriteComponent::update(float deltaTime) {
             }
 
             if (shouldMarkForDeath) {
-                parent().markForDeath();
+                // Death runs onParentDeath hooks (explosions), so it waits for the apply phase
+                JobSystem::runOrDefer([this]() { parent().markForDeath(); });
             }
         }
 
@@ -206,24 +254,32 @@ void SpriteComponent::update(float deltaTime) {
 }
 
 void SpriteComponent::draw() {
-    const SpriteData* spriteData = SpriteManager::getInstance().getSpriteData(spriteName);
-    if (!spriteData) {
-        return;
-    }
-    SpriteFrame frameData = spriteData->getFrame(currentFrame);
     Engine* engine = Object::getEngine();
     if (!engine) {
         return;
     }
 
+    // The name and texture lookups only happen when the sprite changes
+    SpriteManager& spriteManager = SpriteManager::getInstance();
+    if (resolvedGeneration != spriteManager.getGeneration() || resolvedSpriteName != spriteName) {
+        resolvedSprite = spriteManager.resolveSprite(spriteName, resolvedTexture);
+        resolvedSpriteName = spriteName;
+        resolvedGeneration = spriteManager.getGeneration();
+    }
+    if (!resolvedSprite) {
+        return;
+    }
+    const SpriteData& spriteData = *resolvedSprite;
+    SpriteFrame frameData = spriteData.getFrame(currentFrame);
+
     // Get position and determine render size
     float x = 0.0f, y = 0.0f, angle = 0.0f;
     float actualRenderWidth = renderWidth;
     float actualRenderHeight = renderHeight;
     
     if (auto* body = parent().getComponent<BodyComponent>()) {
-        // Use physics body position
-        std::tie(x, y, angle) = body->getPosition();
+        // Use physics body position (interpolated between fixed steps)
+        std::tie(x, y, angle) = body->getRenderPosition();
         
         // If renderWidth/Height not specified, use BodyComponent's fixture size
         if (actualRenderWidth == 0.0f || actualRenderHeight == 0.0f) {
@@ -254,63 +310,28 @@ void SpriteComponent::draw() {
     float screenWidth = std::max(actualRenderWidth * scale, 1.0f);
     float screenHeight = std::max(actualRenderHeight * scale, 1.0f);
 
-    // Render the sprite - tiled or normal
-    if (tiled && actualRenderWidth > 0 && actualRenderHeight > 0) {
+    // Queue the sprite - tiled or normal
+    SDL_Color tint{colorR, colorG, colorB, alpha};
+    if (tiled) {
         // Tiled rendering - repeat texture instead of stretching
         float baseTileWidth = tileWidth > 0.0f ? tileWidth : static_cast<float>(frameData.w);
         float baseTileHeight = tileHeight > 0.0f ? tileHeight : static_cast<float>(frameData.h);
         float screenTileWidth = std::max(baseTileWidth * scale, 1.0f);
         float screenTileHeight = std::max(baseTileHeight * scale, 1.0f);
-        SpriteManager::getInstance().renderSpriteTiled(
-            spriteName,
-            currentFrame,
-            screenPos.x,
-            screenPos.y,
-            screenWidth,
-            screenHeight,
-            screenTileWidth,
-            screenTileHeight,
-            angle,
-            flipFlags,
-            alpha,
-            colorR,
-            colorG,
-            colorB
-        );
-    } else if (actualRenderWidth > 0 && actualRenderHeight > 0) {
-        SpriteManager::getInstance().renderSprite(
-            spriteName,
-            currentFrame,
-            screenPos.x,
-            screenPos.y,
-            screenWidth,
-            screenHeight,
-            angle,
-            flipFlags,
-            alpha,
-            colorR,
-            colorG,
-            colorB
-        );
+        spriteManager.queueSpriteTiled(spriteData, resolvedTexture, currentFrame, screenPos.x, screenPos.y,
+                                       screenWidth, screenHeight, screenTileWidth, screenTileHeight, angle,
+                                       flipFlags, tint, layer);
     } else {
-        // Normal rendering (use sprite's natural size)
-        SpriteManager::getInstance().renderSprite(
-            spriteName, 
-            currentFrame, 
-            screenPos.x,
-            screenPos.y,
-            screenWidth,
-            screenHeight,
-            angle, 
-            flipFlags, 
-            alpha,
-            colorR,
-            colorG,
-            colorB
-        );
+        spriteManager.queueSprite(spriteData, resolvedTexture, currentFrame, screenPos.x, screenPos.y,
+                                  screenWidth, screenHeight, angle, flipFlags, tint, layer);
     }
 }
 
+float SpriteComponent::getDrawOverhang() const {
+    // Without a custom size the sprite covers the fixture, which the body's bounds contain
+    return 0.5f * std::hypot(renderWidth, renderHeight);
+}
+
 void SpriteComponent::setCurrentSprite(const std::string& spriteName) {
     this->spriteName = spriteName;
     completedLoops = 0;
@@ -452,7 +473,8 @@ void SpriteComponent::setRenderSize(float width, float height) {
 }
 
 void SpriteComponent::applyRandomAngle() {
-    setAngle(randomAngleDegrees());
+    // Writes the body transform, so it's deferred when called from the parallel phase
+    JobSystem::runOrDefer([this]() { setAngle(randomAngleDegrees()); });
 }
 
 void SpriteComponent::updateMovementDrivenState() {
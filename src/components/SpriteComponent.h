@@ -4,10 +4,14 @@
 #include <SDL.h>
 #include <nlohmann/json.hpp>
 
+struct SpriteData;
+
 class SpriteComponent : public Component {
 public:
     SpriteComponent(Object& parent, const std::string& spriteName, bool animate = false, bool loop = false, int killAfterLoops = -1);
     SpriteComponent(Object& parent, const nlohmann::json& data);
+    // Typed copy of a prototype's component (ComponentCopyRegistrar)
+    SpriteComponent(Object& parent, const SpriteComponent& prototype);
     ~SpriteComponent() override = default;
 
     void update(float deltaTime) override;
@@ -17,6 +21,12 @@ public:
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "SpriteComponent"; }
 
+    // Animation runs in the parallel phase; body angle writes and markForDeath are deferred
+    bool isParallelSafe() const override { return true; }
+    bool resetToPrototype(const nlohmann::json& data) override;
+    // A custom render size can be larger than the fixture
+    float getDrawOverhang() const override;
+
     // Animation control
     void setCurrentSprite(const std::string& spriteName);
     void setFrame(int frameIndex);
@@ -51,6 +61,10 @@ public:
     // Tiling options
     void setTiled(bool tiled, float tileWidth = 0.0f, float tileHeight = 0.0f);
     void setRenderSize(float width, float height);
+    
+    // Draw order: higher layers draw over lower ones (RenderQueue), default 0
+    void setLayer(int layer) { this->layer = layer; }
+    int getLayer() const { return layer; }
 
 private:
     std::string spriteName;
@@ -78,6 +92,14 @@ private:
     float tileHeight{0.0f};
     float renderWidth{0.0f};  // Custom render size (0 = use sprite size)
     float renderHeight{0.0f};
+    int layer{0};
+
+    // Sprite and texture looked up for the last draw, reused while the name and
+    // SpriteManager's generation match
+    std::string resolvedSpriteName;
+    const SpriteData* resolvedSprite{nullptr};
+    SDL_Texture* resolvedTexture{nullptr};
+    uint32_t resolvedGeneration{0};
 
     // Animation lifecycle
     int killAfterLoops;   // -1 disables auto-death
@@ -93,6 +115,7 @@ private:
     float baseAnimationSpeed;
     float lastMeasuredSpeed;
 
+    void initializeFromJson(const nlohmann::json& data);
     void updateMovementDrivenState();
     void updateAnimationSpeedFromMovement();
     
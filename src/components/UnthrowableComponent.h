@@ -15,6 +15,7 @@ public:
     ~UnthrowableComponent() override = default;
 
     void update(float deltaTime) override {}
+    TickRate getTickRate() const override { return TickRate::OnWake; }
     void draw() override {}
 
     nlohmann::json toJson() const override;
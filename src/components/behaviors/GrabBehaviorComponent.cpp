@@ -13,7 +13,7 @@ GrabBehaviorComponent::GrabBehaviorComponent(Object& parent)
     : Component(parent)
     , input(nullptr)
     , body(nullptr)
-    , grabbedObject(nullptr)
+    , grabbedObject()
     , grabJoint(nullptr)
     , sound(nullptr)
     , grabDistance(80.0f)
@@ -28,7 +28,7 @@ GrabBehaviorComponent::GrabBehaviorComponent(Object& parent, const nlohmann::jso
     : Component(parent)
     , input(nullptr)
     , body(nullptr)
-    , grabbedObject(nullptr)
+    , grabbedObject()
     , grabJoint(nullptr)
     , sound(nullptr)
     , grabDistance(data.value("grabDistance", 80.0f))
@@ -87,15 +87,21 @@ void GrabBehaviorComponent::update(float deltaTime) {
     handleInteractInput();
 }
 
+Object* GrabBehaviorComponent::getGrabbedObject() const {
+    return Object::resolve(grabbedObject);
+}
+
 void GrabBehaviorComponent::autoReleaseIfNecessary() {
-    if (!grabbedObject) {
+    if (grabbedObject.isNull()) {
         return;
     }
 
-    bool shouldRelease = grabbedObject->isMarkedForDeath();
+    // The handle stops resolving once the held object is destroyed
+    Object* grabbed = getGrabbedObject();
+    bool shouldRelease = !grabbed || grabbed->isMarkedForDeath();
 
     if (!shouldRelease) {
-        if (auto* objBody = grabbedObject->getComponent<BodyComponent>()) {
+        if (auto* objBody = grabbed->getComponent<BodyComponent>()) {
             shouldRelease = B2_IS_NULL(objBody->getBodyId());
         } else {
             shouldRelease = true;
@@ -114,7 +120,8 @@ void GrabBehaviorComponent::autoReleaseIfNecessary() {
 }
 
 void GrabBehaviorComponent::maintainGrabbedObjectOffset() {
-    if (!grabbedObject || !grabJoint) {
+    Object* grabbed = getGrabbedObject();
+    if (!grabbed || !grabJoint) {
         return;
     }
 
@@ -130,7 +137,7 @@ void GrabBehaviorComponent::maintainGrabbedObjectOffset() {
     auto [playerX, playerY, playerAngleDeg] = body->getPosition();
     float playerAngleRad = Engine::degreesToRadians(playerAngleDeg);
 
-    BodyComponent* objBody = grabbedObject->getComponent<BodyComponent>();
+    BodyComponent* objBody = grabbed->getComponent<BodyComponent>();
     if (!objBody) {
         releaseGrabbedObject();
         return;
@@ -157,7 +164,7 @@ void GrabBehaviorComponent::maintainGrabbedObjectOffset() {
 void GrabBehaviorComponent::handleInteractInput() {
     bool interactPressed = input->isPressed(GameAction::ACTION_INTERACT);
     if (interactPressed && !wasInteractPressed) {
-        if (grabbedObject) {
+        if (!grabbedObject.isNull()) {
             releaseGrabbedObject();
         } else {
             Object* candidate = findGrabbableObject();
@@ -290,14 +297,14 @@ void GrabBehaviorComponent::grabObject(Object* obj) {
         return;
     }
 
-    grabbedObject = obj;
+    grabbedObject = obj->getHandle();
 
     auto [playerX, playerY, playerAngleDeg] = body->getPosition();
     float playerAngleRad = Engine::degreesToRadians(playerAngleDeg);
 
     BodyComponent* objBody = obj->getComponent<BodyComponent>();
     if (!objBody) {
-        grabbedObject = nullptr;
+        grabbedObject = ObjectHandle{};
         return;
     }
 
@@ -326,7 +333,7 @@ void GrabBehaviorComponent::grabObject(Object* obj) {
     }
 
     grabJoint->createMotorJoint(
-        grabbedObject,
+        obj,
         grabOffset,
         angularOffsetDeg,
         grabForce * 3.0f,
@@ -344,7 +351,7 @@ void GrabBehaviorComponent::grabObject(Object* obj) {
 }
 
 void GrabBehaviorComponent::releaseGrabbedObject(bool playSound) {
-    if (!grabbedObject) {
+    if (grabbedObject.isNull()) {
         return;
     }
 
@@ -355,19 +362,19 @@ void GrabBehaviorComponent::releaseGrabbedObject(bool playSound) {
     if (!sound) {
         sound = parent().getComponent<SoundComponent>();
     }
-    if (sound && grabbedObject && playSound) {
+    if (sound && playSound) {
         sound->playActionSound("grab_release");
     }
 
-    grabbedObject = nullptr;
+    grabbedObject = ObjectHandle{};
 }
 
 Object* GrabBehaviorComponent::detachGrabbedObject(bool playSound) {
-    if (!grabbedObject) {
+    if (grabbedObject.isNull()) {
         return nullptr;
     }
 
-    Object* objectToReturn = grabbedObject;
+    Object* objectToReturn = getGrabbedObject();
     releaseGrabbedObject(playSound);
     return objectToReturn;
 }
@@ -3,6 +3,7 @@
 #include "../Component.h"
 #include "../InputComponent.h"
 #include "../BodyComponent.h"
+#include "../../ObjectHandle.h"
 #include <nlohmann/json.hpp>
 
 class JointComponent;
@@ -25,8 +26,8 @@ public:
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "GrabBehaviorComponent"; }
 
-    Object* getGrabbedObject() const { return grabbedObject; }
-    bool hasGrabbedObject() const { return grabbedObject != nullptr; }
+    Object* getGrabbedObject() const;  // nullptr if nothing is held or the held object was destroyed
+    bool hasGrabbedObject() const { return getGrabbedObject() != nullptr; }
     JointComponent* getGrabJoint() const { return grabJoint; }
 
     void releaseGrabbedObject(bool playSound = true);
@@ -55,7 +56,7 @@ private:
     InputComponent* input;
     BodyComponent* body;
 
-    Object* grabbedObject;
+    ObjectHandle grabbedObject;
     JointComponent* grabJoint;
     SoundComponent* sound;
     float grabDistance;
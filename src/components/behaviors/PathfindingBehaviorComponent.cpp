@@ -325,7 +325,7 @@ bool PathfindingBehaviorComponent::rebuildPath() {
 }
 
 bool PathfindingBehaviorComponent::buildPathFrom(float startX, float startY, float goalX, float goalY) {
-    std::vector<ObstacleAABB> obstacles = collectStaticObstacles();
+    std::vector<ObstacleAABB> obstacles = collectStaticObstacles(startX, startY, goalX, goalY);
     GridDefinition grid = buildGrid(obstacles, startX, startY, goalX, goalY);
     if (grid.columns <= 0 || grid.rows <= 0) {
         return false;
@@ -357,31 +357,46 @@ bool PathfindingBehaviorComponent::buildPathFrom(float startX, float startY, flo
     return !worldPath.empty();
 }
 
-std::vector<PathfindingBehaviorComponent::ObstacleAABB> PathfindingBehaviorComponent::collectStaticObstacles() const {
+std::vector<PathfindingBehaviorComponent::ObstacleAABB> PathfindingBehaviorComponent::collectStaticObstacles(
+    float startX,
+    float startY,
+    float goalX,
+    float goalY) const {
+
     std::vector<ObstacleAABB> obstacles;
     Engine* engine = Object::getEngine();
     if (!engine) {
         return obstacles;
     }
 
-    auto gather = [&](const std::vector<std::unique_ptr<Object>>& container) {
-        for (const auto& obj : container) {
-            if (!obj) {
-                continue;
-            }
-            if (obj.get() == &parent()) {
-                continue;
-            }
-            BodyComponent* obstacleBody = obj->getComponent<BodyComponent>();
-            if (!obstacleBody || !obstacleBody->isStaticBody() || obstacleBody->hasOnlySensorFixtures()) {
-                continue;
-            }
-            obstacles.push_back(inflateBodyAABB(*obstacleBody, agentRadius));
+    auto consider = [&](Object* obj) {
+        if (!obj || obj == &parent()) {
+            return;
+        }
+        BodyComponent* obstacleBody = obj->getComponent<BodyComponent>();
+        if (!obstacleBody || !obstacleBody->isStaticBody() || obstacleBody->hasOnlySensorFixtures()) {
+            return;
         }
+        obstacles.push_back(inflateBodyAABB(*obstacleBody, agentRadius));
     };
 
-    gather(engine->getObjects());
-    gather(engine->getQueuedObjects());
+    // buildGrid never extends past maxSearchExtent beyond the start/goal box, so only
+    // obstacles whose inflated bounds reach into that window can block a cell
+    SpatialIndex::Bounds window{
+        std::min(startX, goalX) - maxSearchExtent - agentRadius,
+        std::min(startY, goalY) - maxSearchExtent - agentRadius,
+        std::max(startX, goalX) + maxSearchExtent + agentRadius,
+        std::max(startY, goalY) + maxSearchExtent + agentRadius};
+    std::vector<Object*> nearby;
+    engine->getSpatialIndex().queryAABB(window, nearby);
+    for (Object* obj : nearby) {
+        consider(obj);
+    }
+
+    // Objects spawned this frame aren't in the index until the next step
+    for (const auto& obj : engine->getQueuedObjects()) {
+        consider(obj.get());
+    }
 
     return obstacles;
 }
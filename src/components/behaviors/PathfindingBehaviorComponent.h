@@ -30,6 +30,9 @@ public:
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "PathfindingBehaviorComponent"; }
 
+    // Path building only reads bodies and writes this component
+    bool isParallelSafe() const override { return true; }
+
     void setDestination(float worldX, float worldY);
     void setDestination(const PathPoint& point);
     void clearDestination();
@@ -63,7 +66,7 @@ private:
     void updateNavigation(float deltaTime);
     bool rebuildPath();
     bool buildPathFrom(float startX, float startY, float goalX, float goalY);
-    std::vector<ObstacleAABB> collectStaticObstacles() const;
+    std::vector<ObstacleAABB> collectStaticObstacles(float startX, float startY, float goalX, float goalY) const;
     GridDefinition buildGrid(const std::vector<ObstacleAABB>& obstacles,
                              float startX,
                              float startY,
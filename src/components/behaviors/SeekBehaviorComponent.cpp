@@ -25,11 +25,12 @@ SeekBehaviorComponent::SeekBehaviorComponent(Object& parent)
     , pathfinder(nullptr)
     , sensor(nullptr)
     , body(nullptr)
-    , currentTarget(nullptr)
+    , currentTarget()
     , retargetInterval(0.5f)
     , retargetTimer(0.0f)
     , destinationUpdateThreshold(24.0f)
     , maxSearchDistance(0.0f)
+    , updateInterval(0.0f)
     , warnedMissingPathfinder(false)
     , warnedMissingSensor(false)
     , hasIssuedDestination(false) {
@@ -42,11 +43,12 @@ SeekBehaviorComponent::SeekBehaviorComponent(Object& parent, const nlohmann::jso
     , pathfinder(nullptr)
     , sensor(nullptr)
     , body(nullptr)
-    , currentTarget(nullptr)
+    , currentTarget()
     , retargetInterval(data.value("retargetInterval", 0.5f))
     , retargetTimer(0.0f)
     , destinationUpdateThreshold(data.value("destinationUpdateThreshold", 24.0f))
     , maxSearchDistance(data.value("maxSearchDistance", 0.0f))
+    , updateInterval(std::max(0.0f, data.value("updateInterval", 0.0f)))
     , warnedMissingPathfinder(false)
     , warnedMissingSensor(false)
     , hasIssuedDestination(false) {
@@ -84,7 +86,7 @@ Object* SeekBehaviorComponent::findClosestTarget() const {
     float closestDistSq = std::numeric_limits<float>::infinity();
 
     auto considerCandidate = [&](Object* candidate) {
-        if (!candidate || candidate == &parent() || !Object::isAlive(candidate)) {
+        if (!candidate || candidate == &parent()) {
             return;
         }
         BodyComponent* candidateBody = candidate->getComponent<BodyComponent>();
@@ -114,12 +116,6 @@ void SeekBehaviorComponent::updateDestination(Object& target) {
     if (!pathfinder) {
         return;
     }
-    if (!Object::isAlive(&target)) {
-        currentTarget = nullptr;
-        clearPathDestination();
-        return;
-    }
-
     BodyComponent* targetBody = target.getComponent<BodyComponent>();
     if (!targetBody) {
         return;
@@ -163,16 +159,17 @@ void SeekBehaviorComponent::update(float deltaTime) {
     retargetTimer -= deltaTime;
 
     auto invalidateTarget = [&]() {
-        currentTarget = nullptr;
+        currentTarget = ObjectHandle{};
         hasIssuedDestination = false;
         clearPathDestination();
     };
 
-    if (currentTarget) {
-        bool valid = Object::isAlive(currentTarget) && sensor && sensor->isInstigatorSatisfied(currentTarget);
+    Object* target = Object::resolve(currentTarget);
+    if (!currentTarget.isNull()) {
+        bool valid = target && sensor && sensor->isInstigatorSatisfied(target);
         if (valid && maxSearchDistance > 0.0f) {
             auto [selfX, selfY, _] = body->getPosition();
-            if (BodyComponent* targetBody = currentTarget->getComponent<BodyComponent>()) {
+            if (BodyComponent* targetBody = target->getComponent<BodyComponent>()) {
                 auto [targetX, targetY, _a] = targetBody->getPosition();
                 float distSq = squaredDistance(selfX, selfY, targetX, targetY);
                 if (distSq > maxSearchDistance * maxSearchDistance) {
@@ -187,17 +184,18 @@ void SeekBehaviorComponent::update(float deltaTime) {
         }
     }
 
-    if (!currentTarget && retargetTimer <= 0.0f) {
-        currentTarget = findClosestTarget();
+    if (currentTarget.isNull() && retargetTimer <= 0.0f) {
+        target = findClosestTarget();
+        currentTarget = target ? target->getHandle() : ObjectHandle{};
         retargetTimer = retargetInterval;
         hasIssuedDestination = false;
-        if (!currentTarget) {
+        if (!target) {
             clearPathDestination();
         }
     }
 
-    if (currentTarget) {
-        updateDestination(*currentTarget);
+    if (Object* seekTarget = Object::resolve(currentTarget)) {
+        updateDestination(*seekTarget);
     }
 }
 
@@ -207,6 +205,9 @@ nlohmann::json SeekBehaviorComponent::toJson() const {
     data["retargetInterval"] = retargetInterval;
     data["destinationUpdateThreshold"] = destinationUpdateThreshold;
     data["maxSearchDistance"] = maxSearchDistance;
+    if (updateInterval > 0.0f) {
+        data["updateInterval"] = updateInterval;
+    }
     return data;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Component.h"
+#include "../../ObjectHandle.h"
 #include "PathfindingBehaviorComponent.h"
 #include <nlohmann/json.hpp>
 #include <string>
@@ -26,6 +27,13 @@ public:
     nlohmann::json toJson() const override;
     std::string getTypeName() const override { return "SeekBehaviorComponent"; }
 
+    // Target selection only reads bodies/sensor and steers this object's pathfinder
+    bool isParallelSafe() const override { return true; }
+
+    // With updateInterval set, target checks run on that cadence (the pathfinder still steers every step)
+    TickRate getTickRate() const override { return updateInterval > 0.0f ? TickRate::Interval : TickRate::EveryFrame; }
+    float getTickInterval() const override { return updateInterval; }
+
 private:
     void resolveDependencies();
     Object* findClosestTarget() const;
@@ -35,12 +43,13 @@ private:
     PathfindingBehaviorComponent* pathfinder;
     SensorComponent* sensor;
     BodyComponent* body;
-    Object* currentTarget;
+    ObjectHandle currentTarget;
 
     float retargetInterval;
     float retargetTimer;
     float destinationUpdateThreshold;
     float maxSearchDistance;
+    float updateInterval;  // seconds between updates, 0 = every step
 
     bool warnedMissingPathfinder;
     bool warnedMissingSensor;
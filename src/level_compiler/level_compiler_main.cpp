@@ -0,0 +1,104 @@
+#include "../LevelFormat.h"
+
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+void PrintUsage(const char* programName) {
+    std::cout << "Usage: " << programName << " [OPTIONS] <file.json>..." << std::endl;
+    std::cout << "Compiles level, save and object template files to the binary .lvlb format" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --out-dir <dir>            Write .lvlb files to dir (default: next to each input)" << std::endl;
+    std::cout << "  --templates                Treat inputs as object template files" << std::endl;
+    std::cout << "                             (default: inferred, objectData.json is a template file)" << std::endl;
+    std::cout << "  --help                     Show this help message" << std::endl;
+}
+
+bool CompileFile(const std::filesystem::path& input, const std::string& outDir, bool forceTemplates) {
+    std::ifstream file(input, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open file " << input.string() << std::endl;
+        return false;
+    }
+    std::vector<uint8_t> source((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    nlohmann::json document;
+    try {
+        document = nlohmann::json::parse(source.begin(), source.end());
+    } catch (const nlohmann::json::exception& e) {
+        std::cerr << "Error: " << input.string() << ": JSON parsing error: " << e.what() << std::endl;
+        return false;
+    }
+
+    bool templates = forceTemplates || input.filename() == "objectData.json";
+    LevelFormat::Kind kind = templates ? LevelFormat::Kind::Templates : LevelFormat::Kind::Level;
+
+    std::vector<uint8_t> compiled;
+    try {
+        compiled = LevelFormat::compile(document, kind, source.size(),
+                                        LevelFormat::hashBytes(source.data(), source.size()));
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << input.string() << ": " << e.what() << std::endl;
+        return false;
+    }
+
+    std::filesystem::path output = LevelFormat::binaryPathFor(input.string());
+    if (!outDir.empty()) {
+        output = std::filesystem::path(outDir) / output.filename();
+    }
+    std::ofstream out(output, std::ios::binary | std::ios::trunc);
+    if (!out.is_open() || !out.write(reinterpret_cast<const char*>(compiled.data()), compiled.size())) {
+        std::cerr << "Error: Could not write " << output.string() << std::endl;
+        return false;
+    }
+    std::cout << input.string() << " -> " << output.string() << " (" << source.size() << " -> "
+              << compiled.size() << " bytes)" << std::endl;
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    std::string outDir;
+    bool forceTemplates = false;
+    std::vector<std::filesystem::path> inputs;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            PrintUsage(argv[0]);
+            return 0;
+        } else if (arg == "--out-dir" && i + 1 < argc) {
+            outDir = argv[++i];
+        } else if (arg == "--templates") {
+            forceTemplates = true;
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            PrintUsage(argv[0]);
+            return 1;
+        } else {
+            inputs.emplace_back(arg);
+        }
+    }
+
+    if (inputs.empty()) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (!outDir.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(outDir, ec);
+    }
+
+    int failures = 0;
+    for (const auto& input : inputs) {
+        if (!CompileFile(input, outDir, forceTemplates)) {
+            ++failures;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -3,8 +3,13 @@
 #include "menus/MenuManager.h"
 #include "components/BodyComponent.h"
 #include "components/InputComponent.h"
+#include "FrameProfiler.h"
+#include "InputRecorder.h"
+#include "ComponentLookupBenchmark.h"
+#include <algorithm>
 #include <iostream>
 #include <string>
+#include <thread>
 
 int main(int argc, char* argv[]) {
     std::cout << "=== Engine Start ===" << std::endl;
@@ -23,6 +28,33 @@ int main(int argc, char* argv[]) {
     bool serverManagerIPProvided = false;
     bool serverManagerPortProvided = false;
     
+    // Fixed-timestep simulation (off by default: variable step per frame)
+    bool fixedStep = false;
+    float simulationHz = 60.0f;
+    int maxCatchUpSteps = 5;
+    
+    // Headless: simulation and networking only, no window/renderer/audio/menus
+    bool headless = false;
+    std::string levelPath = "";
+    uint64_t frameLimit = 0;
+    
+    // Data-oriented component storage (opt-in)
+    bool pooledComponents = false;
+    
+    // Job workers for parallel-safe component updates (0 = off)
+    unsigned jobWorkers = 0;
+    
+    // Job workers for Box2D stepping (negative = not given: serverData.json "physicsWorkers" decides)
+    int physicsWorkers = -1;
+    
+    // Input record/replay
+    std::string recordPath = "";
+    std::string replayPath = "";
+    
+    // Frame profiler (F2 toggles the overlay, F3 exports a trace at runtime)
+    bool profileOverlay = false;
+    std::string profileTracePath = "";
+    
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
         
@@ -40,6 +72,48 @@ int main(int argc, char* argv[]) {
         } else if (arg == "--server-manager-port" && i + 1 < argc) {
             serverManagerPort = static_cast<uint16_t>(std::stoi(argv[++i]));
             serverManagerPortProvided = true;
+        } else if (arg == "--fixed-step") {
+            fixedStep = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                simulationHz = std::stof(argv[++i]);
+            }
+        } else if (arg == "--max-catchup-steps" && i + 1 < argc) {
+            maxCatchUpSteps = std::stoi(argv[++i]);
+        } else if (arg == "--headless") {
+            headless = true;
+        } else if (arg == "--level" && i + 1 < argc) {
+            levelPath = argv[++i];
+        } else if (arg == "--frames" && i + 1 < argc) {
+            frameLimit = std::stoull(argv[++i]);
+        } else if (arg == "--pooled-components") {
+            pooledComponents = true;
+        } else if (arg == "--jobs" && i + 1 < argc) {
+            int requested = std::stoi(argv[++i]);
+            if (requested < 0) {
+                // Negative: all hardware threads but the main one
+                requested = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+            }
+            jobWorkers = static_cast<unsigned>(std::max(requested, 0));
+        } else if (arg == "--physics-workers" && i + 1 < argc) {
+            int requested = std::stoi(argv[++i]);
+            if (requested < 0) {
+                requested = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+            }
+            physicsWorkers = std::max(requested, 0);
+        } else if (arg == "--record" && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (arg == "--profile") {
+            profileOverlay = true;
+        } else if (arg == "--profile-trace" && i + 1 < argc) {
+            profileTracePath = argv[++i];
+        } else if (arg == "--benchmark-component-lookups") {
+            int objectCount = 10000;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                objectCount = std::stoi(argv[++i]);
+            }
+            return runComponentLookupBenchmark(objectCount, 1000);
         } else if (arg == "--help" || arg == "-h") {
             std::cout << "Usage: " << argv[0] << " [options]" << std::endl;
             std::cout << "Options:" << std::endl;
@@ -48,14 +122,66 @@ int main(int argc, char* argv[]) {
             std::cout << "  --host-port PORT           Host port (default: 8889)" << std::endl;
             std::cout << "  --server-manager-ip IP     Server Manager IP (default: 127.0.0.1)" << std::endl;
             std::cout << "  --server-manager-port PORT Server Manager port (default: 8888)" << std::endl;
+            std::cout << "  --fixed-step [HZ]          Simulate in fixed steps with interpolated rendering (default: 60 Hz)" << std::endl;
+            std::cout << "  --max-catchup-steps N      Max fixed steps per frame before dropping backlog (default: 5)" << std::endl;
+            std::cout << "  --headless                 Run without window, rendering, audio or menus (requires --level)" << std::endl;
+            std::cout << "  --level FILE               Load a level file on startup instead of opening the menus" << std::endl;
+            std::cout << "  --frames N                 Quit after N frames (benchmarks / soak tests)" << std::endl;
+            std::cout << "  --pooled-components        Store components in per-type pools and update them type by type" << std::endl;
+            std::cout << "  --jobs N                   Update parallel-safe components on N worker threads (-1: one per core)" << std::endl;
+            std::cout << "  --physics-workers N        Step Box2D on N job workers (-1: one per core; default: serverData.json)" << std::endl;
+            std::cout << "  --record FILE              Record input from the next level load and write it on exit" << std::endl;
+            std::cout << "  --replay FILE              Replay a recording (loads its level, quits when it ends)" << std::endl;
+            std::cout << "  --profile                  Show the frame profiler overlay on startup" << std::endl;
+            std::cout << "  --profile-trace FILE       Profile the session and write a Chrome trace on exit" << std::endl;
+            std::cout << "  --benchmark-component-lookups [N]  Time component lookups on N objects (default: 10000) and exit" << std::endl;
             std::cout << "  --help, -h                 Show this help message" << std::endl;
             return 0;
         }
     }
     
+    InputRecorder& recorder = InputRecorder::getInstance();
+    if (!replayPath.empty()) {
+        if (!recorder.loadReplay(replayPath)) {
+            return 1;
+        }
+        levelPath = recorder.getLevelPath();
+        if (recorder.getFixedStepHz() > 0.0f) {
+            fixedStep = true;
+            simulationHz = recorder.getFixedStepHz();
+            maxCatchUpSteps = recorder.getMaxCatchUpSteps();
+        }
+    } else if (!recordPath.empty()) {
+        recorder.startRecording(recordPath);
+    }
+    
+    if (headless && levelPath.empty() && !clientMode) {
+        std::cerr << "ERROR: --headless needs a level to simulate (use --level FILE)" << std::endl;
+        return 1;
+    }
+    
     Engine e;
+    e.setHeadless(headless);
+    e.setFrameLimit(frameLimit);
+    e.setComponentPooling(pooledComponents);
+    e.setJobWorkers(jobWorkers);
+    if (physicsWorkers >= 0) {
+        e.setPhysicsWorkers(static_cast<unsigned>(physicsWorkers));
+    }
     e.init();
     
+    if (fixedStep) {
+        e.setFixedTimestep(true, simulationHz, maxCatchUpSteps);
+    }
+    
+    if (!profileTracePath.empty()) {
+        FrameProfiler::getInstance().setEnabled(true);
+        FrameProfiler::getInstance().setKeepFullHistory(true);
+    }
+    if (profileOverlay) {
+        FrameProfiler::getInstance().setOverlayVisible(true);
+    }
+    
     // Set connection parameters from command-line (only override those explicitly provided)
     // Command-line parameters always override config file values
     if (hostPortProvided || serverManagerIPProvided || serverManagerPortProvided) {
@@ -71,8 +197,8 @@ int main(int argc, char* argv[]) {
     InputManager::getInstance().loadNamedConfig("arrows", "assets/input_config_arrows.json");
     InputManager::getInstance().loadNamedConfig("default", "assets/input_config.json");
     
-    // Show main menu if neither host nor client mode
-    bool showMainMenu = !hostMode && !clientMode;
+    // Show main menu if neither host nor client mode (and no level was given on the command line)
+    bool showMainMenu = !hostMode && !clientMode && levelPath.empty() && !headless;
     
     // Connect as client if requested (don't load level - will be received from host)
     if (clientMode) {
@@ -92,6 +218,8 @@ int main(int argc, char* argv[]) {
             e.cleanup();
             return 1;
         }
+    } else if (!hostMode && !levelPath.empty()) {
+        e.loadFile(levelPath);
     } else if (!hostMode) {
         // Only load level file if not in client mode (host mode loads it too)
         //e.loadFile("assets/levels/level1.json");
@@ -113,8 +241,10 @@ int main(int argc, char* argv[]) {
             std::cout << "Share this room code with clients to join your game!" << std::endl;
             std::cout << "Hosting on port: " << hostPort << std::endl;
             std::cout << "Waiting for clients to connect..." << std::endl;
-            // Open level select menu so host can choose a level
-            if (e.getMenuManager()) {
+            if (!levelPath.empty()) {
+                e.loadFile(levelPath);
+            } else if (e.getMenuManager()) {
+                // Open level select menu so host can choose a level
                 e.getMenuManager()->openMenu("level_select");
             }
         } else {
@@ -131,11 +261,18 @@ int main(int argc, char* argv[]) {
         std::cout << "Main Menu opened" << std::endl;
     }
     
-    if (!showMainMenu) {
+    if (headless) {
+        std::cout << "Running headless, press Ctrl+C to quit" << std::endl;
+    } else if (!showMainMenu) {
         std::cout << "Press ESC to quit" << std::endl;
     }
 
     e.run();
+    recorder.finish();
+    
+    if (!profileTracePath.empty()) {
+        FrameProfiler::getInstance().exportChromeTrace(profileTracePath);
+    }
     e.cleanup();
     
     std::cout << "Engine finished" << std::endl;
@@ -2,6 +2,7 @@
 #include "MenuManager.h"
 #include "../Engine.h"
 #include "../ClientManager.h"
+#include "../TextRenderer.h"
 #include <SDL.h>
 #include <SDL_ttf.h>
 #include <algorithm>
@@ -370,10 +371,8 @@ void JoinMenu::loadResources() {
         return;
     }
     
-    if (TTF_WasInit()) {
-        font = TTF_OpenFont("assets/fonts/ARIAL.TTF", 24);
-        buttonFont = TTF_OpenFont("assets/fonts/ARIAL.TTF", 20);
-    }
+    font = TextRenderer::getInstance().getFont("assets/fonts/ARIAL.TTF", 24);
+    buttonFont = TextRenderer::getInstance().getFont("assets/fonts/ARIAL.TTF", 20);
     
     // Pre-render button textures
     if (buttonFont) {
@@ -432,14 +431,9 @@ void JoinMenu::unloadResources() {
         SDL_DestroyTexture(placeholderTexture);
         placeholderTexture = nullptr;
     }
-    if (font) {
-        TTF_CloseFont(font);
-        font = nullptr;
-    }
-    if (buttonFont) {
-        TTF_CloseFont(buttonFont);
-        buttonFont = nullptr;
-    }
+    // Fonts belong to TextRenderer
+    font = nullptr;
+    buttonFont = nullptr;
 }
 
 void JoinMenu::updateRoomCodeTexture() {
@@ -491,22 +485,11 @@ bool JoinMenu::render() {
     SDL_RenderFillRect(renderer, &bgRect);
     
     // Draw title
-    if (TTF_WasInit() && font) {
+    TextRenderer& text = TextRenderer::getInstance();
+    if (font) {
         SDL_Color white = {255, 255, 255, 255};
-        SDL_Surface* titleSurface = TTF_RenderUTF8_Blended(font, getTitle().c_str(), white);
-        if (titleSurface) {
-            SDL_Texture* titleTexture = SDL_CreateTextureFromSurface(renderer, titleSurface);
-            if (titleTexture) {
-                SDL_Rect titleRect;
-                titleRect.w = titleSurface->w;
-                titleRect.h = titleSurface->h;
-                titleRect.x = (screenWidth - titleRect.w) / 2;
-                titleRect.y = 40;
-                SDL_RenderCopy(renderer, titleTexture, nullptr, &titleRect);
-                SDL_DestroyTexture(titleTexture);
-            }
-            SDL_FreeSurface(titleSurface);
-        }
+        SDL_Point titleSize = text.measureLabel(font, getTitle());
+        text.drawLabel(font, getTitle(), static_cast<float>((screenWidth - titleSize.x) / 2), 40.0f, white);
     }
     
     // Draw room code input area
@@ -613,20 +596,9 @@ bool JoinMenu::render() {
             ? (connectingStatus.empty() ? std::string("Connecting...") : connectingStatus)
             : (failureMessage.empty() ? std::string("Connection failed. Returning...") : failureMessage);
         
-        SDL_Surface* statusSurface = TTF_RenderUTF8_Blended(font, message.c_str(), color);
-        if (statusSurface) {
-            SDL_Texture* statusTexture = SDL_CreateTextureFromSurface(renderer, statusSurface);
-            if (statusTexture) {
-                SDL_Rect statusRect;
-                statusRect.w = statusSurface->w;
-                statusRect.h = statusSurface->h;
-                statusRect.x = (screenWidth - statusRect.w) / 2;
-                statusRect.y = buttonY + buttonHeight + 20;
-                SDL_RenderCopy(renderer, statusTexture, nullptr, &statusRect);
-                SDL_DestroyTexture(statusTexture);
-            }
-            SDL_FreeSurface(statusSurface);
-        }
+        SDL_Point statusSize = text.measureLabel(font, message);
+        text.drawLabel(font, message, static_cast<float>((screenWidth - statusSize.x) / 2),
+                       static_cast<float>(buttonY + buttonHeight + 20), color);
     }
     
     return true;
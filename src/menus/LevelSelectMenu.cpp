@@ -4,6 +4,7 @@
 #include "../HostManager.h"
 #include "../SaveManager.h"
 #include "../SpriteManager.h"
+#include "../TextRenderer.h"
 #include <SDL.h>
 #include <SDL_ttf.h>
 #include <SDL_image.h>
@@ -449,12 +450,11 @@ void LevelSelectMenu::loadCachedResources() {
         return;
     }
     
-    // Load fonts once
-    if (TTF_WasInit()) {
-        titleFont = TTF_OpenFont("assets/fonts/ARIAL.TTF", 36);
-        levelFont = TTF_OpenFont("assets/fonts/ARIAL.TTF", 20);
-        buttonFont = TTF_OpenFont("assets/fonts/ARIAL.TTF", 24);
-    }
+    // Fonts are shared through TextRenderer
+    TextRenderer& text = TextRenderer::getInstance();
+    titleFont = text.getFont("assets/fonts/ARIAL.TTF", 36);
+    levelFont = text.getFont("assets/fonts/ARIAL.TTF", 20);
+    buttonFont = text.getFont("assets/fonts/ARIAL.TTF", 24);
     
     // Pre-render title texture
     if (titleFont) {
@@ -716,19 +716,10 @@ void LevelSelectMenu::loadCachedResources() {
 }
 
 void LevelSelectMenu::unloadCachedResources() {
-    // Unload fonts
-    if (titleFont) {
-        TTF_CloseFont(titleFont);
-        titleFont = nullptr;
-    }
-    if (levelFont) {
-        TTF_CloseFont(levelFont);
-        levelFont = nullptr;
-    }
-    if (buttonFont) {
-        TTF_CloseFont(buttonFont);
-        buttonFont = nullptr;
-    }
+    // Fonts belong to TextRenderer
+    titleFont = nullptr;
+    levelFont = nullptr;
+    buttonFont = nullptr;
     
     // Unload title texture
     if (titleTextTexture) {
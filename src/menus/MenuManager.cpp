@@ -2,6 +2,7 @@
 #include "LevelSelectMenu.h"
 #include "../Engine.h"
 #include "../InputManager.h"
+#include "../TextRenderer.h"
 #include "Menu.h"
 #include "MainMenu.h"
 #include "QuitConfirmMenu.h"
@@ -194,32 +195,17 @@ void MenuManager::render() {
     SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
     SDL_RenderDrawRect(renderer, &menuRect);
     
-    // Load fonts
-    TTF_Font* font = nullptr;
-    TTF_Font* titleFont = nullptr;
-    
-    if (TTF_WasInit()) {
-        titleFont = TTF_OpenFont("assets/fonts/ARIAL.TTF", 32);
-        font = TTF_OpenFont("assets/fonts/ARIAL.TTF", 24);
-    }
+    // Fonts are opened once; the title and item strings are cached textures, tinted per state
+    TextRenderer& text = TextRenderer::getInstance();
+    TTF_Font* titleFont = text.getFont("assets/fonts/ARIAL.TTF", 32);
+    TTF_Font* font = text.getFont("assets/fonts/ARIAL.TTF", 24);
     
     // Draw title
     if (titleFont && !title.empty()) {
         SDL_Color white = {255, 255, 255, 255};
-        SDL_Surface* titleSurface = TTF_RenderUTF8_Blended(titleFont, title.c_str(), white);
-        if (titleSurface) {
-            SDL_Texture* titleTexture = SDL_CreateTextureFromSurface(renderer, titleSurface);
-            if (titleTexture) {
-                SDL_Rect titleRect;
-                titleRect.w = titleSurface->w;
-                titleRect.h = titleSurface->h;
-                titleRect.x = menuRect.x + (menuRect.w - titleRect.w) / 2;
-                titleRect.y = menuRect.y + 20;
-                SDL_RenderCopy(renderer, titleTexture, nullptr, &titleRect);
-                SDL_DestroyTexture(titleTexture);
-            }
-            SDL_FreeSurface(titleSurface);
-        }
+        SDL_Point titleSize = text.measureLabel(titleFont, title);
+        text.drawLabel(titleFont, title, static_cast<float>(menuRect.x + (menuRect.w - titleSize.x) / 2),
+                       static_cast<float>(menuRect.y + 20), white);
     }
     
     // Draw menu items
@@ -247,27 +233,10 @@ void MenuManager::render() {
                 displayText += " (Disabled)";
             }*/
             
-            SDL_Surface* textSurface = TTF_RenderUTF8_Blended(font, displayText.c_str(), color);
-            if (textSurface) {
-                SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-                if (textTexture) {
-                    SDL_Rect textRect;
-                    textRect.w = textSurface->w;
-                    textRect.h = textSurface->h;
-                    textRect.x = menuRect.x + (menuRect.w - textRect.w) / 2;
-                    textRect.y = yOffset + static_cast<int>(i) * itemHeight;
-                    SDL_RenderCopy(renderer, textTexture, nullptr, &textRect);
-                    SDL_DestroyTexture(textTexture);
-                }
-                SDL_FreeSurface(textSurface);
-            }
+            SDL_Point textSize = text.measureLabel(font, displayText);
+            text.drawLabel(font, displayText, static_cast<float>(menuRect.x + (menuRect.w - textSize.x) / 2),
+                           static_cast<float>(yOffset + static_cast<int>(i) * itemHeight), color);
         }
-        
-        TTF_CloseFont(font);
-    }
-    
-    if (titleFont) {
-        TTF_CloseFont(titleFont);
     }
 }
 